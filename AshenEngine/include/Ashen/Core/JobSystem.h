@@ -0,0 +1,47 @@
+#ifndef ASHEN_JOBSYSTEM_H
+#define ASHEN_JOBSYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "Ashen/Core/Types.h"
+
+namespace ash {
+    // Pool de threads minimal pour le parallélisme de données.
+    // ParallelFor découpe [0, count) en lots ; le thread appelant participe
+    // au travail et ne rend la main qu'une fois tous les lots terminés.
+    class JobSystem {
+    public:
+        // 0 = un thread par coeur, moins le thread appelant
+        explicit JobSystem(u32 threadCount = 0);
+
+        ~JobSystem();
+
+        JobSystem(const JobSystem &) = delete;
+
+        JobSystem &operator=(const JobSystem &) = delete;
+
+        void ParallelFor(Size count, const Function<void(Size)> &func, Size batchSize = 1);
+
+        // Tâche indépendante, sans attente
+        void Submit(Function<void()> job);
+
+        [[nodiscard]] Size GetThreadCount() const { return m_Threads.size(); }
+
+        // Pool partagé par tout le moteur
+        static JobSystem &Get();
+
+    private:
+        Vector<std::thread> m_Threads;
+        Deque<Function<void()> > m_Jobs;
+        std::mutex m_Mutex;
+        std::condition_variable m_CV;
+        bool m_Running = true;
+
+        void WorkerLoop();
+    };
+}
+
+#endif // ASHEN_JOBSYSTEM_H
@@ -2,6 +2,8 @@
 #define ASHEN_TYPES_H
 
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <memory>
 #include <vector>
 #include <deque>
@@ -105,6 +107,311 @@ namespace ash {
     template<typename T1, typename T2>
     using Pair = std::pair<T1, T2>;
 
+    // ===== Hash =====
+
+    // Finaliseur splitmix64 : répartit les bits d'un hash faible sur tout le mot
+    [[nodiscard]] constexpr u64 MixHash(u64 value) noexcept {
+        value ^= value >> 30;
+        value *= 0xBF58476D1CE4E5B9ull;
+        value ^= value >> 27;
+        value *= 0x94D049BB133111EBull;
+        value ^= value >> 31;
+        return value;
+    }
+
+    // Entrelace les 21 bits de poids faible de v (un bit tous les 3)
+    [[nodiscard]] constexpr u64 SpreadBits3(const u32 v) noexcept {
+        u64 x = v & 0x1FFFFFu;
+        x = (x | x << 32) & 0x1F00000000FFFFull;
+        x = (x | x << 16) & 0x1F0000FF0000FFull;
+        x = (x | x << 8) & 0x100F00F00F00F00Full;
+        x = (x | x << 4) & 0x10C30C30C30C30C3ull;
+        x = (x | x << 2) & 0x1249249249249249ull;
+        return x;
+    }
+
+    // Hash de coordonnées entières 3D : code de Morton puis mélange.
+    // Des coordonnées voisines donnent des hash bien distribués.
+    [[nodiscard]] constexpr Size HashCoord3(const i32 x, const i32 y, const i32 z) noexcept {
+        const u64 morton = SpreadBits3(static_cast<u32>(x))
+                           | SpreadBits3(static_cast<u32>(y)) << 1
+                           | SpreadBits3(static_cast<u32>(z)) << 2;
+        return static_cast<Size>(MixHash(morton));
+    }
+
+    // ===== FlatHashMap =====
+
+    // Table de hachage à adressage ouvert (sondage linéaire, suppression par
+    // décalage arrière, sans pierres tombales). Les entrées sont stockées
+    // contiguës : pas d'allocation par noeud contrairement à HashMap.
+    // K et V doivent être constructibles par défaut. Comme pour un vector,
+    // toute insertion peut invalider itérateurs et références.
+    template<typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K> >
+    class FlatHashMap {
+    public:
+        using key_type = K;
+        using mapped_type = V;
+        using value_type = Pair<K, V>;
+        using size_type = Size;
+
+        template<bool IsConst>
+        class Iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = FlatHashMap::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<IsConst, const value_type *, value_type *>;
+            using reference = std::conditional_t<IsConst, const value_type &, value_type &>;
+            using MapPtr = std::conditional_t<IsConst, const FlatHashMap *, FlatHashMap *>;
+
+            Iterator() = default;
+
+            Iterator(MapPtr map, const Size index) : m_map(map), m_index(index) {
+                skipEmpty();
+            }
+
+            operator Iterator<true>() const requires (!IsConst) { return Iterator<true>(m_map, m_index); }
+
+            reference operator*() const { return m_map->m_slots[m_index]; }
+            pointer operator->() const { return &m_map->m_slots[m_index]; }
+
+            Iterator &operator++() {
+                ++m_index;
+                skipEmpty();
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            bool operator==(const Iterator &other) const { return m_index == other.m_index; }
+
+            Size index() const { return m_index; }
+
+        private:
+            MapPtr m_map = nullptr;
+            Size m_index = 0;
+
+            void skipEmpty() {
+                while (m_index < m_map->m_used.size() && !m_map->m_used[m_index]) ++m_index;
+            }
+        };
+
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        FlatHashMap() = default;
+
+        explicit FlatHashMap(const Size capacity) { reserve(capacity); }
+
+        iterator begin() { return iterator(this, 0); }
+        iterator end() { return iterator(this, m_slots.size()); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, m_slots.size()); }
+
+        [[nodiscard]] Size size() const { return m_size; }
+        [[nodiscard]] bool empty() const { return m_size == 0; }
+        [[nodiscard]] Size capacity() const { return m_slots.size(); }
+
+        iterator find(const K &key) {
+            const Size index = findIndex(key);
+            return index == NPOS ? end() : iterator(this, index);
+        }
+
+        const_iterator find(const K &key) const {
+            const Size index = findIndex(key);
+            return index == NPOS ? end() : const_iterator(this, index);
+        }
+
+        [[nodiscard]] bool contains(const K &key) const { return findIndex(key) != NPOS; }
+
+        V &operator[](const K &key) { return emplace(key).first->second; }
+
+        template<typename... Args>
+        Pair<iterator, bool> emplace(const K &key, Args &&... args) {
+            if (const Size index = findIndex(key); index != NPOS)
+                return {iterator(this, index), false};
+
+            if ((m_size + 1) * MAX_LOAD_DEN > m_slots.size() * MAX_LOAD_NUM)
+                rehash(m_slots.empty() ? MIN_CAPACITY : m_slots.size() * 2);
+
+            Size index = slotFor(key);
+            while (m_used[index]) index = (index + 1) & m_mask;
+
+            m_slots[index] = value_type(key, V(std::forward<Args>(args)...));
+            m_used[index] = 1;
+            ++m_size;
+            return {iterator(this, index), true};
+        }
+
+        Pair<iterator, bool> insert(const value_type &value) { return emplace(value.first, value.second); }
+
+        Size erase(const K &key) {
+            const Size index = findIndex(key);
+            if (index == NPOS) return 0;
+
+            eraseAt(index);
+            return 1;
+        }
+
+        void clear() {
+            m_slots.clear();
+            m_used.clear();
+            m_size = 0;
+            m_mask = 0;
+        }
+
+        void reserve(const Size count) {
+            Size capacity = MIN_CAPACITY;
+            while (count * MAX_LOAD_DEN > capacity * MAX_LOAD_NUM) capacity *= 2;
+            if (capacity > m_slots.size()) rehash(capacity);
+        }
+
+    private:
+        static constexpr Size NPOS = static_cast<Size>(-1);
+        static constexpr Size MIN_CAPACITY = 16;
+        // Facteur de charge maximal : 7/8
+        static constexpr Size MAX_LOAD_NUM = 7;
+        static constexpr Size MAX_LOAD_DEN = 8;
+
+        Vector<value_type> m_slots;
+        Vector<u8> m_used;
+        Size m_size = 0;
+        Size m_mask = 0;
+
+        [[no_unique_address]] Hash m_hash;
+        [[no_unique_address]] KeyEqual m_equal;
+
+        Size slotFor(const K &key) const { return m_hash(key) & m_mask; }
+
+        Size findIndex(const K &key) const {
+            if (m_size == 0) return NPOS;
+
+            for (Size index = slotFor(key); m_used[index]; index = (index + 1) & m_mask) {
+                if (m_equal(m_slots[index].first, key)) return index;
+            }
+            return NPOS;
+        }
+
+        void eraseAt(Size hole) {
+            // Recule les entrées suivantes de la même grappe pour ne pas casser les sondages
+            for (Size next = (hole + 1) & m_mask; m_used[next]; next = (next + 1) & m_mask) {
+                const Size ideal = slotFor(m_slots[next].first);
+                const bool canMove = hole <= next
+                                         ? ideal <= hole || ideal > next
+                                         : ideal <= hole && ideal > next;
+                if (!canMove) continue;
+
+                m_slots[hole] = std::move(m_slots[next]);
+                hole = next;
+            }
+
+            m_slots[hole] = value_type();
+            m_used[hole] = 0;
+            --m_size;
+        }
+
+        void rehash(const Size capacity) {
+            Vector<value_type> oldSlots(capacity);
+            Vector<u8> oldUsed(capacity, 0);
+            oldSlots.swap(m_slots);
+            oldUsed.swap(m_used);
+            m_mask = capacity - 1;
+
+            for (Size i = 0; i < oldSlots.size(); ++i) {
+                if (!oldUsed[i]) continue;
+
+                Size index = slotFor(oldSlots[i].first);
+                while (m_used[index]) index = (index + 1) & m_mask;
+                m_slots[index] = std::move(oldSlots[i]);
+                m_used[index] = 1;
+            }
+        }
+    };
+
+    // Ensemble à adressage ouvert, même stockage que FlatHashMap
+    template<typename K, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K> >
+    class FlatHashSet {
+        struct Empty {
+        };
+
+        using Table = FlatHashMap<K, Empty, Hash, KeyEqual>;
+
+    public:
+        using key_type = K;
+        using value_type = K;
+        using size_type = Size;
+
+        class Iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = K;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const K *;
+            using reference = const K &;
+
+            Iterator() = default;
+
+            explicit Iterator(typename Table::const_iterator it) : m_it(it) {
+            }
+
+            reference operator*() const { return m_it->first; }
+            pointer operator->() const { return &m_it->first; }
+
+            Iterator &operator++() {
+                ++m_it;
+                return *this;
+            }
+
+            Iterator operator++(int) {
+                Iterator copy = *this;
+                ++m_it;
+                return copy;
+            }
+
+            bool operator==(const Iterator &other) const { return m_it == other.m_it; }
+
+        private:
+            typename Table::const_iterator m_it;
+        };
+
+        using iterator = Iterator;
+        using const_iterator = Iterator;
+
+        FlatHashSet() = default;
+
+        template<typename It>
+        FlatHashSet(It first, const It last) {
+            if constexpr (std::forward_iterator<It>)
+                reserve(static_cast<Size>(std::distance(first, last)));
+            for (; first != last; ++first) insert(*first);
+        }
+
+        Iterator begin() const { return Iterator(m_table.begin()); }
+        Iterator end() const { return Iterator(m_table.end()); }
+
+        [[nodiscard]] Size size() const { return m_table.size(); }
+        [[nodiscard]] bool empty() const { return m_table.empty(); }
+
+        [[nodiscard]] bool contains(const K &key) const { return m_table.contains(key); }
+        Iterator find(const K &key) const { return Iterator(m_table.find(key)); }
+
+        Pair<Iterator, bool> insert(const K &key) {
+            const auto [it, inserted] = m_table.emplace(key);
+            return {Iterator(typename Table::const_iterator(it)), inserted};
+        }
+
+        Size erase(const K &key) { return m_table.erase(key); }
+        void clear() { m_table.clear(); }
+        void reserve(const Size count) { m_table.reserve(count); }
+
+    private:
+        Table m_table;
+    };
+
     template<typename T>
     using Optional = std::optional<T>;
 
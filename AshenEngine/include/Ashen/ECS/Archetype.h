@@ -0,0 +1,125 @@
+#ifndef ASHEN_ARCHETYPE_H
+#define ASHEN_ARCHETYPE_H
+
+#include "Ashen/Core/Types.h"
+#include "Ashen/ECS/Component.h"
+#include "Ashen/ECS/EntityId.h"
+
+namespace ash {
+    struct EntityLocation {
+        u32 chunk = 0;
+        u32 row = 0;
+    };
+
+    // Blocs libérés par les archétypes d'un même Registry, gardés pour les suivants : le va-et-vient
+    // d'entités ne repasse plus par l'allocateur une fois le pic de population atteint
+    class ChunkPool {
+    public:
+        ChunkPool() = default;
+
+        ~ChunkPool();
+
+        ChunkPool(const ChunkPool &) = delete;
+
+        ChunkPool &operator=(const ChunkPool &) = delete;
+
+        byte *Acquire();
+
+        void Release(byte *data);
+
+        // Rend à l'allocateur les blocs inutilisés
+        void Trim();
+
+        [[nodiscard]] Size GetFreeCount() const { return m_Free.size(); }
+        [[nodiscard]] Size GetAllocatedCount() const { return m_Allocated; }
+
+    private:
+        Vector<byte *> m_Free;
+        Size m_Allocated = 0;
+    };
+
+    // Toutes les entités ayant exactement le même ensemble de composants.
+    // Stockage par blocs de CHUNK_BYTES octets : dans un bloc, les identifiants puis un tableau
+    // contigu par composant. Tous les blocs sont pleins sauf le dernier ; un retrait comble le trou
+    // avec la dernière ligne de l'archétype.
+    class Archetype {
+    public:
+        static constexpr Size CHUNK_BYTES = 16 * 1024;
+        static constexpr Size CHUNK_ALIGNMENT = 64;
+
+        struct Chunk {
+            byte *data = nullptr;
+            u32 count = 0;
+        };
+
+        Archetype(ComponentMask mask, ChunkPool &pool);
+
+        ~Archetype();
+
+        Archetype(const Archetype &) = delete;
+
+        Archetype &operator=(const Archetype &) = delete;
+
+        [[nodiscard]] ComponentMask GetMask() const { return m_Mask; }
+        [[nodiscard]] bool Has(const ComponentId id) const { return m_Mask >> id & 1; }
+        [[nodiscard]] const Vector<ComponentId> &GetComponents() const { return m_Components; }
+
+        [[nodiscard]] u32 GetChunkCapacity() const { return m_Capacity; }
+        [[nodiscard]] Size GetChunkCount() const { return m_Chunks.size(); }
+        [[nodiscard]] u32 GetChunkSize(const Size chunk) const { return m_Chunks[chunk].count; }
+        [[nodiscard]] Size GetEntityCount() const { return m_EntityCount; }
+
+        [[nodiscard]] EntityId *GetEntities(const Size chunk) const {
+            return reinterpret_cast<EntityId *>(m_Chunks[chunk].data);
+        }
+
+        // Tableau du composant id dans un bloc ; id doit appartenir à l'archétype
+        [[nodiscard]] void *GetColumn(const Size chunk, const ComponentId id) const {
+            return m_Chunks[chunk].data + m_Offsets[id];
+        }
+
+        template<typename T>
+        [[nodiscard]] T *GetColumn(const Size chunk) const {
+            return static_cast<T *>(GetColumn(chunk, ComponentRegistry::Id<T>()));
+        }
+
+        [[nodiscard]] void *GetComponent(const EntityLocation &location, const ComponentId id) const {
+            return static_cast<byte *>(GetColumn(location.chunk, id)) + location.row * m_Sizes[id];
+        }
+
+        // Ligne réservée en fin d'archétype ; ses composants restent à construire
+        EntityLocation Allocate(EntityId entity);
+
+        // Retire une ligne dont les composants sont déjà détruits ou déplacés.
+        // Retourne l'entité venue combler le trou, NULL_ENTITY si la ligne était la dernière
+        EntityId Erase(const EntityLocation &location);
+
+        void DestroyRow(const EntityLocation &location);
+
+        // Transitions déjà résolues vers l'archétype avec / sans un composant
+        [[nodiscard]] Archetype *GetAddEdge(const ComponentId id) const { return m_AddEdges[id]; }
+        [[nodiscard]] Archetype *GetRemoveEdge(const ComponentId id) const { return m_RemoveEdges[id]; }
+        void SetAddEdge(const ComponentId id, Archetype *archetype) { m_AddEdges[id] = archetype; }
+        void SetRemoveEdge(const ComponentId id, Archetype *archetype) { m_RemoveEdges[id] = archetype; }
+
+    private:
+        ComponentMask m_Mask;
+        ChunkPool &m_Pool;
+        Vector<ComponentId> m_Components;
+
+        // Indicés par ComponentId
+        Array<u32, MAX_COMPONENTS> m_Offsets{};
+        Array<u32, MAX_COMPONENTS> m_Sizes{};
+        Array<Archetype *, MAX_COMPONENTS> m_AddEdges{};
+        Array<Archetype *, MAX_COMPONENTS> m_RemoveEdges{};
+
+        u32 m_Capacity = 0;
+        Vector<Chunk> m_Chunks;
+        Size m_EntityCount = 0;
+
+        // Décalages des tableaux pour capacity lignes ; faux si le bloc déborde
+        bool ComputeLayout(u32 capacity);
+    };
+}
+
+#endif // ASHEN_ARCHETYPE_H
@@ -0,0 +1,79 @@
+#ifndef ASHEN_COMPONENT_H
+#define ASHEN_COMPONENT_H
+
+#include <bit>
+#include <new>
+
+#include "Ashen/Core/Types.h"
+
+namespace ash {
+    using ComponentId = u32;
+
+    // Un bit par type de composant : 64 types au plus dans un programme
+    using ComponentMask = u64;
+
+    constexpr Size MAX_COMPONENTS = 64;
+
+    // Ce qu'il faut savoir d'un type pour le ranger dans des octets bruts
+    struct ComponentInfo {
+        Size size = 0;
+        Size alignment = 1;
+
+        // Construit dst par déplacement depuis src, puis détruit src
+        void (*relocate)(void *dst, void *src) = nullptr;
+
+        void (*destroy)(void *ptr) = nullptr;
+    };
+
+    class ComponentRegistry {
+    public:
+        // Identifiant attribué au premier appel, stable pour toute l'exécution.
+        // std::length_error au-delà de MAX_COMPONENTS types
+        template<typename T>
+        static ComponentId Id() {
+            using Type = std::remove_cvref_t<T>;
+
+            // const T et T& partagent l'identifiant de T
+            if constexpr (!std::is_same_v<T, Type>) {
+                return Id<Type>();
+            } else {
+                static_assert(std::is_move_constructible_v<Type>, "Components must be move constructible");
+
+                static const ComponentId id = Register({
+                    sizeof(Type), alignof(Type),
+                    [](void *dst, void *src) {
+                        Type *source = static_cast<Type *>(src);
+                        new(dst) Type(std::move(*source));
+                        source->~Type();
+                    },
+                    [](void *ptr) { static_cast<Type *>(ptr)->~Type(); }
+                });
+                return id;
+            }
+        }
+
+        template<typename T>
+        static ComponentMask Bit() { return ComponentMask(1) << Id<T>(); }
+
+        static const ComponentInfo &Info(ComponentId id);
+
+    private:
+        static ComponentId Register(const ComponentInfo &info);
+    };
+
+    template<typename... Ts>
+    ComponentMask MaskOf() {
+        return (ComponentMask(0) | ... | ComponentRegistry::Bit<Ts>());
+    }
+
+    // Identifiants des bits levés de mask, par ordre croissant
+    template<typename Func>
+    void ForEachComponent(ComponentMask mask, Func &&func) {
+        while (mask) {
+            func(static_cast<ComponentId>(std::countr_zero(mask)));
+            mask &= mask - 1;
+        }
+    }
+}
+
+#endif // ASHEN_COMPONENT_H
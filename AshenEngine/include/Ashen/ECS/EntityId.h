@@ -0,0 +1,36 @@
+#ifndef ASHEN_ENTITYID_H
+#define ASHEN_ENTITYID_H
+
+#include <limits>
+
+#include "Ashen/Core/Types.h"
+
+namespace ash {
+    // Indice d'emplacement + génération : un identifiant conservé après Destroy ne désigne
+    // jamais l'entité qui réutilise ensuite l'emplacement
+    struct EntityId {
+        static constexpr u32 INVALID_INDEX = std::numeric_limits<u32>::max();
+
+        u32 index = INVALID_INDEX;
+        u32 generation = 0;
+
+        [[nodiscard]] constexpr bool IsNull() const { return index == INVALID_INDEX; }
+
+        constexpr bool operator==(const EntityId &other) const {
+            return index == other.index && generation == other.generation;
+        }
+
+        constexpr bool operator!=(const EntityId &other) const { return !(*this == other); }
+    };
+
+    constexpr EntityId NULL_ENTITY{};
+}
+
+template<>
+struct std::hash<ash::EntityId> {
+    std::size_t operator()(const ash::EntityId &id) const noexcept {
+        return (static_cast<std::size_t>(id.generation) << 32 | id.index) * 0x9E3779B97F4A7C15ull;
+    }
+};
+
+#endif // ASHEN_ENTITYID_H
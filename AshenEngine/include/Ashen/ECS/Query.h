@@ -0,0 +1,78 @@
+#ifndef ASHEN_QUERY_H
+#define ASHEN_QUERY_H
+
+#include "Ashen/Core/JobSystem.h"
+#include "Ashen/ECS/Registry.h"
+
+namespace ash {
+    // Entités possédant tous les Ts, parcourues bloc par bloc sur des tableaux contigus.
+    // const T : accès en lecture seule.
+    // La liste d'archétypes appartient au Registry et suit la création des nouveaux archétypes.
+    template<typename... Ts>
+    class Query {
+    public:
+        explicit Query(Registry &registry, const ComponentMask exclude = 0)
+            : m_Archetypes(&registry.Match(MaskOf<Ts...>(), exclude)) {
+        }
+
+        // func(EntityId, Ts &...)
+        template<typename Func>
+        void Each(Func &&func) const {
+            EachChunk([&func](const Size count, const EntityId *entities, Ts *... columns) {
+                for (Size row = 0; row < count; ++row)
+                    func(entities[row], columns[row]...);
+            });
+        }
+
+        // func(Size count, const EntityId *entities, Ts *...)
+        template<typename Func>
+        void EachChunk(Func &&func) const {
+            for (Archetype *archetype: *m_Archetypes) {
+                for (Size chunk = 0; chunk < archetype->GetChunkCount(); ++chunk) {
+                    func(static_cast<Size>(archetype->GetChunkSize(chunk)), archetype->GetEntities(chunk),
+                         archetype->template GetColumn<Ts>(chunk)...);
+                }
+            }
+        }
+
+        // Blocs répartis sur le JobSystem : func ne doit écrire que dans les composants de son entité.
+        // Une seule itération parallèle à la fois par Query (liste de blocs partagée)
+        template<typename Func>
+        void ParallelEach(Func &&func, const Size chunksPerJob = 1) const {
+            ParallelEachChunk([&func](const Size count, const EntityId *entities, Ts *... columns) {
+                for (Size row = 0; row < count; ++row)
+                    func(entities[row], columns[row]...);
+            }, chunksPerJob);
+        }
+
+        // func(Size count, const EntityId *entities, Ts *...), un appel par bloc
+        template<typename Func>
+        void ParallelEachChunk(Func &&func, const Size chunksPerJob = 1) const {
+            m_Chunks.clear();
+            for (Archetype *archetype: *m_Archetypes) {
+                for (Size chunk = 0; chunk < archetype->GetChunkCount(); ++chunk)
+                    m_Chunks.push_back({archetype, chunk});
+            }
+
+            JobSystem::Get().ParallelFor(m_Chunks.size(), [this, &func](const Size i) {
+                const Archetype &archetype = *m_Chunks[i].first;
+                const Size chunk = m_Chunks[i].second;
+                func(static_cast<Size>(archetype.GetChunkSize(chunk)), archetype.GetEntities(chunk),
+                     archetype.template GetColumn<Ts>(chunk)...);
+            }, chunksPerJob);
+        }
+
+        [[nodiscard]] Size Count() const {
+            Size count = 0;
+            for (const Archetype *archetype: *m_Archetypes)
+                count += archetype->GetEntityCount();
+            return count;
+        }
+
+    private:
+        const Vector<Archetype *> *m_Archetypes;
+        mutable Vector<Pair<Archetype *, Size> > m_Chunks;
+    };
+}
+
+#endif // ASHEN_QUERY_H
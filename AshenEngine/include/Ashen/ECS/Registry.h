@@ -0,0 +1,163 @@
+#ifndef ASHEN_REGISTRY_H
+#define ASHEN_REGISTRY_H
+
+#include <cassert>
+
+#include "Ashen/Core/Types.h"
+#include "Ashen/ECS/Archetype.h"
+#include "Ashen/ECS/Component.h"
+#include "Ashen/ECS/EntityId.h"
+
+namespace ash {
+    // Entités et composants rangés par archétype. Ajouter ou retirer un composant déplace l'entité
+    // vers l'archétype voisin (transition mise en cache après la première résolution).
+    // Pas de changement structurel (Create, Destroy, Add, Remove) pendant l'itération d'une Query.
+    class Registry {
+    public:
+        Registry() = default;
+
+        ~Registry();
+
+        Registry(const Registry &) = delete;
+
+        Registry &operator=(const Registry &) = delete;
+
+        EntityId Create() { return Allocate(GetArchetype(0)); }
+
+        template<typename... Ts>
+        EntityId Create(Ts &&... components);
+
+        void Destroy(EntityId entity);
+
+        [[nodiscard]] bool IsAlive(EntityId entity) const;
+
+        // Remplace le composant s'il est déjà présent
+        template<typename T, typename... Args>
+        T &Add(EntityId entity, Args &&... args);
+
+        template<typename T>
+        void Remove(EntityId entity);
+
+        template<typename T>
+        [[nodiscard]] bool Has(EntityId entity) const;
+
+        template<typename T>
+        [[nodiscard]] T &Get(EntityId entity) const;
+
+        // nullptr si l'entité est morte ou n'a pas le composant
+        template<typename T>
+        [[nodiscard]] T *TryGet(EntityId entity) const;
+
+        [[nodiscard]] ComponentMask GetMask(EntityId entity) const;
+
+        // Archétypes possédant include et rien de exclude. La liste est mise en cache et complétée
+        // à chaque nouvel archétype : la référence reste valide pendant toute la vie du Registry
+        const Vector<Archetype *> &Match(ComponentMask include, ComponentMask exclude = 0);
+
+        // Détruit toutes les entités ; les identifiants existants deviennent invalides
+        void Clear();
+
+        [[nodiscard]] Size GetEntityCount() const { return m_AliveCount; }
+        [[nodiscard]] Size GetArchetypeCount() const { return m_Archetypes.size(); }
+
+        // Blocs de composants partagés par les archétypes ; Trim rend la mémoire après un pic
+        [[nodiscard]] ChunkPool &GetChunkPool() { return m_ChunkPool; }
+        [[nodiscard]] const ChunkPool &GetChunkPool() const { return m_ChunkPool; }
+
+    private:
+        struct Record {
+            Archetype *archetype = nullptr;
+            EntityLocation location;
+            u32 generation = 0;
+        };
+
+        struct CachedMatch {
+            ComponentMask include;
+            ComponentMask exclude;
+            Vector<Archetype *> archetypes;
+        };
+
+        Vector<Record> m_Records; // Indicé par EntityId::index
+        Vector<u32> m_FreeIndices;
+        Size m_AliveCount = 0;
+
+        ChunkPool m_ChunkPool; // Avant les archétypes : détruit après eux
+        Vector<Own<Archetype> > m_Archetypes;
+        FlatHashMap<ComponentMask, Archetype *> m_ArchetypeByMask;
+        Vector<Own<CachedMatch> > m_Matches;
+
+        Archetype *GetArchetype(ComponentMask mask);
+
+        EntityId Allocate(Archetype *archetype);
+
+        [[nodiscard]] const Record &GetRecord(EntityId entity) const;
+
+        [[nodiscard]] void *GetComponent(EntityId entity, ComponentId id) const;
+
+        // Composants communs déplacés, ceux absents de to détruits, ceux propres à to à construire
+        void Move(EntityId entity, Archetype *to);
+    };
+
+    template<typename... Ts>
+    EntityId Registry::Create(Ts &&... components) {
+        const EntityId entity = Allocate(GetArchetype(MaskOf<std::decay_t<Ts>...>()));
+        (new(GetComponent(entity, ComponentRegistry::Id<Ts>())) std::decay_t<Ts>(std::forward<Ts>(components)), ...);
+        return entity;
+    }
+
+    template<typename T, typename... Args>
+    T &Registry::Add(const EntityId entity, Args &&... args) {
+        const ComponentId id = ComponentRegistry::Id<T>();
+        Archetype *from = GetRecord(entity).archetype;
+
+        if (from->Has(id)) {
+            T &component = *static_cast<T *>(GetComponent(entity, id));
+            component = T(std::forward<Args>(args)...);
+            return component;
+        }
+
+        Archetype *to = from->GetAddEdge(id);
+        if (!to) {
+            to = GetArchetype(from->GetMask() | ComponentMask(1) << id);
+            from->SetAddEdge(id, to);
+        }
+
+        Move(entity, to);
+        return *new(GetComponent(entity, id)) T(std::forward<Args>(args)...);
+    }
+
+    template<typename T>
+    void Registry::Remove(const EntityId entity) {
+        const ComponentId id = ComponentRegistry::Id<T>();
+        Archetype *from = GetRecord(entity).archetype;
+        if (!from->Has(id)) return;
+
+        Archetype *to = from->GetRemoveEdge(id);
+        if (!to) {
+            to = GetArchetype(from->GetMask() & ~(ComponentMask(1) << id));
+            from->SetRemoveEdge(id, to);
+        }
+
+        Move(entity, to);
+    }
+
+    template<typename T>
+    bool Registry::Has(const EntityId entity) const {
+        return IsAlive(entity) && GetRecord(entity).archetype->Has(ComponentRegistry::Id<T>());
+    }
+
+    template<typename T>
+    T &Registry::Get(const EntityId entity) const {
+        const ComponentId id = ComponentRegistry::Id<T>();
+        assert(GetRecord(entity).archetype->Has(id) && "Entity does not have this component");
+        return *static_cast<T *>(GetComponent(entity, id));
+    }
+
+    template<typename T>
+    T *Registry::TryGet(const EntityId entity) const {
+        if (!Has<T>(entity)) return nullptr;
+        return static_cast<T *>(GetComponent(entity, ComponentRegistry::Id<T>()));
+    }
+}
+
+#endif // ASHEN_REGISTRY_H
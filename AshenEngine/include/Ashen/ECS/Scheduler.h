@@ -0,0 +1,68 @@
+#ifndef ASHEN_SCHEDULER_H
+#define ASHEN_SCHEDULER_H
+
+#include "Ashen/Core/Types.h"
+#include "Ashen/ECS/Component.h"
+
+namespace ash {
+    // Composants lus et écrits par un système. exclusive : changements structurels ou état hors
+    // composants, le système s'exécute seul
+    struct SystemAccess {
+        ComponentMask reads = 0;
+        ComponentMask writes = 0;
+        bool exclusive = false;
+
+        // const T : lecture seule
+        template<typename... Ts>
+        static SystemAccess Of() {
+            return {
+                MaskOf<Ts...>(),
+                (ComponentMask(0) | ... | (std::is_const_v<Ts> ? ComponentMask(0) : ComponentRegistry::Bit<Ts>())),
+                false
+            };
+        }
+
+        static SystemAccess Exclusive() { return {0, 0, true}; }
+
+        [[nodiscard]] bool ConflictsWith(const SystemAccess &other) const {
+            return exclusive || other.exclusive || (writes & (other.reads | other.writes)) || (other.writes & reads);
+        }
+    };
+
+    // Systèmes exécutés par étapes : un système rejoint l'étape qui suit celle du dernier système
+    // ajouté avant lui avec lequel il est en conflit. Les systèmes d'une même étape tournent en
+    // parallèle sur le JobSystem ; deux systèmes en conflit gardent leur ordre d'ajout.
+    class Scheduler {
+    public:
+        using SystemFunc = Function<void(float)>;
+
+        void Add(String name, const SystemAccess &access, SystemFunc func);
+
+        void Run(float deltaTime);
+
+        void Clear();
+
+        [[nodiscard]] Size GetSystemCount() const { return m_Systems.size(); }
+        [[nodiscard]] Size GetStageCount() const { return m_Stages.size(); }
+
+        // Durée du dernier Run par système, dans l'ordre d'ajout
+        [[nodiscard]] double GetSystemMs(Size system) const { return m_Systems[system].lastMs; }
+        [[nodiscard]] const String &GetSystemName(Size system) const { return m_Systems[system].name; }
+
+    private:
+        struct System {
+            String name;
+            SystemAccess access;
+            SystemFunc func;
+            u32 stage = 0;
+            double lastMs = 0.0;
+        };
+
+        Vector<System> m_Systems;
+        Vector<Vector<u32> > m_Stages;
+
+        void RunSystem(System &system, float deltaTime);
+    };
+}
+
+#endif // ASHEN_SCHEDULER_H
@@ -1,12 +1,30 @@
 #ifndef ASHEN_FRUSTUM_H
 #define ASHEN_FRUSTUM_H
 
+#include <span>
+
+#include "Ashen/Core/Types.h"
 #include "Ashen/Math/Math.h"
 
 namespace ash {
+    // Boîtes englobantes en structure de tableaux : le test par lot parcourt chaque
+    // coordonnée de façon contiguë, ce que le compilateur vectorise
+    struct AABBBatch {
+        Vector<float> minX, minY, minZ;
+        Vector<float> maxX, maxY, maxZ;
+
+        void Add(const Vec3 &min, const Vec3 &max);
+
+        void Clear();
+
+        Size Count() const { return minX.size(); }
+    };
+
     struct Frustum {
         enum Plane { Left = 0, Right, Bottom, Top, Near, Far, Count };
 
+        enum class Intersection { Outside, Intersects, Inside };
+
         Vec4 planes[6];
 
         void ExtractFromViewProjection(const Mat4 &vp);
@@ -16,6 +34,12 @@ namespace ash {
         bool IntersectsSphere(const Vec3 &center, float radius) const;
 
         bool IntersectsAABB(const Vec3 &min, const Vec3 &max) const;
+
+        // Distingue les boîtes entièrement à l'intérieur, dont le contenu n'a plus besoin d'être testé
+        Intersection ClassifyAABB(const Vec3 &min, const Vec3 &max) const;
+
+        // results[i] = IntersectsAABB(boîte i), results doit contenir boxes.Count() éléments
+        void IntersectsAABBs(const AABBBatch &boxes, std::span<u8> results) const;
     };
 }
 
@@ -6,6 +6,7 @@
 namespace ash {
     class VertexArray;
     class IndexBuffer;
+    class IndirectBuffer;
     class ShaderProgram;
     class Camera;
 
@@ -43,8 +44,15 @@ namespace ash {
 
         static void DrawInstanced(const VertexArray &vao, uint32_t instanceCount);
 
+        // Sans index, nombre de sommets explicite (sommets générés dans le shader par exemple)
+        static void DrawArraysInstanced(const VertexArray &vao, uint32_t vertexCount, uint32_t instanceCount);
+
         static void DrawIndexedInstanced(const VertexArray &vao, uint32_t indexCount, uint32_t instanceCount, uint32_t indexOffset = 0);
 
+        // Toutes les commandes du buffer en un seul appel ; instanceCount sert uniquement aux statistiques
+        static void MultiDrawIndirect(const VertexArray &vao, const IndirectBuffer &commands, uint32_t vertexCount,
+                                      uint32_t instanceCount);
+
         static const Statistics &GetStats() { return s_Stats; }
         static void ResetStats() { s_Stats.Reset(); }
 
@@ -1,6 +1,8 @@
 #ifndef ASHEN_BUFFER_H
 #define ASHEN_BUFFER_H
 
+#include <cassert>
+
 #include <glad/glad.h>
 
 #include "Ashen/Core/Types.h"
@@ -97,6 +99,15 @@ namespace ash {
             glUnmapBuffer(static_cast<GLenum>(m_Target));
         }
 
+        // Copie GPU à GPU depuis un autre buffer (les plages ne doivent pas se chevaucher si source == this)
+        void CopyFrom(const Buffer &source, const size_t readOffset, const size_t writeOffset, const size_t size) const {
+            assert(readOffset + size <= source.m_Size && writeOffset + size <= m_Size && "Buffer overflow in CopyFrom!");
+            glBindBuffer(GL_COPY_READ_BUFFER, source.m_ID);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, m_ID);
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(readOffset),
+                                static_cast<GLintptr>(writeOffset), static_cast<GLsizeiptr>(size));
+        }
+
     protected:
         BufferTarget m_Target;
         size_t m_Size = 0;
@@ -310,6 +321,39 @@ namespace ash {
         }
     };
 
+    // Disposition imposée par glMultiDrawArraysIndirect
+    struct DrawArraysIndirectCommand {
+        uint32_t count = 0;
+        uint32_t instanceCount = 0;
+        uint32_t first = 0;
+        uint32_t baseInstance = 0;
+    };
+
+    class IndirectBuffer final : public Buffer {
+    public:
+        explicit IndirectBuffer(const BufferConfig &config = BufferConfig::Stream())
+            : Buffer(BufferTarget::DrawIndirect, config) {
+        }
+
+        // Réalloue seulement si les commandes ne tiennent pas dans le buffer actuel
+        void SetCommands(const Span<const DrawArraysIndirectCommand> &commands) {
+            if (commands.size_bytes() > m_Size)
+                UploadData(commands);
+            else if (!commands.empty())
+                UpdateData(commands);
+            m_Count = commands.size();
+        }
+
+        [[nodiscard]] size_t GetCount() const { return m_Count; }
+
+        static Ref<IndirectBuffer> Create(const BufferConfig &config = BufferConfig::Stream()) {
+            return MakeRef<IndirectBuffer>(config);
+        }
+
+    private:
+        size_t m_Count = 0;
+    };
+
     class ShaderStorageBuffer final : public Buffer {
     public:
         explicit ShaderStorageBuffer(const BufferConfig &config = BufferConfig::Dynamic())
@@ -81,6 +81,7 @@ namespace ash {
         void DrawArraysInstanced(PrimitiveType mode, int first, int count, int instanceCount) override;
         void DrawElementsInstanced(PrimitiveType mode, int count, IndexType type,
                                   const void* indices, int instanceCount) override;
+        void MultiDrawArraysIndirect(PrimitiveType mode, const void* indirect, int drawCount, int stride) override;
 
         // === State Queries ===
         [[nodiscard]] bool IsDepthTestEnabled() const override { return m_DepthEnabled; }
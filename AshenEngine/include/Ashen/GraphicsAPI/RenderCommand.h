@@ -72,6 +72,7 @@ namespace ash {
         static void DrawElements(PrimitiveType mode, int count, IndexType type, const void* indices);
         static void DrawArraysInstanced(PrimitiveType mode, int first, int count, int instanceCount);
         static void DrawElementsInstanced(PrimitiveType mode, int count, IndexType type, const void* indices, int instanceCount);
+        static void MultiDrawArraysIndirect(PrimitiveType mode, const void* indirect, int drawCount, int stride = 0);
 
         // === Draw Commands (High Level - Abstraits) ===
         /**
@@ -85,6 +85,8 @@ namespace ash {
         virtual void DrawElements(PrimitiveType mode, int count, IndexType type, const void* indices) = 0;
         virtual void DrawArraysInstanced(PrimitiveType mode, int first, int count, int instanceCount) = 0;
         virtual void DrawElementsInstanced(PrimitiveType mode, int count, IndexType type, const void* indices, int instanceCount) = 0;
+        // indirect : offset dans le GL_DRAW_INDIRECT_BUFFER lié ; stride 0 = commandes contiguës
+        virtual void MultiDrawArraysIndirect(PrimitiveType mode, const void* indirect, int drawCount, int stride) = 0;
 
         // === Draw Commands with VertexArray ===
         virtual void DrawVertexArray(const Ref<VertexArray>& vertexArray);
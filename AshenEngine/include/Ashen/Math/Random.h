@@ -53,6 +53,34 @@ namespace ash {
             return engine;
         }
     };
+
+    // Générateur xorshift32 : quelques cycles par tirage, état de 4 octets.
+    // Pour les tirages massifs (ticks aléatoires...), sans qualité statistique forte.
+    class FastRandom {
+    public:
+        explicit FastRandom(const u64 seed = 0x9E3779B97F4A7C15ull)
+            : m_State(static_cast<u32>(MixHash(seed)) | 1u) {
+        }
+
+        u32 Next() {
+            m_State ^= m_State << 13;
+            m_State ^= m_State >> 17;
+            m_State ^= m_State << 5;
+            return m_State;
+        }
+
+        // Entier dans [0, bound) par multiplication (sans modulo)
+        u32 NextBelow(const u32 bound) {
+            return static_cast<u32>(static_cast<u64>(Next()) * bound >> 32);
+        }
+
+        float NextFloat() {
+            return static_cast<float>(Next() >> 8) * (1.0f / 16777216.0f);
+        }
+
+    private:
+        u32 m_State;
+    };
 }
 
 #endif // ASHEN_RANDOM_H
\ No newline at end of file
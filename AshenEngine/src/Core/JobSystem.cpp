@@ -0,0 +1,102 @@
+#include "Ashen/Core/JobSystem.h"
+
+#include <algorithm>
+
+namespace ash {
+    JobSystem::JobSystem(u32 threadCount) {
+        if (threadCount == 0) {
+            const u32 cores = std::thread::hardware_concurrency();
+            threadCount = cores > 1 ? cores - 1 : 1;
+        }
+
+        m_Threads.reserve(threadCount);
+        for (u32 i = 0; i < threadCount; ++i)
+            m_Threads.emplace_back(&JobSystem::WorkerLoop, this);
+    }
+
+    JobSystem::~JobSystem() { {
+            std::lock_guard lock(m_Mutex);
+            m_Running = false;
+        }
+        m_CV.notify_all();
+
+        for (auto &thread: m_Threads) {
+            if (thread.joinable()) thread.join();
+        }
+    }
+
+    void JobSystem::ParallelFor(const Size count, const Function<void(Size)> &func, Size batchSize) {
+        if (count == 0) return;
+        batchSize = std::max<Size>(batchSize, 1);
+
+        const Size batchCount = (count + batchSize - 1) / batchSize;
+        if (batchCount == 1 || m_Threads.empty()) {
+            for (Size i = 0; i < count; ++i) func(i);
+            return;
+        }
+
+        // État partagé : les aides lancées après la fin du travail ressortent immédiatement
+        struct State {
+            std::atomic<Size> next{0};
+            std::atomic<Size> remaining{0};
+            std::mutex mutex;
+            std::condition_variable done;
+        };
+
+        const auto state = MakeRef<State>();
+        state->remaining = batchCount;
+
+        auto work = [state, &func, count, batchSize] {
+            Size begin;
+            while ((begin = state->next.fetch_add(batchSize)) < count) {
+                const Size end = std::min(begin + batchSize, count);
+                for (Size i = begin; i < end; ++i) func(i);
+
+                if (state->remaining.fetch_sub(1) == 1) {
+                    std::lock_guard lock(state->mutex);
+                    state->done.notify_all();
+                }
+            }
+        };
+
+        const Size helpers = std::min(batchCount - 1, m_Threads.size()); {
+            std::lock_guard lock(m_Mutex);
+            for (Size i = 0; i < helpers; ++i)
+                m_Jobs.emplace_back(work);
+        }
+        m_CV.notify_all();
+
+        work();
+
+        std::unique_lock lock(state->mutex);
+        state->done.wait(lock, [&state] { return state->remaining.load() == 0; });
+    }
+
+    void JobSystem::Submit(Function<void()> job) { {
+            std::lock_guard lock(m_Mutex);
+            m_Jobs.push_back(std::move(job));
+        }
+        m_CV.notify_one();
+    }
+
+    JobSystem &JobSystem::Get() {
+        static JobSystem instance;
+        return instance;
+    }
+
+    void JobSystem::WorkerLoop() {
+        while (true) {
+            Function<void()> job; {
+                std::unique_lock lock(m_Mutex);
+                m_CV.wait(lock, [this] { return !m_Jobs.empty() || !m_Running; });
+
+                if (!m_Running && m_Jobs.empty()) return;
+
+                job = std::move(m_Jobs.front());
+                m_Jobs.pop_front();
+            }
+
+            job();
+        }
+    }
+}
@@ -0,0 +1,113 @@
+#include "Ashen/ECS/Archetype.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace ash {
+    ChunkPool::~ChunkPool() {
+        Trim();
+        assert(m_Allocated == 0 && "Chunks still in use by an archetype");
+    }
+
+    byte *ChunkPool::Acquire() {
+        if (!m_Free.empty()) {
+            byte *data = m_Free.back();
+            m_Free.pop_back();
+            return data;
+        }
+
+        ++m_Allocated;
+        return static_cast<byte *>(::operator new(Archetype::CHUNK_BYTES, std::align_val_t{Archetype::CHUNK_ALIGNMENT}));
+    }
+
+    void ChunkPool::Release(byte *data) {
+        m_Free.push_back(data);
+    }
+
+    void ChunkPool::Trim() {
+        for (byte *data: m_Free)
+            ::operator delete(data, std::align_val_t{Archetype::CHUNK_ALIGNMENT});
+        m_Allocated -= m_Free.size();
+        m_Free.clear();
+    }
+
+    Archetype::Archetype(const ComponentMask mask, ChunkPool &pool)
+        : m_Mask(mask), m_Pool(pool) {
+        Size rowBytes = sizeof(EntityId);
+        ForEachComponent(mask, [this, &rowBytes](const ComponentId id) {
+            const ComponentInfo &info = ComponentRegistry::Info(id);
+            assert(info.alignment <= CHUNK_ALIGNMENT && "Component alignment exceeds chunk alignment");
+
+            m_Components.push_back(id);
+            m_Sizes[id] = static_cast<u32>(info.size);
+            rowBytes += info.size;
+        });
+
+        // Estimation sans les marges d'alignement, puis ajustement
+        u32 capacity = std::max<u32>(static_cast<u32>(CHUNK_BYTES / rowBytes), 1);
+        while (!ComputeLayout(capacity)) {
+            assert(capacity > 1 && "Components too large for one chunk");
+            --capacity;
+        }
+        m_Capacity = capacity;
+    }
+
+    Archetype::~Archetype() {
+        for (u32 chunk = 0; chunk < m_Chunks.size(); ++chunk) {
+            for (u32 row = 0; row < m_Chunks[chunk].count; ++row)
+                DestroyRow({chunk, row});
+            m_Pool.Release(m_Chunks[chunk].data);
+        }
+    }
+
+    bool Archetype::ComputeLayout(const u32 capacity) {
+        Size offset = sizeof(EntityId) * capacity;
+        for (const ComponentId id: m_Components) {
+            const Size alignment = ComponentRegistry::Info(id).alignment;
+            offset = (offset + alignment - 1) / alignment * alignment;
+            m_Offsets[id] = static_cast<u32>(offset);
+            offset += m_Sizes[id] * capacity;
+        }
+        return offset <= CHUNK_BYTES;
+    }
+
+    EntityLocation Archetype::Allocate(const EntityId entity) {
+        if (m_Chunks.empty() || m_Chunks.back().count == m_Capacity) {
+            Chunk chunk;
+            chunk.data = m_Pool.Acquire();
+            m_Chunks.push_back(chunk);
+        }
+
+        const u32 chunk = static_cast<u32>(m_Chunks.size() - 1);
+        const u32 row = m_Chunks[chunk].count++;
+        GetEntities(chunk)[row] = entity;
+        ++m_EntityCount;
+        return {chunk, row};
+    }
+
+    EntityId Archetype::Erase(const EntityLocation &location) {
+        const u32 lastChunk = static_cast<u32>(m_Chunks.size() - 1);
+        const EntityLocation last{lastChunk, m_Chunks[lastChunk].count - 1};
+
+        EntityId moved = NULL_ENTITY;
+        if (location.chunk != last.chunk || location.row != last.row) {
+            for (const ComponentId id: m_Components)
+                ComponentRegistry::Info(id).relocate(GetComponent(location, id), GetComponent(last, id));
+
+            moved = GetEntities(last.chunk)[last.row];
+            GetEntities(location.chunk)[location.row] = moved;
+        }
+
+        --m_EntityCount;
+        if (--m_Chunks[lastChunk].count == 0) {
+            m_Pool.Release(m_Chunks[lastChunk].data);
+            m_Chunks.pop_back();
+        }
+        return moved;
+    }
+
+    void Archetype::DestroyRow(const EntityLocation &location) {
+        for (const ComponentId id: m_Components)
+            ComponentRegistry::Info(id).destroy(GetComponent(location, id));
+    }
+}
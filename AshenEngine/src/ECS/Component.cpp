@@ -0,0 +1,37 @@
+#include "Ashen/ECS/Component.h"
+
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+namespace ash {
+    namespace {
+        // Tableau fixe : les références rendues par Info restent valides pendant les enregistrements
+        struct ComponentTable {
+            std::mutex mutex;
+            Array<ComponentInfo, MAX_COMPONENTS> infos;
+            Size count = 0;
+        };
+
+        ComponentTable &GetTable() {
+            static ComponentTable table;
+            return table;
+        }
+    }
+
+    const ComponentInfo &ComponentRegistry::Info(const ComponentId id) {
+        return GetTable().infos[id];
+    }
+
+    ComponentId ComponentRegistry::Register(const ComponentInfo &info) {
+        ComponentTable &table = GetTable();
+        std::lock_guard lock(table.mutex);
+
+        // Vérifié dans toutes les configurations : au-delà, les masques déborderaient en silence
+        if (table.count >= MAX_COMPONENTS)
+            throw std::length_error("ComponentRegistry: more than " + std::to_string(MAX_COMPONENTS) +
+                                    " component types");
+        table.infos[table.count] = info;
+        return static_cast<ComponentId>(table.count++);
+    }
+}
@@ -0,0 +1,128 @@
+#include "Ashen/ECS/Registry.h"
+
+namespace ash {
+    Registry::~Registry() = default;
+
+    void Registry::Destroy(const EntityId entity) {
+        if (!IsAlive(entity)) return;
+
+        Record &record = m_Records[entity.index];
+        record.archetype->DestroyRow(record.location);
+
+        const EntityId moved = record.archetype->Erase(record.location);
+        if (!moved.IsNull()) m_Records[moved.index].location = record.location;
+
+        record.archetype = nullptr;
+        ++record.generation;
+        m_FreeIndices.push_back(entity.index);
+        --m_AliveCount;
+    }
+
+    bool Registry::IsAlive(const EntityId entity) const {
+        return entity.index < m_Records.size() && m_Records[entity.index].archetype &&
+               m_Records[entity.index].generation == entity.generation;
+    }
+
+    ComponentMask Registry::GetMask(const EntityId entity) const {
+        return IsAlive(entity) ? GetRecord(entity).archetype->GetMask() : 0;
+    }
+
+    const Vector<Archetype *> &Registry::Match(const ComponentMask include, const ComponentMask exclude) {
+        for (const auto &match: m_Matches) {
+            if (match->include == include && match->exclude == exclude) return match->archetypes;
+        }
+
+        auto match = MakeOwn<CachedMatch>();
+        match->include = include;
+        match->exclude = exclude;
+        for (const auto &archetype: m_Archetypes) {
+            const ComponentMask mask = archetype->GetMask();
+            if ((mask & include) == include && !(mask & exclude)) match->archetypes.push_back(archetype.get());
+        }
+
+        m_Matches.push_back(std::move(match));
+        return m_Matches.back()->archetypes;
+    }
+
+    void Registry::Clear() {
+        // Générations conservées : un ancien identifiant ne redevient jamais valide
+        m_FreeIndices.clear();
+        for (u32 index = 0; index < m_Records.size(); ++index) {
+            Record &record = m_Records[index];
+            if (record.archetype) {
+                record.archetype = nullptr;
+                ++record.generation;
+            }
+            m_FreeIndices.push_back(index);
+        }
+        m_AliveCount = 0;
+
+        for (const auto &match: m_Matches)
+            match->archetypes.clear();
+        // Blocs rendus au pool : les entités créées ensuite les réutilisent
+        m_ArchetypeByMask.clear();
+        m_Archetypes.clear();
+    }
+
+    Archetype *Registry::GetArchetype(const ComponentMask mask) {
+        if (const auto it = m_ArchetypeByMask.find(mask); it != m_ArchetypeByMask.end())
+            return it->second;
+
+        m_Archetypes.push_back(MakeOwn<Archetype>(mask, m_ChunkPool));
+        Archetype *archetype = m_Archetypes.back().get();
+        m_ArchetypeByMask.emplace(mask, archetype);
+
+        for (const auto &match: m_Matches) {
+            if ((mask & match->include) == match->include && !(mask & match->exclude))
+                match->archetypes.push_back(archetype);
+        }
+        return archetype;
+    }
+
+    EntityId Registry::Allocate(Archetype *archetype) {
+        u32 index;
+        if (!m_FreeIndices.empty()) {
+            index = m_FreeIndices.back();
+            m_FreeIndices.pop_back();
+        } else {
+            index = static_cast<u32>(m_Records.size());
+            m_Records.emplace_back();
+        }
+
+        Record &record = m_Records[index];
+        const EntityId entity{index, record.generation};
+        record.archetype = archetype;
+        record.location = archetype->Allocate(entity);
+        ++m_AliveCount;
+        return entity;
+    }
+
+    const Registry::Record &Registry::GetRecord(const EntityId entity) const {
+        assert(IsAlive(entity) && "Stale or null entity");
+        return m_Records[entity.index];
+    }
+
+    void *Registry::GetComponent(const EntityId entity, const ComponentId id) const {
+        const Record &record = GetRecord(entity);
+        return record.archetype->GetComponent(record.location, id);
+    }
+
+    void Registry::Move(const EntityId entity, Archetype *to) {
+        Record &record = m_Records[entity.index];
+        Archetype *from = record.archetype;
+        const EntityLocation source = record.location;
+        const EntityLocation target = to->Allocate(entity);
+
+        for (const ComponentId id: from->GetComponents()) {
+            const ComponentInfo &info = ComponentRegistry::Info(id);
+            if (to->Has(id)) info.relocate(to->GetComponent(target, id), from->GetComponent(source, id));
+            else info.destroy(from->GetComponent(source, id));
+        }
+
+        const EntityId moved = from->Erase(source);
+        if (!moved.IsNull()) m_Records[moved.index].location = source;
+
+        record.archetype = to;
+        record.location = target;
+    }
+}
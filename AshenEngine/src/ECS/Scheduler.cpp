@@ -0,0 +1,43 @@
+#include "Ashen/ECS/Scheduler.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "Ashen/Core/JobSystem.h"
+
+namespace ash {
+    void Scheduler::Add(String name, const SystemAccess &access, SystemFunc func) {
+        u32 stage = 0;
+        for (const System &other: m_Systems) {
+            if (access.ConflictsWith(other.access)) stage = std::max(stage, other.stage + 1);
+        }
+
+        if (stage >= m_Stages.size()) m_Stages.resize(stage + 1);
+        m_Stages[stage].push_back(static_cast<u32>(m_Systems.size()));
+        m_Systems.push_back({std::move(name), access, std::move(func), stage});
+    }
+
+    void Scheduler::Run(const float deltaTime) {
+        for (const auto &stage: m_Stages) {
+            if (stage.size() == 1) {
+                RunSystem(m_Systems[stage.front()], deltaTime);
+                continue;
+            }
+
+            JobSystem::Get().ParallelFor(stage.size(), [this, &stage, deltaTime](const Size i) {
+                RunSystem(m_Systems[stage[i]], deltaTime);
+            });
+        }
+    }
+
+    void Scheduler::Clear() {
+        m_Systems.clear();
+        m_Stages.clear();
+    }
+
+    void Scheduler::RunSystem(System &system, const float deltaTime) {
+        const auto start = std::chrono::steady_clock::now();
+        system.func(deltaTime);
+        system.lastMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
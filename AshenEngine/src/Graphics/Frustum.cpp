@@ -3,6 +3,24 @@
 #include <algorithm>
 
 namespace ash {
+    void AABBBatch::Add(const Vec3 &min, const Vec3 &max) {
+        minX.push_back(min.x);
+        minY.push_back(min.y);
+        minZ.push_back(min.z);
+        maxX.push_back(max.x);
+        maxY.push_back(max.y);
+        maxZ.push_back(max.z);
+    }
+
+    void AABBBatch::Clear() {
+        minX.clear();
+        minY.clear();
+        minZ.clear();
+        maxX.clear();
+        maxY.clear();
+        maxZ.clear();
+    }
+
     void Frustum::ExtractFromViewProjection(const Mat4 &vp) {
         const float *m = glm::value_ptr(vp);
 
@@ -42,4 +60,37 @@ namespace ash {
             return glm::dot(Vec3(plane), positive) + plane.w >= 0.0f;
         });
     }
+
+    Frustum::Intersection Frustum::ClassifyAABB(const Vec3 &min, const Vec3 &max) const {
+        Intersection result = Intersection::Inside;
+        for (const Vec4 &plane: planes) {
+            // Coin le plus avancé dans le sens de la normale, puis le plus en retrait
+            const Vec3 positive(plane.x > 0 ? max.x : min.x, plane.y > 0 ? max.y : min.y,
+                                plane.z > 0 ? max.z : min.z);
+            const Vec3 negative(plane.x > 0 ? min.x : max.x, plane.y > 0 ? min.y : max.y,
+                                plane.z > 0 ? min.z : max.z);
+
+            if (glm::dot(Vec3(plane), positive) + plane.w < 0.0f) return Intersection::Outside;
+            if (glm::dot(Vec3(plane), negative) + plane.w < 0.0f) result = Intersection::Intersects;
+        }
+        return result;
+    }
+
+    void Frustum::IntersectsAABBs(const AABBBatch &boxes, const std::span<u8> results) const {
+        const Size count = boxes.Count();
+        std::fill_n(results.begin(), count, u8{1});
+
+        // Le coin à tester ne dépend que du signe de la normale : choisi une fois par plan,
+        // la boucle interne n'a plus de branche
+        for (const Vec4 &plane: planes) {
+            const float *xs = plane.x > 0 ? boxes.maxX.data() : boxes.minX.data();
+            const float *ys = plane.y > 0 ? boxes.maxY.data() : boxes.minY.data();
+            const float *zs = plane.z > 0 ? boxes.maxZ.data() : boxes.minZ.data();
+
+            for (Size i = 0; i < count; ++i) {
+                const float distance = plane.x * xs[i] + plane.y * ys[i] + plane.z * zs[i] + plane.w;
+                results[i] &= static_cast<u8>(distance >= 0.0f);
+            }
+        }
+    }
 }
@@ -5,6 +5,7 @@
 #include "Ashen/Core/Logger.h"
 #include "Ashen/Graphics/Rendering/Renderer2D.h"
 #include "Ashen/Graphics/Rendering/Renderer3D.h"
+#include "Ashen/GraphicsAPI/Buffer.h"
 #include "Ashen/GraphicsAPI/RenderCommand.h"
 #include "Ashen/GraphicsAPI/VertexArray.h"
 
@@ -90,6 +91,16 @@ namespace ash {
         }
     }
 
+    void Renderer::DrawArraysInstanced(const VertexArray &vao, const uint32_t vertexCount, const uint32_t instanceCount) {
+        vao.Bind();
+        RenderCommand::DrawArraysInstanced(PrimitiveType::Triangles, 0, static_cast<int>(vertexCount),
+                                           static_cast<int>(instanceCount));
+
+        s_Stats.DrawCalls++;
+        s_Stats.Vertices += vertexCount * instanceCount;
+        s_Stats.Triangles += vertexCount / 3 * instanceCount;
+    }
+
     void Renderer::DrawIndexedInstanced(const VertexArray &vao, const uint32_t indexCount, const uint32_t instanceCount,
                                         const uint32_t indexOffset) {
         vao.Bind();
@@ -102,4 +113,17 @@ namespace ash {
         s_Stats.Indices += indexCount * instanceCount;
         s_Stats.Triangles += indexCount / 3 * instanceCount;
     }
+
+    void Renderer::MultiDrawIndirect(const VertexArray &vao, const IndirectBuffer &commands, const uint32_t vertexCount,
+                                     const uint32_t instanceCount) {
+        if (commands.GetCount() == 0) return;
+
+        vao.Bind();
+        commands.Bind();
+        RenderCommand::MultiDrawArraysIndirect(PrimitiveType::Triangles, nullptr, static_cast<int>(commands.GetCount()));
+
+        s_Stats.DrawCalls++;
+        s_Stats.Vertices += vertexCount * instanceCount;
+        s_Stats.Triangles += vertexCount / 3 * instanceCount;
+    }
 }
@@ -293,4 +293,8 @@ namespace ash {
         glDrawElementsInstanced(static_cast<GLenum>(mode), count, static_cast<GLenum>(type), indices, instanceCount);
     }
 
+    void OpenGLRendererAPI::MultiDrawArraysIndirect(PrimitiveType mode, const void* indirect, const int drawCount, const int stride) {
+        glMultiDrawArraysIndirect(static_cast<GLenum>(mode), indirect, drawCount, stride);
+    }
+
 }
\ No newline at end of file
@@ -205,6 +205,10 @@ namespace ash {
         s_API->DrawElementsInstanced(mode, count, type, indices, instanceCount);
     }
 
+    void RenderCommand::MultiDrawArraysIndirect(const PrimitiveType mode, const void* indirect, const int drawCount, const int stride) {
+        s_API->MultiDrawArraysIndirect(mode, indirect, drawCount, stride);
+    }
+
     // === Draw Commands (High Level) ===
 
     void RenderCommand::Submit(const Ref<VertexArray>& vertexArray) {
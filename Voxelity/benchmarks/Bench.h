@@ -0,0 +1,50 @@
+#ifndef VOXELITY_BENCH_H
+#define VOXELITY_BENCH_H
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "Voxelity/voxelWorld/generation/ITerrainGenerator.h"
+#include "Voxelity/voxelWorld/world/World.h"
+
+// Outils des benchmarks : chronométrage et attente des threads du monde.
+// Les résultats sont affichés, jamais vérifiés : une mesure dépend de la machine
+namespace voxelity::bench {
+    using Clock = std::chrono::steady_clock;
+
+    inline double elapsedMs(const Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    struct Timing {
+        double bestMs = 0.0;
+        double averageMs = 0.0;
+    };
+
+    // runs appels de func, meilleure et moyenne des durées
+    template<typename Func>
+    Timing measure(const int runs, Func &&func) {
+        Timing timing{1e30, 0.0};
+        for (int run = 0; run < runs; ++run) {
+            const auto start = Clock::now();
+            func();
+            const double ms = elapsedMs(start);
+            timing.bestMs = std::min(timing.bestMs, ms);
+            timing.averageMs += ms;
+        }
+        timing.averageMs /= runs;
+        return timing;
+    }
+
+    // Les modifications de la scène réveillent les threads de mesh et de lumière :
+    // on les laisse finir pour qu'ils ne partagent pas le processeur avec la mesure.
+    // Les files ne comptent pas la tâche en cours, d'où l'attente finale
+    inline void waitForWorkers(const World &world) {
+        while (world.getPendingMeshCount() > 0 || world.getPendingLightCount() > 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+}
+
+#endif //VOXELITY_BENCH_H
@@ -0,0 +1,48 @@
+#include <iostream>
+
+#include "Bench.h"
+#include "../tests/ReferenceColumn.h"
+#include "Voxelity/voxelWorld/generation/NaturalTerrainGenerator.h"
+
+using namespace voxelity;
+
+namespace {
+    constexpr int SIDE = 16; // Colonnes de chunks par côté
+
+    // Toutes les colonnes de chunks de la zone, une à une, comme les construit le ColumnCache
+    template<typename Build>
+    void buildArea(Build &&build) {
+        ColumnData column;
+        for (int cz = 0; cz < SIDE; ++cz) {
+            for (int cx = 0; cx < SIDE; ++cx) {
+                column.coord = {cx, cz};
+                build(column);
+            }
+        }
+    }
+}
+
+// 16 × 16 colonnes de chunks (262 144 colonnes de voxels) : hauteur et biome par colonne.
+// Avant : calcul exact en double, climat échantillonné sur chaque colonne, biome par cascade de tests
+// (test::ReferenceColumnBuilder). Après : climat interpolé sur une grille de 8 blocs, table de biomes, float (buildColumn)
+int main() {
+    constexpr int RUNS = 5;
+    constexpr double COLUMNS = static_cast<double>(SIDE) * SIDE * ColumnData::AREA;
+
+    NaturalTerrainGenerator generator(12345);
+    test::ReferenceColumnBuilder referenceBuilder;
+    const bench::Timing before = bench::measure(RUNS, [&] {
+        buildArea([&](ColumnData &column) { referenceBuilder.build(column); });
+    });
+    const bench::Timing after = bench::measure(RUNS, [&] {
+        buildArea([&](ColumnData &column) { generator.buildColumn(column); });
+    });
+
+    std::cout << "Biome classification: " << SIDE * SIDE << " chunk columns, best of " << RUNS << " runs\n"
+            << "  before (per-column reference): " << before.bestMs << " ms, "
+            << COLUMNS / before.bestMs / 1000.0 << " M columns/s\n"
+            << "  after (climate grid + table):  " << after.bestMs << " ms, "
+            << COLUMNS / after.bestMs / 1000.0 << " M columns/s\n"
+            << "  speedup " << before.bestMs / after.bestMs << "x\n";
+    return 0;
+}
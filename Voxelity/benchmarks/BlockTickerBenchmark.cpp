@@ -0,0 +1,79 @@
+#include <iostream>
+
+#include "Bench.h"
+#include "Voxelity/voxelWorld/tick/BlockTicker.h"
+
+using namespace voxelity;
+
+// 10⁵ ticks programmés sur une couche de sable posée sur la pierre (10 × 10 chunks).
+// Le sable soutenu ne tombe pas : on mesure la file et le parcours parallèle, pas les écritures.
+// Puis la même couche sans support, où chaque tick écrit et fait apparaître un bloc en chute
+int main() {
+    constexpr int SIDE = 320; // 102 400 voxels de sable
+    constexpr int TICK_SPREAD = 20; // Échéances réparties sur une seconde à 20 TPS
+    constexpr double TICK_BUDGET_MS = 50.0;
+
+    World world(nullptr);
+    world.fillBox({{0, 0, 0}, {SIDE - 1, 0, SIDE - 1}}, VoxelID::STONE);
+    world.fillBox({{0, 1, 0}, {SIDE - 1, 1, SIDE - 1}}, VoxelID::SAND);
+    bench::waitForWorkers(world);
+
+    BlockTicker &ticker = world.getBlockTicker();
+    ticker.clear();
+
+    size_t spawned = 0;
+    ticker.setFallingBlockSpawner([&spawned](const glm::ivec3 &, VoxelType) { ++spawned; });
+
+    std::cout << "BlockTicker: " << SIDE * SIDE << " sand voxels over " << world.getLoadedChunkCount()
+            << " chunks, " << ticker.getRandomTickSpeed() << " random ticks per chunk\n";
+
+    // Toutes les échéances au même tick
+    auto start = bench::Clock::now();
+    for (int z = 0; z < SIDE; ++z) {
+        for (int x = 0; x < SIDE; ++x)
+            ticker.scheduleTick({x, 1, z}, 1);
+    }
+    const double scheduleMs = bench::elapsedMs(start);
+    const size_t pending = ticker.getPendingTickCount();
+
+    start = bench::Clock::now();
+    ticker.tick();
+    const double burstMs = bench::elapsedMs(start);
+
+    std::cout << "  schedule " << pending << " ticks: " << scheduleMs << " ms\n"
+            << "  one tick running all of them: " << burstMs << " ms (budget " << TICK_BUDGET_MS << " ms)\n";
+
+    // Échéances étalées : ~5k ticks par tick du monde
+    for (int z = 0; z < SIDE; ++z) {
+        for (int x = 0; x < SIDE; ++x)
+            ticker.scheduleTick({x, 1, z}, 1 + (x + z) % TICK_SPREAD);
+    }
+
+    double worstMs = 0.0;
+    double totalMs = 0.0;
+    for (int tick = 0; tick < TICK_SPREAD; ++tick) {
+        start = bench::Clock::now();
+        ticker.tick();
+        const double ms = bench::elapsedMs(start);
+        worstMs = std::max(worstMs, ms);
+        totalMs += ms;
+    }
+    std::cout << "  spread over " << TICK_SPREAD << " ticks: " << totalMs / TICK_SPREAD << " ms/tick, worst "
+            << worstMs << " ms, " << ticker.getPendingTickCount() << " left\n";
+
+    // Sans support : chaque tick retire le sable et demande un bloc en chute, écritures groupées par parité
+    world.fillBox({{0, 0, 0}, {SIDE - 1, 0, SIDE - 1}}, VoxelID::AIR);
+    bench::waitForWorkers(world);
+
+    for (int z = 0; z < SIDE; ++z) {
+        for (int x = 0; x < SIDE; ++x)
+            ticker.scheduleTick({x, 1, z}, 1);
+    }
+
+    start = bench::Clock::now();
+    ticker.tick();
+    const double collapseMs = bench::elapsedMs(start);
+    std::cout << "  unsupported layer, one tick: " << collapseMs << " ms, " << spawned
+            << " falling blocks requested\n";
+    return 0;
+}
@@ -0,0 +1,57 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include "Bench.h"
+#include "Voxelity/voxelWorld/render/ChunkDrawOrder.h"
+
+using namespace voxelity;
+
+namespace {
+    int ringOf(const ChunkCoord &coord, const ChunkCoord &center) {
+        return std::max({std::abs(coord.x - center.x), std::abs(coord.y - center.y), std::abs(coord.z - center.z)});
+    }
+}
+
+// 32 × 30 × 32 = 30 720 chunks ajoutés dans un ordre aléatoire, caméra au centre puis décalée.
+// Tri par comptage de ChunkDrawOrder contre std::stable_sort des indices sur l'anneau (même résultat).
+// Objectif : moins de 0,1 ms par tri
+int main() {
+    constexpr int RUNS = 200;
+    constexpr double TARGET_MS = 0.1;
+
+    ash::Vector<ChunkCoord> coords;
+    for (int y = -15; y < 15; ++y) {
+        for (int z = -16; z < 16; ++z) {
+            for (int x = -16; x < 16; ++x)
+                coords.emplace_back(x, y, z);
+        }
+    }
+    std::shuffle(coords.begin(), coords.end(), std::mt19937(1234));
+
+    ChunkDrawOrder drawOrder;
+    for (const auto &coord: coords)
+        drawOrder.add(coord);
+
+    ash::Vector<uint32_t> reference(coords.size());
+    for (const ChunkCoord center: {ChunkCoord(0, 0, 0), ChunkCoord(9, -4, 13)}) {
+        const bench::Timing counting = bench::measure(RUNS, [&] { drawOrder.sortFrontToBack(center); });
+        const bench::Timing comparison = bench::measure(RUNS, [&] {
+            for (uint32_t i = 0; i < reference.size(); ++i)
+                reference[i] = i;
+            std::ranges::stable_sort(reference, [&](const uint32_t a, const uint32_t b) {
+                return ringOf(coords[a], center) < ringOf(coords[b], center);
+            });
+        });
+
+        std::cout << "Chunk draw order: " << coords.size() << " chunks, camera at (" << center.x << ", "
+                << center.y << ", " << center.z << "), " << RUNS << " runs\n"
+                << "  counting sort:    best " << counting.bestMs << " ms, average " << counting.averageMs << " ms ("
+                << (counting.averageMs < TARGET_MS ? "under" : "over") << " the " << TARGET_MS << " ms target)\n"
+                << "  std::stable_sort: best " << comparison.bestMs << " ms, average " << comparison.averageMs
+                << " ms, speedup " << comparison.averageMs / counting.averageMs << "x\n";
+        if (drawOrder.getOrder() != reference) std::cout << "  orders differ\n";
+    }
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include <iostream>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "Bench.h"
+#include "Voxelity/voxelWorld/render/ChunkFrustumCuller.h"
+
+using namespace voxelity;
+
+// Les chunks d'une distance de rendu de 32 (65 × 65 colonnes de 8 chunks, ~34k coordonnées),
+// caméra au centre tournant sur elle-même. Le culler à deux niveaux contre un test
+// IntersectsAABB par chunk, comme le faisait le rendu auparavant
+int main() {
+    constexpr int RADIUS = 32;
+    constexpr int HEIGHT = 8;
+    constexpr int DIRECTIONS = 16;
+    constexpr int RUNS = 20;
+
+    ash::Vector<ChunkCoord> coords;
+    for (int x = -RADIUS; x <= RADIUS; ++x) {
+        for (int z = -RADIUS; z <= RADIUS; ++z) {
+            for (int y = 0; y < HEIGHT; ++y)
+                coords.push_back({x, y, z});
+        }
+    }
+
+    const float size = static_cast<float>(VoxelArray::SIZE);
+    const glm::vec3 eye(0.5f * size, 0.6f * HEIGHT * size, 0.5f * size);
+    const glm::mat4 projection = glm::perspective(glm::radians(70.0f), 16.0f / 9.0f, 0.1f,
+                                                  (RADIUS + 1) * size);
+
+    ChunkFrustumCuller culler;
+    ash::Vector<uint8_t> visible;
+    ash::Vector<uint8_t> reference(coords.size());
+
+    double cullerMs = 0.0;
+    double perChunkMs = 0.0;
+    size_t visibleCount = 0;
+    size_t testedCount = 0;
+    size_t mismatches = 0;
+    for (int direction = 0; direction < DIRECTIONS; ++direction) {
+        const float angle = glm::radians(360.0f * direction / DIRECTIONS);
+        const glm::vec3 forward(glm::cos(angle), -0.2f, glm::sin(angle));
+        ash::Frustum frustum;
+        frustum.ExtractFromViewProjection(projection * glm::lookAt(eye, eye + forward, glm::vec3(0, 1, 0)));
+
+        cullerMs += bench::measure(RUNS, [&] { culler.cull(frustum, coords, 1.0f, visible); }).bestMs;
+        perChunkMs += bench::measure(RUNS, [&] {
+            for (size_t i = 0; i < coords.size(); ++i) {
+                const ash::Vec3 min = ash::Vec3(coords[i].x, coords[i].y, coords[i].z) * size;
+                reference[i] = frustum.IntersectsAABB(min, min + ash::Vec3(size));
+            }
+        }).bestMs;
+
+        testedCount += culler.getBatchSize();
+        for (size_t i = 0; i < coords.size(); ++i) {
+            visibleCount += visible[i];
+            mismatches += visible[i] != reference[i];
+        }
+    }
+
+    std::cout << "ChunkFrustumCuller: " << coords.size() << " chunks, " << DIRECTIONS << " directions\n"
+            << "  two-level culler: " << cullerMs / DIRECTIONS << " ms, " << culler.getGroupCount()
+            << " groups, " << testedCount / DIRECTIONS << " chunks tested one by one\n"
+            << "  IntersectsAABB per chunk: " << perChunkMs / DIRECTIONS << " ms\n"
+            << "  " << visibleCount / DIRECTIONS << " visible on average, speedup " << perChunkMs / cullerMs
+            << "x, " << mismatches << " differences\n";
+    return 0;
+}
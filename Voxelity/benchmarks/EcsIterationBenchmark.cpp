@@ -0,0 +1,120 @@
+#include <iostream>
+
+#include "Ashen/ECS/Query.h"
+
+#include "Bench.h"
+#include "Voxelity/entities/Components.h"
+
+using namespace voxelity;
+
+namespace {
+    constexpr int ENTITY_COUNT = 1000000;
+    constexpr int RUNS = 10;
+    constexpr float DELTA_TIME = 0.05f;
+
+    // Les entités d'avant l'ECS : un objet par entité, alloué à part, mis à jour par un appel virtuel
+    class LegacyEntity {
+    public:
+        virtual ~LegacyEntity() = default;
+
+        virtual void update(float deltaTime) = 0;
+
+        Transform transform;
+        Motion motion;
+        Collider collider;
+        bool isActive = true;
+    };
+
+    class LegacyFallingBlock final : public LegacyEntity {
+    public:
+        void update(const float deltaTime) override {
+            transform.saveState();
+            motion.velocity.y -= 32.0f * deltaTime;
+            transform.position += motion.velocity * deltaTime;
+            if (transform.position.y < 0.0f) {
+                transform.position.y = 0.0f;
+                motion.velocity.y = 0.0f;
+                motion.onGround = true;
+            }
+        }
+
+        FallingBlock block;
+    };
+
+    // Même mise à jour, sur les colonnes d'un bloc d'archétype
+    void updateColumns(const size_t count, Transform *transforms, Motion *motions) {
+        for (size_t i = 0; i < count; ++i) {
+            transforms[i].saveState();
+            motions[i].velocity.y -= 32.0f * DELTA_TIME;
+            transforms[i].position += motions[i].velocity * DELTA_TIME;
+            if (transforms[i].position.y < 0.0f) {
+                transforms[i].position.y = 0.0f;
+                motions[i].velocity.y = 0.0f;
+                motions[i].onGround = true;
+            }
+        }
+    }
+}
+
+// 1M blocs en chute : Transform, Motion et Collider mis à jour à chaque tick.
+// Hiérarchie virtuelle (allocations entrelacées avec d'autres, comme en jeu) contre les requêtes du Registry
+int main() {
+    ash::Vector<ash::Own<LegacyEntity> > legacy;
+    ash::Vector<ash::Own<char[]> > unrelated;
+    ash::Registry registry;
+    for (int i = 0; i < ENTITY_COUNT; ++i) {
+        const glm::vec3 position(static_cast<float>(i % 100), 100.0f, static_cast<float>(i / 100 % 100));
+        legacy.push_back(ash::MakeOwn<LegacyFallingBlock>());
+        legacy.back()->transform.position = position;
+        unrelated.push_back(ash::MakeOwn<char[]>(40 + i * 7 % 200));
+
+        Transform transform;
+        transform.position = position;
+        registry.Create(transform, Motion{}, Collider{}, FallingBlock{});
+    }
+
+    const ash::Query<Transform, Motion, const Collider> query(registry);
+
+    const bench::Timing virtualTiming = bench::measure(RUNS, [&] {
+        for (const auto &entity: legacy) {
+            if (entity->isActive) entity->update(DELTA_TIME);
+        }
+    });
+    const bench::Timing eachTiming = bench::measure(RUNS, [&] {
+        query.Each([](ash::EntityId, Transform &transform, Motion &motion, const Collider &) {
+            updateColumns(1, &transform, &motion);
+        });
+    });
+    const bench::Timing chunkTiming = bench::measure(RUNS, [&] {
+        query.EachChunk([](const size_t count, const ash::EntityId *, Transform *transforms, Motion *motions,
+                           const Collider *) {
+            updateColumns(count, transforms, motions);
+        });
+    });
+    const bench::Timing parallelTiming = bench::measure(RUNS, [&] {
+        query.ParallelEachChunk([](const size_t count, const ash::EntityId *, Transform *transforms, Motion *motions,
+                                   const Collider *) {
+            updateColumns(count, transforms, motions);
+        }, 8);
+    });
+
+    // Les requêtes ont avancé le Registry de trois séries : autant de ticks de chaque côté
+    for (int tick = 0; tick < 2 * RUNS; ++tick) {
+        for (const auto &entity: legacy)
+            entity->update(DELTA_TIME);
+    }
+    size_t differences = 0;
+    size_t index = 0;
+    query.Each([&](ash::EntityId, const Transform &transform, const Motion &, const Collider &) {
+        differences += transform.position != legacy[index++]->transform.position;
+    });
+
+    std::cout << "ECS iteration: " << ENTITY_COUNT << " entities, " << registry.GetArchetypeCount()
+            << " archetypes, best of " << RUNS << " ticks\n"
+            << "  virtual update over separate allocations: " << virtualTiming.bestMs << " ms\n"
+            << "  Query::Each: " << eachTiming.bestMs << " ms\n"
+            << "  Query::EachChunk: " << chunkTiming.bestMs << " ms\n"
+            << "  Query::ParallelEachChunk: " << parallelTiming.bestMs << " ms\n"
+            << "  " << differences << " positions differing after " << 3 * RUNS << " ticks\n";
+    return 0;
+}
@@ -0,0 +1,106 @@
+#include <iostream>
+#include <random>
+
+#include "Bench.h"
+#include "Voxelity/entities/EntitySpatialHash.h"
+#include "Voxelity/systems/PhysicsSystem.h"
+
+using namespace voxelity;
+
+namespace {
+    constexpr int ENTITY_COUNT = 50000;
+    constexpr int QUERY_COUNT = 1000;
+    constexpr float QUERY_RADIUS = 8.0f;
+    constexpr int PAIR_SAMPLE = 500; // Entités testées contre toutes pour estimer le parcours N²
+
+    ash::Vector<EntitySpatialHash::Entry> makeEntities(const glm::vec3 &area) {
+        std::mt19937 random(42);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        ash::Vector<EntitySpatialHash::Entry> entities;
+        for (uint32_t i = 0; i < ENTITY_COUNT; ++i) {
+            const glm::vec3 center(unit(random) * area.x, unit(random) * area.y, unit(random) * area.z);
+            const glm::vec3 half(0.3f + unit(random) * 0.7f); // Entre 0,6 et 2 blocs de côté
+            entities.push_back({ash::EntityId{i, 0}, ash::BBox3(center - half, center + half)});
+        }
+        return entities;
+    }
+
+    void run(const char *name, const glm::vec3 &area) {
+        const ash::Vector<EntitySpatialHash::Entry> entities = makeEntities(area);
+
+        EntitySpatialHash hash;
+        auto start = bench::Clock::now();
+        for (const EntitySpatialHash::Entry &entry: entities)
+            hash.insert(entry.entity, entry.bounds);
+        const double insertMs = bench::elapsedMs(start);
+
+        // Rafraîchissement d'un tick : chaque entité décalée d'un dixième de bloc
+        start = bench::Clock::now();
+        for (const EntitySpatialHash::Entry &entry: entities)
+            hash.update(entry.entity, entry.bounds.Translated(glm::vec3(0.1f, 0.0f, 0.0f)));
+        const double updateMs = bench::elapsedMs(start);
+        for (const EntitySpatialHash::Entry &entry: entities)
+            hash.update(entry.entity, entry.bounds);
+
+        std::mt19937 random(7);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        ash::Vector<glm::vec3> centers;
+        for (int i = 0; i < QUERY_COUNT; ++i)
+            centers.emplace_back(unit(random) * area.x, unit(random) * area.y, unit(random) * area.z);
+
+        ash::Vector<ash::EntityId> found;
+        size_t hashFound = 0;
+        start = bench::Clock::now();
+        for (const glm::vec3 &center: centers) {
+            found.clear();
+            hash.queryRadius(center, QUERY_RADIUS, found);
+            hashFound += found.size();
+        }
+        const double hashQueryMs = bench::elapsedMs(start);
+
+        size_t scanFound = 0;
+        start = bench::Clock::now();
+        for (const glm::vec3 &center: centers) {
+            for (const EntitySpatialHash::Entry &entry: entities) {
+                const glm::vec3 delta = glm::clamp(center, entry.bounds.min, entry.bounds.max) - center;
+                scanFound += glm::dot(delta, delta) <= QUERY_RADIUS * QUERY_RADIUS;
+            }
+        }
+        const double scanQueryMs = bench::elapsedMs(start);
+
+        ash::Vector<EntityPair> pairs;
+        start = bench::Clock::now();
+        PhysicsSystem::findEntityPairs(hash, pairs);
+        const double pairMs = bench::elapsedMs(start);
+
+        // Parcours N² estimé sur PAIR_SAMPLE entités : chaque paire n'est testée qu'une fois
+        size_t sampledPairs = 0;
+        start = bench::Clock::now();
+        for (int i = 0; i < PAIR_SAMPLE; ++i) {
+            for (size_t j = i + 1; j < entities.size(); ++j)
+                sampledPairs += entities[i].bounds.Intersects(entities[j].bounds);
+        }
+        const double tests = static_cast<double>(ENTITY_COUNT) * (ENTITY_COUNT - 1) / 2.0;
+        const double sampledTests = static_cast<double>(PAIR_SAMPLE) * ENTITY_COUNT
+                                    - static_cast<double>(PAIR_SAMPLE) * (PAIR_SAMPLE + 1) / 2.0;
+        const double scanPairMs = bench::elapsedMs(start) * tests / sampledTests;
+
+        std::cout << "  " << name << " (" << area.x << " x " << area.y << " x " << area.z << "), "
+                << hash.getCellCount() << " cells:\n"
+                << "    insert " << insertMs << " ms, update all " << updateMs << " ms\n"
+                << "    " << QUERY_COUNT << " radius-" << QUERY_RADIUS << " queries: hash " << hashQueryMs
+                << " ms, linear scan " << scanQueryMs << " ms, " << hashFound << " / " << scanFound << " found\n"
+                << "    pairs: hash " << pairMs << " ms for " << pairs.size() << " pairs, N^2 scan ~"
+                << scanPairMs << " ms (" << sampledPairs << " pairs in the sample)\n";
+    }
+}
+
+// 50k entités de 0,6 à 2 blocs, éparpillées sur une grande zone puis entassées dans une petite
+int main() {
+    std::cout << "EntitySpatialHash: " << ENTITY_COUNT << " entities, " << EntitySpatialHash::DEFAULT_CELL_SIZE
+            << "-block cells\n";
+    run("spread", glm::vec3(1024.0f, 128.0f, 1024.0f));
+    run("crowd", glm::vec3(128.0f, 16.0f, 128.0f));
+    return 0;
+}
@@ -0,0 +1,66 @@
+#include <iostream>
+
+#include "Bench.h"
+#include "Voxelity/entities/EntityManager.h"
+
+using namespace voxelity;
+
+// 10k blocs en chute apparus et retirés par seconde à 20 TPS pendant 30 s : chaque bloc vit une seconde
+// en chute libre puis expire, la population se stabilise vers 10k. Le pool de blocs d'archétype
+// doit cesser d'allouer après la montée en charge, et un identifiant détruit ne jamais redevenir vivant
+int main() {
+    constexpr int TICKS_PER_SECOND = 20;
+    constexpr int SPAWNS_PER_TICK = 500;
+    constexpr int TICKS = TICKS_PER_SECOND * 30;
+    constexpr int WARM_UP_TICKS = 2 * TICKS_PER_SECOND;
+    constexpr float DELTA_TIME = 1.0f / TICKS_PER_SECOND;
+    constexpr float LIFETIME = 1.0f;
+
+    World world(nullptr); // Sans sol : les blocs tombent jusqu'à expiration
+    EntityManager entities;
+    const ash::ChunkPool &pool = entities.getRegistry().GetChunkPool();
+
+    ash::Vector<ash::EntityId> expired; // Un identifiant par tick, vérifiés une fois détruits
+    size_t allocatedAfterWarmUp = 0;
+    size_t peakEntities = 0;
+    double worstMs = 0.0;
+    double totalMs = 0.0;
+    for (int tick = 0; tick < TICKS; ++tick) {
+        if (tick == WARM_UP_TICKS) allocatedAfterWarmUp = pool.GetAllocatedCount();
+
+        const auto start = bench::Clock::now();
+        for (int i = 0; i < SPAWNS_PER_TICK; ++i) {
+            const glm::vec3 position(static_cast<float>(i % 25) * 2.0f, 200.0f, static_cast<float>(i / 25) * 2.0f);
+            const ash::EntityId entity = entities.spawnFallingBlock(position, VoxelID::SAND, LIFETIME);
+            if (i == 0) expired.push_back(entity);
+        }
+        entities.updateAll(DELTA_TIME, world);
+        const double ms = bench::elapsedMs(start);
+
+        peakEntities = std::max(peakEntities, entities.getEntityCount());
+        if (tick >= WARM_UP_TICKS) {
+            worstMs = std::max(worstMs, ms);
+            totalMs += ms;
+        }
+    }
+
+    // Les blocs des dernières secondes vivent encore ; les plus anciens ont été détruits et leurs
+    // emplacements réutilisés
+    size_t staleAlive = 0;
+    size_t checked = 0;
+    for (size_t i = 0; i + 2 * TICKS_PER_SECOND < expired.size(); ++i) {
+        staleAlive += entities.isAlive(expired[i]);
+        ++checked;
+    }
+
+    std::cout << "Entity spawn/despawn: " << SPAWNS_PER_TICK * TICKS_PER_SECOND << " per second for "
+            << TICKS / TICKS_PER_SECOND << " s at " << TICKS_PER_SECOND << " TPS, peak " << peakEntities
+            << " entities\n"
+            << "  archetype chunks: " << allocatedAfterWarmUp << " allocated after warm-up, "
+            << pool.GetAllocatedCount() - allocatedAfterWarmUp << " more afterwards, " << pool.GetFreeCount()
+            << " free\n"
+            << "  tick (spawns + updateAll): " << totalMs / (TICKS - WARM_UP_TICKS) << " ms average, worst "
+            << worstMs << " ms\n"
+            << "  " << staleAlive << " of " << checked << " destroyed ids reported alive\n";
+    return 0;
+}
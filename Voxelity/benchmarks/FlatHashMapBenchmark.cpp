@@ -0,0 +1,128 @@
+#include <iostream>
+#include <unordered_map>
+
+#include "Bench.h"
+
+using namespace voxelity;
+
+namespace {
+    constexpr int RADIUS = 16; // Distance de chargement horizontale, en chunks
+    constexpr int HEIGHT = 4; // Demi-hauteur chargée, en chunks
+    constexpr int RUNS = 5;
+
+    // Hash de ChunkCoord avant HashCoord3
+    struct XorCoordHash {
+        size_t operator()(const ChunkCoord &coord) const noexcept {
+            const size_t h1 = std::hash<int>{}(coord.x);
+            const size_t h2 = std::hash<int>{}(coord.y);
+            const size_t h3 = std::hash<int>{}(coord.z);
+            return h1 ^ h2 << 1 ^ h3 << 2;
+        }
+    };
+
+    struct MortonCoordHash {
+        size_t operator()(const ChunkCoord &coord) const noexcept {
+            return ash::HashCoord3(coord.x, coord.y, coord.z);
+        }
+    };
+
+    // Même valeur que ChunkManager::m_chunks
+    using Value = ash::Ref<Chunk>;
+
+    // Chunks chargés autour de center, comme ChunkManager::updateLoadedChunks
+    template<typename Func>
+    void forEachLoaded(const ChunkCoord &center, Func &&func) {
+        for (int y = -HEIGHT; y <= HEIGHT; ++y) {
+            for (int z = -RADIUS; z <= RADIUS; ++z) {
+                for (int x = -RADIUS; x <= RADIUS; ++x)
+                    func(ChunkCoord(center.x + x, center.y + y, center.z + z));
+            }
+        }
+    }
+
+    struct Result {
+        double hitNs;
+        double missNs;
+        double moveMs;
+    };
+
+    // Trois usages mesurés sur une même table :
+    // - les 6 voisins de chaque chunk chargé (mesher, lumière) : presque toujours trouvés ;
+    // - la couche juste hors de la zone chargée : jamais trouvée ;
+    // - 32 pas du joueur sur x : une tranche insérée et une tranche supprimée par pas
+    template<typename Map>
+    Result run(const ChunkCoord &center) {
+        Map map;
+        forEachLoaded(center, [&](const ChunkCoord &coord) { map.emplace(coord, Value()); });
+
+        size_t found = 0;
+        size_t lookups = 0;
+        const bench::Timing hits = bench::measure(RUNS, [&] {
+            lookups = 0;
+            forEachLoaded(center, [&](const ChunkCoord &coord) {
+                found += map.find({coord.x + 1, coord.y, coord.z}) != map.end();
+                found += map.find({coord.x - 1, coord.y, coord.z}) != map.end();
+                found += map.find({coord.x, coord.y + 1, coord.z}) != map.end();
+                found += map.find({coord.x, coord.y - 1, coord.z}) != map.end();
+                found += map.find({coord.x, coord.y, coord.z + 1}) != map.end();
+                found += map.find({coord.x, coord.y, coord.z - 1}) != map.end();
+                lookups += 6;
+            });
+        });
+        const double hitNs = hits.bestMs * 1e6 / static_cast<double>(lookups);
+
+        const bench::Timing misses = bench::measure(RUNS, [&] {
+            lookups = 0;
+            for (int y = -HEIGHT; y <= HEIGHT; ++y) {
+                for (int i = -RADIUS - 1; i <= RADIUS + 1; ++i) {
+                    found += map.contains({center.x + i, center.y + y, center.z - RADIUS - 1});
+                    found += map.contains({center.x + i, center.y + y, center.z + RADIUS + 1});
+                    found += map.contains({center.x - RADIUS - 1, center.y + y, center.z + i});
+                    found += map.contains({center.x + RADIUS + 1, center.y + y, center.z + i});
+                    lookups += 4;
+                }
+            }
+        });
+        const double missNs = misses.bestMs * 1e6 / static_cast<double>(lookups);
+
+        constexpr int STEPS = 32;
+        const auto start = bench::Clock::now();
+        for (int step = 0; step < STEPS; ++step) {
+            const int leaving = center.x + step - RADIUS;
+            const int entering = center.x + step + RADIUS + 1;
+            for (int y = -HEIGHT; y <= HEIGHT; ++y) {
+                for (int z = -RADIUS; z <= RADIUS; ++z) {
+                    map.erase(ChunkCoord(leaving, center.y + y, center.z + z));
+                    map.emplace(ChunkCoord(entering, center.y + y, center.z + z), Value());
+                }
+            }
+        }
+        const double moveMs = bench::elapsedMs(start) / STEPS;
+
+        if (found == 0) std::cout << "no chunk found\n";
+        return {hitNs, missNs, moveMs};
+    }
+
+    void report(const char *name, const Result &result) {
+        std::cout << "  " << name << ": hit " << result.hitNs << " ns, miss " << result.missNs
+                << " ns, move step " << result.moveMs << " ms\n";
+    }
+}
+
+// Table des chunks chargés (33 × 9 × 33 = 9 801 ChunkCoord) autour de l'origine,
+// puis loin de l'origine (coordonnées grandes et négatives).
+// Avant : std::unordered_map et hash XOR. Après : FlatHashMap et HashCoord3 (ChunkManager::m_chunks)
+int main() {
+    for (const ChunkCoord center: {ChunkCoord(0, 0, 0), ChunkCoord(31250, -2, -15625)}) {
+        std::cout << "Chunk table around (" << center.x << ", " << center.y << ", " << center.z
+                << "), best of " << RUNS << " runs\n";
+        const Result before = run<std::unordered_map<ChunkCoord, Value, XorCoordHash> >(center);
+        report("unordered_map + xor hash   ", before);
+        report("unordered_map + HashCoord3 ", run<std::unordered_map<ChunkCoord, Value, MortonCoordHash> >(center));
+        const Result after = run<ash::FlatHashMap<ChunkCoord, Value, MortonCoordHash> >(center);
+        report("FlatHashMap + HashCoord3   ", after);
+        std::cout << "  speedup: hit " << before.hitNs / after.hitNs << "x, miss " << before.missNs / after.missNs
+                << "x, move " << before.moveMs / after.moveMs << "x\n";
+    }
+    return 0;
+}
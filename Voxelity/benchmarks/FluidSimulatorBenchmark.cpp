@@ -0,0 +1,73 @@
+#include <iostream>
+
+#include "Bench.h"
+#include "Voxelity/voxelWorld/tick/FluidSimulator.h"
+
+using namespace voxelity;
+
+namespace {
+    constexpr int WATER_TICK_INTERVAL = 5; // Un pas de l'eau tous les 5 ticks du monde
+    constexpr double TICK_BUDGET_MS = 50.0;
+
+    // Un pas de l'eau : les ticks du monde qui le séparent du précédent ne font rien
+    double stepWater(FluidSimulator &fluids) {
+        const auto start = bench::Clock::now();
+        for (int tick = 0; tick < WATER_TICK_INTERVAL; ++tick)
+            fluids.tick();
+        return bench::elapsedMs(start);
+    }
+}
+
+// Deux scènes sur un sol de pierre de 256 × 256 :
+// - un océan de 102 400 cellules posé d'un seul fillBox, toutes actives au premier pas ;
+// - le même océan retenu par un barrage qu'on retire, l'eau se répand sur le reste du sol
+int main() {
+    constexpr int SIDE = 256;
+    constexpr int OCEAN_X = 128;
+    constexpr int OCEAN_Z = 100;
+    constexpr int OCEAN_DEPTH = 8;
+    constexpr int DAM_BREAK_STEPS = 40;
+
+    World world(nullptr);
+    FluidSimulator &fluids = world.getFluidSimulator();
+    world.fillBox({{0, 0, 0}, {SIDE - 1, 0, SIDE - 1}}, VoxelID::STONE);
+
+    const ash::BBox3i ocean{{0, 1, 0}, {OCEAN_X - 1, OCEAN_DEPTH, OCEAN_Z - 1}};
+    world.fillBox(ocean, VoxelID::WATER);
+    bench::waitForWorkers(world);
+
+    std::cout << "FluidSimulator: " << world.getLoadedChunkCount() << " chunks, budget " << TICK_BUDGET_MS
+            << " ms per world tick\n  ocean placed in one edit:\n";
+    for (int step = 0; step < 3; ++step) {
+        const size_t active = fluids.getActiveCellCount();
+        const double ms = stepWater(fluids);
+        std::cout << "    step " << step << ": " << active << " active cells, " << ms << " ms, "
+                << fluids.getLastChangeCount() << " changes\n";
+    }
+
+    // Barrage : l'océan est retenu par un mur, seules les cellules au contact de la brèche repartent
+    world.fillBox({{0, 1, 0}, {SIDE - 1, OCEAN_DEPTH, SIDE - 1}}, VoxelID::AIR);
+    world.fillBox(ocean, VoxelID::WATER);
+    const ash::BBox3i dam{{OCEAN_X, 1, 0}, {OCEAN_X, OCEAN_DEPTH, OCEAN_Z - 1}};
+    world.fillBox(dam, VoxelID::STONE);
+    fluids.clear();
+    bench::waitForWorkers(world);
+
+    world.fillBox(dam, VoxelID::AIR);
+
+    size_t peakActive = 0;
+    size_t changes = 0;
+    double worstMs = 0.0;
+    double totalMs = 0.0;
+    for (int step = 0; step < DAM_BREAK_STEPS; ++step) {
+        peakActive = std::max(peakActive, fluids.getActiveCellCount());
+        const double ms = stepWater(fluids);
+        worstMs = std::max(worstMs, ms);
+        totalMs += ms;
+        changes += fluids.getLastChangeCount();
+    }
+    std::cout << "  dam break, " << DAM_BREAK_STEPS << " steps: " << totalMs / DAM_BREAK_STEPS
+            << " ms/step, worst " << worstMs << " ms, peak " << peakActive << " active cells, " << changes
+            << " changes, " << fluids.getActiveCellCount() << " still active\n";
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include <iostream>
+
+#include "Bench.h"
+
+using namespace voxelity;
+
+namespace {
+    // Modification puis attente active de la fin de la propagation sur le thread de lumière.
+    // Les files de mesh sont vidées avant chaque mesure, pas pendant
+    template<typename Func>
+    double timeLight(const World &world, Func &&func) {
+        bench::waitForWorkers(world);
+
+        const auto start = bench::Clock::now();
+        func();
+        while (world.getPendingLightCount() > 0)
+            std::this_thread::yield();
+        return bench::elapsedMs(start);
+    }
+}
+
+// 3 × 3 colonnes de 8 chunks : pierre jusqu'à y = 63, air au-dessus, une vitre en haut de chaque couche
+// de chunks pour les créer du haut vers le bas. Deux mesures :
+// - ré-éclairage complet de la colonne centrale (8 chunks) après le percement ou le rebouchage d'un puits ;
+// - pose puis retrait d'une source de 15 dans l'air, au-dessus du sol
+int main() {
+    constexpr int SIDE = 3 * VoxelArray::SIZE;
+    constexpr int HEIGHT = 8 * VoxelArray::SIZE;
+    constexpr int GROUND = 64;
+    constexpr int RUNS = 20;
+
+    World world(nullptr);
+    for (int y = HEIGHT - 1; y >= 0; y -= VoxelArray::SIZE)
+        world.fillBox({{0, y, 0}, {SIDE - 1, y, SIDE - 1}}, VoxelID::GLASS);
+    world.fillBox({{0, 0, 0}, {SIDE - 1, GROUND - 1, SIDE - 1}}, VoxelID::STONE);
+    bench::waitForWorkers(world);
+
+    // Puits vertical au centre de la colonne : chaque chunk de la colonne change et est ré-éclairé
+    constexpr int CENTER = SIDE / 2;
+    const ash::BBox3i shaft{{CENTER - 1, 0, CENTER - 1}, {CENTER + 1, HEIGHT - 1, CENTER + 1}};
+    world.fillBox(shaft, VoxelID::GLASS);
+
+    double openMs = 0.0;
+    double closeMs = 0.0;
+    for (int run = 0; run < RUNS; ++run) {
+        openMs += timeLight(world, [&] { world.replace(shaft, VoxelID::GLASS, VoxelID::AIR); });
+        closeMs += timeLight(world, [&] { world.replace(shaft, VoxelID::AIR, VoxelID::GLASS); });
+    }
+
+    const glm::ivec3 source{CENTER + 8, GROUND + 6, CENTER + 8};
+    double placeMs = 0.0;
+    double removeMs = 0.0;
+    for (int run = 0; run < RUNS; ++run) {
+        placeMs += timeLight(world, [&] { world.setVoxel(source, VoxelID::LAVA); });
+        removeMs += timeLight(world, [&] { world.setVoxel(source, VoxelID::AIR); });
+    }
+
+    std::cout << "LightEngine: " << world.getLoadedChunkCount() << " chunks, average of " << RUNS << " runs\n"
+            << "  column relight (" << HEIGHT / VoxelArray::SIZE << " chunks): shaft opened " << openMs / RUNS
+            << " ms, closed " << closeMs / RUNS << " ms\n"
+            << "  light source: placed " << placeMs / RUNS << " ms, removed " << removeMs / RUNS << " ms\n";
+    return 0;
+}
@@ -0,0 +1,180 @@
+#include <cmath>
+#include <iostream>
+
+#include "Bench.h"
+#include "Voxelity/systems/PhysicsSystem.h"
+#include "Voxelity/voxelWorld/world/VoxelAccessor.h"
+
+using namespace voxelity;
+
+namespace {
+    // Le pas d'avant le balayage sur place : un vecteur de blocs candidats par balayage,
+    // un World::getVoxel (verrou du chunk compris) par voxel, puis un de plus par contact
+    class LegacyPhysics {
+    public:
+        explicit LegacyPhysics(const PhysicsConfig &config) : m_config(config) {
+        }
+
+        void step(PhysicsBody &body, const float deltaTime, const World &world) const {
+            body.velocity.y += m_config.gravity * deltaTime;
+            body.velocity.y *= m_config.airDrag;
+            if (body.velocity.y < m_config.terminalVelocity) body.velocity.y = m_config.terminalVelocity;
+
+            body.position += moveAndCollide(body, body.velocity * deltaTime, world);
+
+            if (body.onGround) {
+                const glm::ivec3 feet = glm::floor(body.position - glm::vec3(0, body.size.y * 0.5f + 0.1f, 0));
+                const VoxelType voxel = world.getVoxel(feet);
+                const float friction = doesVoxelHaveCollision(voxel) ? getVoxelFriction(voxel) : m_config.groundFriction;
+                body.velocity.x *= friction;
+                body.velocity.z *= friction;
+                if (std::abs(body.velocity.x) < 0.003f) body.velocity.x = 0.0f;
+                if (std::abs(body.velocity.z) < 0.003f) body.velocity.z = 0.0f;
+            } else {
+                body.velocity.x *= m_config.horizontalAirDrag;
+                body.velocity.z *= m_config.horizontalAirDrag;
+            }
+        }
+
+    private:
+        PhysicsConfig m_config;
+
+        glm::vec3 moveAndCollide(PhysicsBody &body, const glm::vec3 &motion, const World &world) const {
+            body.onGround = false;
+            ash::BBox3 box = body.getBoundingBox();
+            glm::vec3 actual(0.0f);
+
+            for (const int axis: {1, 0, 2}) {
+                if (std::abs(motion[axis]) < m_config.collisionEpsilon) continue;
+
+                ash::Vector<CollisionInfo> collisions;
+                const float moved = sweepAxis(box, motion[axis], axis, world, collisions);
+                actual[axis] += moved;
+                glm::vec3 offset(0.0f);
+                offset[axis] = moved;
+                box = box.Translated(offset);
+
+                if (collisions.empty()) continue;
+                const float bounciness = getVoxelBounciness(collisions[0].blockType);
+                body.velocity[axis] = bounciness > 0.01f ? -body.velocity[axis] * bounciness : 0.0f;
+                if (axis == 1 && motion.y < 0.0f) body.onGround = true;
+            }
+            return actual;
+        }
+
+        float sweepAxis(const ash::BBox3 &aabb, const float motion, const int axis, const World &world,
+                        ash::Vector<CollisionInfo> &collisions) const {
+            ash::BBox3 sweep = aabb;
+            if (motion > 0.0f) sweep.max[axis] += motion;
+            else sweep.min[axis] += motion;
+            sweep = sweep.Expanded(m_config.collisionEpsilon);
+
+            ash::Vector<glm::ivec3> blocks;
+            for (int x = static_cast<int>(std::floor(sweep.min.x)); x <= static_cast<int>(std::ceil(sweep.max.x)); ++x) {
+                for (int y = static_cast<int>(std::floor(sweep.min.y)); y <= static_cast<int>(std::ceil(sweep.max.y)); ++y) {
+                    for (int z = static_cast<int>(std::floor(sweep.min.z)); z <= static_cast<int>(std::ceil(sweep.max.z)); ++z) {
+                        if (doesVoxelHaveCollision(world.getVoxel(x, y, z))) blocks.emplace_back(x, y, z);
+                    }
+                }
+            }
+
+            float closestHit = motion;
+            for (const glm::ivec3 &blockPos: blocks) {
+                const ash::BBox3 blockBox = ash::BBox3::FromBlock(blockPos);
+                const float hit = motion > 0.0f ? blockBox.min[axis] - aabb.max[axis] : blockBox.max[axis] - aabb.min[axis];
+                if (std::abs(hit) >= std::abs(closestHit)) continue;
+
+                glm::vec3 offset(0.0f);
+                offset[axis] = hit;
+                if (!aabb.Translated(offset).Intersects(blockBox)) continue;
+
+                closestHit = hit;
+                CollisionInfo info;
+                info.blockPos = blockPos;
+                info.axis = axis;
+                info.distance = std::abs(hit);
+                info.penetration[axis] = hit;
+                info.blockType = world.getVoxel(blockPos);
+                collisions.push_back(info);
+            }
+
+            if (collisions.empty()) return motion;
+            return closestHit - (motion > 0.0f ? 1.0f : -1.0f) * m_config.collisionEpsilon;
+        }
+    };
+
+    // 100 × 100 blocs lâchés de 10 à 40 blocs de haut, légère dérive horizontale
+    ash::Vector<PhysicsBody> makeBodies(const int side) {
+        ash::Vector<PhysicsBody> bodies;
+        for (int z = 0; z < side; ++z) {
+            for (int x = 0; x < side; ++x) {
+                PhysicsBody body;
+                body.position = glm::vec3(8.5f + 2.0f * x, 10.5f + static_cast<float>((x * 7 + z * 13) % 31),
+                                          8.5f + 2.0f * z);
+                body.velocity = glm::vec3(static_cast<float>(x % 5) - 2.0f, 0.0f, static_cast<float>(z % 5) - 2.0f);
+                body.size = glm::vec3(0.98f);
+                bodies.push_back(body);
+            }
+        }
+        return bodies;
+    }
+}
+
+// 10k blocs en chute sur un sol en gradins de 224 × 224, 30 pas à 20 TPS.
+// Le pas actuel (VoxelAccessor, une copie de voxels par pas pour les petits mouvements, tampon réutilisé)
+// contre sa reproduction d'avant
+int main() {
+    constexpr int SIDE = 100;
+    constexpr int STEPS = 30;
+    constexpr float DELTA_TIME = 0.05f;
+    constexpr double TARGET_SPEEDUP = 10.0;
+
+    World world(nullptr);
+    world.fillBox({{0, 0, 0}, {223, 2, 223}}, VoxelID::STONE);
+    for (int step = 0; step < 7; ++step) {
+        const int border = 16 * step;
+        world.fillBox({{border, 3, border}, {223 - border, 3 + step, 223 - border}}, VoxelID::STONE);
+    }
+    bench::waitForWorkers(world);
+
+    PhysicsConfig config;
+    config.gravity = -32.0f;
+    config.groundFriction = 0.8f;
+
+    ash::Vector<PhysicsBody> legacyBodies = makeBodies(SIDE);
+    const LegacyPhysics legacy(config);
+    auto start = bench::Clock::now();
+    for (int step = 0; step < STEPS; ++step) {
+        for (PhysicsBody &body: legacyBodies)
+            legacy.step(body, DELTA_TIME, world);
+    }
+    const double legacyMs = bench::elapsedMs(start) / STEPS;
+
+    ash::Vector<PhysicsBody> bodies = makeBodies(SIDE);
+    const PhysicsSystem physics(config);
+    VoxelAccessor voxels(world);
+    ash::Vector<VoxelType> sweepVoxels;
+    start = bench::Clock::now();
+    for (int step = 0; step < STEPS; ++step) {
+        for (PhysicsBody &body: bodies)
+            physics.step(body, DELTA_TIME, voxels, sweepVoxels);
+    }
+    const double currentMs = bench::elapsedMs(start) / STEPS;
+
+    size_t differences = 0;
+    size_t grounded = 0;
+    for (size_t i = 0; i < bodies.size(); ++i) {
+        differences += bodies[i].position != legacyBodies[i].position
+                || bodies[i].velocity != legacyBodies[i].velocity;
+        grounded += bodies[i].onGround;
+    }
+
+    const double speedup = legacyMs / currentMs;
+    std::cout << "PhysicsSystem broadphase: " << bodies.size() << " falling blocks, " << STEPS << " steps\n"
+            << "  per-voxel World::getVoxel, vector per sweep: " << legacyMs << " ms/step\n"
+            << "  one region copy per step through VoxelAccessor: " << currentMs << " ms/step\n"
+            << "  speedup " << speedup << "x (target " << TARGET_SPEEDUP << "x"
+            << (speedup < TARGET_SPEEDUP ? ", missed" : "") << "), " << grounded << " on the ground, "
+            << differences << " bodies ending in a different state\n";
+    return 0;
+}
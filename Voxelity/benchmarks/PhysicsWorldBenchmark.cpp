@@ -0,0 +1,117 @@
+#include <iostream>
+#include <random>
+
+#include "Ashen/Core/JobSystem.h"
+
+#include "Bench.h"
+#include "Voxelity/systems/PhysicsWorld.h"
+#include "Voxelity/voxelWorld/world/VoxelAccessor.h"
+
+using namespace voxelity;
+
+namespace {
+    constexpr int BODY_COUNT = 100000;
+    constexpr int TICKS = 60;
+    constexpr float DELTA_TIME = 0.05f;
+    constexpr double TICK_BUDGET_MS = 50.0;
+
+    // Nuage d'explosion : blocs répartis dans une sphère de 20 blocs, projetés vers l'extérieur
+    ash::Vector<PhysicsBody> makeExplosion() {
+        std::mt19937 random(1234);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        const glm::vec3 center(128.0f, 40.0f, 128.0f);
+
+        ash::Vector<PhysicsBody> bodies;
+        while (bodies.size() < BODY_COUNT) {
+            const glm::vec3 offset(unit(random), unit(random), unit(random));
+            if (glm::dot(offset, offset) > 1.0f) continue;
+
+            PhysicsBody body;
+            body.position = center + offset * 20.0f;
+            body.velocity = offset * 8.0f + glm::vec3(0.0f, 4.0f, 0.0f);
+            body.size = glm::vec3(0.98f);
+            bodies.push_back(body);
+        }
+        return bodies;
+    }
+
+    struct Run {
+        double averageMs = 0.0;
+        double worstMs = 0.0;
+    };
+
+    // Pas groupé du PhysicsWorld sur les composants d'un Registry
+    Run runBatched(const World &world, const ash::Vector<PhysicsBody> &start, const PhysicsConfig &config,
+                   ash::Vector<glm::vec3> &positions) {
+        ash::Registry registry;
+        PhysicsWorld physics(registry);
+        const uint32_t configIndex = physics.addConfig(config);
+
+        ash::Vector<ash::EntityId> entities;
+        for (const PhysicsBody &body: start) {
+            Transform transform;
+            transform.position = body.position;
+            transform.saveState();
+            entities.push_back(registry.Create(transform, Motion{body.velocity, false}, Collider{body.size},
+                                               RigidBody{configIndex, 0}));
+        }
+
+        Run run;
+        for (int tick = 0; tick < TICKS; ++tick) {
+            const auto begin = bench::Clock::now();
+            physics.step(DELTA_TIME, world);
+            const double ms = bench::elapsedMs(begin);
+            run.averageMs += ms / TICKS;
+            run.worstMs = std::max(run.worstMs, ms);
+        }
+
+        positions.clear();
+        for (const ash::EntityId entity: entities)
+            positions.push_back(registry.Get<Transform>(entity).position);
+        return run;
+    }
+}
+
+// 100k blocs projetés par une explosion au-dessus d'un sol de 256 × 256, 60 ticks.
+// Le PhysicsWorld (blocs d'archétype répartis sur le JobSystem) contre une boucle corps par corps
+int main() {
+    World world(nullptr);
+    world.fillBox({{0, 0, 0}, {255, 15, 255}}, VoxelID::STONE);
+    bench::waitForWorkers(world);
+
+    // Sans sommeil : les deux boucles avancent tous les corps à chaque tick
+    PhysicsConfig config;
+    config.gravity = -32.0f;
+    config.groundFriction = 0.8f;
+    config.sleepTicks = 0;
+
+    const ash::Vector<PhysicsBody> start = makeExplosion();
+    std::cout << "PhysicsWorld: " << BODY_COUNT << " falling blocks, " << TICKS << " ticks, "
+            << ash::JobSystem::Get().GetThreadCount() << " job threads, budget " << TICK_BUDGET_MS
+            << " ms per tick\n";
+
+    // Corps par corps, un accesseur pour tous
+    ash::Vector<PhysicsBody> bodies = start;
+    const PhysicsSystem system(config);
+    VoxelAccessor voxels(world);
+    ash::Vector<VoxelType> sweepVoxels;
+    Run sequential;
+    for (int tick = 0; tick < TICKS; ++tick) {
+        const auto begin = bench::Clock::now();
+        for (PhysicsBody &body: bodies)
+            system.step(body, DELTA_TIME, voxels, sweepVoxels);
+        const double ms = bench::elapsedMs(begin);
+        sequential.averageMs += ms / TICKS;
+        sequential.worstMs = std::max(sequential.worstMs, ms);
+    }
+    std::cout << "  body by body: " << sequential.averageMs << " ms/tick, worst " << sequential.worstMs << " ms\n";
+
+    ash::Vector<glm::vec3> positions;
+    const Run batched = runBatched(world, start, config, positions);
+    size_t differences = 0;
+    for (size_t i = 0; i < bodies.size(); ++i)
+        differences += positions[i] != bodies[i].position;
+    std::cout << "  batched: " << batched.averageMs << " ms/tick, worst " << batched.worstMs << " ms, " << differences
+            << " positions differing from body by body\n";
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include <iostream>
+
+#include "Bench.h"
+
+using namespace voxelity;
+
+namespace {
+    constexpr int RUNS = 3;
+
+    double toMBps(const size_t volume, const double ms) {
+        return static_cast<double>(volume * sizeof(VoxelType)) / (ms * 1000.0);
+    }
+
+    // Deux contenus distincts collés en alternance : pasteRegion saute les lignes déjà identiques
+    ash::Vector<VoxelType> makePattern(const ash::IVec3 &size, const int seed) {
+        ash::Vector<VoxelType> voxels(static_cast<size_t>(size.x) * size.y * size.z);
+        for (size_t i = 0; i < voxels.size(); ++i)
+            voxels[i] = (i / 7 + seed) % 3 == 0 ? VoxelID::STONE : VoxelID::DIRT;
+        return voxels;
+    }
+
+    // Meilleure de RUNS mesures, threads du monde au repos avant chacune
+    template<typename Func>
+    double measureEdit(const World &world, Func &&func) {
+        double best = 1e30;
+        for (int run = 0; run < RUNS; ++run) {
+            bench::waitForWorkers(world);
+            const auto start = bench::Clock::now();
+            func(run);
+            best = std::min(best, bench::elapsedMs(start));
+        }
+        return best;
+    }
+
+    void runSize(const int side) {
+        const ash::BBox3i box{{-side / 2, 0, -side / 2}, {side / 2 - 1, side - 1, side / 2 - 1}};
+        const ash::IVec3 size = box.max - box.min + 1;
+        const size_t volume = World::getRegionVolume(box);
+
+        World world(nullptr);
+        const ash::Vector<VoxelType> patterns[2] = {makePattern(size, 0), makePattern(size, 1)};
+        world.pasteRegion(box, patterns[1]);
+        bench::waitForWorkers(world);
+
+        ash::Vector<VoxelType> buffer(volume);
+        const double copyMs = bench::measure(RUNS, [&] { world.copyRegion(box, buffer); }).bestMs;
+        const double loopCopyMs = bench::measure(RUNS, [&] {
+            size_t i = 0;
+            for (int y = box.min.y; y <= box.max.y; ++y) {
+                for (int z = box.min.z; z <= box.max.z; ++z) {
+                    for (int x = box.min.x; x <= box.max.x; ++x)
+                        buffer[i++] = world.getVoxel(x, y, z);
+                }
+            }
+        }).bestMs;
+
+        const double pasteMs = measureEdit(world, [&](const int run) { world.pasteRegion(box, patterns[run % 2]); });
+
+        std::cout << side << "^3 (" << world.getLoadedChunkCount() << " chunks), best of " << RUNS << " runs\n"
+                << "  copy:  copyRegion " << copyMs << " ms (" << toMBps(volume, copyMs) << " MB/s), per-voxel "
+                << loopCopyMs << " ms (" << toMBps(volume, loopCopyMs) << " MB/s), speedup "
+                << loopCopyMs / copyMs << "x\n"
+                << "  paste: pasteRegion " << pasteMs << " ms (" << toMBps(volume, pasteMs) << " MB/s)";
+
+        // setVoxel par voxel (lumière et voisins prévenus à chaque appel) : trop lent pour 256³
+        if (side <= 64) {
+            const double loopPasteMs = measureEdit(world, [&](const int run) {
+                const ash::Vector<VoxelType> &voxels = patterns[(run + 1) % 2]; // Le collage a fini sur patterns[0]
+                size_t i = 0;
+                for (int y = box.min.y; y <= box.max.y; ++y) {
+                    for (int z = box.min.z; z <= box.max.z; ++z) {
+                        for (int x = box.min.x; x <= box.max.x; ++x)
+                            world.setVoxel(x, y, z, voxels[i++]);
+                    }
+                }
+            });
+            std::cout << ", per-voxel " << loopPasteMs << " ms (" << toMBps(volume, loopPasteMs)
+                    << " MB/s), speedup " << loopPasteMs / pasteMs << "x";
+        }
+        std::cout << "\n";
+    }
+}
+
+// Régions de 64³ et 256³ centrées sur x = z = 0 (chunks négatifs compris), entièrement chargées.
+// copyRegion contre une boucle de World::getVoxel, pasteRegion contre une boucle de World::setVoxel
+int main() {
+    runSize(64);
+    runSize(256);
+    return 0;
+}
@@ -0,0 +1,83 @@
+#include <filesystem>
+#include <iostream>
+
+#include "Bench.h"
+#include "Voxelity/voxelWorld/generation/NaturalTerrainGenerator.h"
+#include "Voxelity/voxelWorld/storage/ChunkCodec.h"
+#include "Voxelity/voxelWorld/storage/RegionStorage.h"
+
+using namespace voxelity;
+
+// 16 × 4 × 16 chunks autour de la surface, tous dans la même région :
+// génération complète (NaturalTerrainGenerator) contre relecture (RegionFile + ChunkCodec).
+// La relecture passe par un RegionStorage neuf, mais le fichier reste dans le cache du système
+int main() {
+    constexpr int SIDE = 16;
+    constexpr int HEIGHT = 4;
+    constexpr uint32_t SEED = 12345;
+
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "voxelity_region_benchmark";
+    std::filesystem::remove_all(directory);
+
+    ash::Vector<ChunkCoord> coords;
+    for (int y = 0; y < HEIGHT; ++y) {
+        for (int z = 0; z < SIDE; ++z) {
+            for (int x = 0; x < SIDE; ++x)
+                coords.emplace_back(x, y, z);
+        }
+    }
+
+    NaturalTerrainGenerator generator(SEED);
+    ash::Vector<ash::Own<Chunk> > chunks;
+    chunks.reserve(coords.size());
+    auto start = bench::Clock::now();
+    for (const auto &coord: coords) {
+        chunks.push_back(std::make_unique<Chunk>(coord));
+        generator.generateChunk(*chunks.back());
+    }
+    const double generateMs = bench::elapsedMs(start);
+
+    ash::Vector<EncodedChunk> encoded;
+    encoded.reserve(chunks.size());
+    size_t encodedBytes = 0;
+    start = bench::Clock::now();
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        const ChunkSnapshot snapshot = chunks[i]->snapshot();
+        encoded.push_back({coords[i], ChunkCodec::encode(coords[i], *snapshot.voxels, snapshot.fluid.get())});
+        encodedBytes += encoded.back().bytes.size();
+    }
+    const double encodeMs = bench::elapsedMs(start);
+
+    {
+        RegionStorage storage(directory);
+        start = bench::Clock::now();
+        storage.writeChunks(encoded, false);
+        const double writeMs = bench::elapsedMs(start);
+        std::cout << "Region storage: " << coords.size() << " chunks, " << encodedBytes / coords.size()
+                << " bytes per encoded chunk\n"
+                << "  encode " << encodeMs << " ms, write " << writeMs << " ms\n";
+    }
+
+    RegionStorage storage(directory);
+    ash::Vector<ChunkData> loaded(coords.size());
+    size_t missing = 0;
+    start = bench::Clock::now();
+    for (size_t i = 0; i < coords.size(); ++i)
+        missing += !storage.loadChunk(coords[i], loaded[i]);
+    const double loadMs = bench::elapsedMs(start);
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < coords.size(); ++i) {
+        const VoxelType *expected = chunks[i]->snapshot().voxels->data();
+        mismatches += !std::equal(expected, expected + VoxelArray::VOLUME, loaded[i].voxels.data());
+    }
+
+    const auto perChunk = [&](const double ms) { return ms * 1000.0 / static_cast<double>(coords.size()); };
+    std::cout << "  regenerate " << generateMs << " ms (" << perChunk(generateMs) << " us/chunk)\n"
+            << "  load + decode " << loadMs << " ms (" << perChunk(loadMs) << " us/chunk)\n"
+            << "  loading is " << generateMs / loadMs << "x faster, " << missing << " missing, " << mismatches
+            << " differing\n";
+
+    std::filesystem::remove_all(directory);
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include <iostream>
+#include <random>
+
+#include "Bench.h"
+#include "Voxelity/systems/PhysicsWorld.h"
+
+using namespace voxelity;
+
+namespace {
+    constexpr float DELTA_TIME = 0.05f;
+    constexpr int FLOOR_TOP = 3;
+
+    // Registry et PhysicsWorld d'une configuration, les corps étant créés au repos ou lancés
+    struct Scene {
+        ash::Registry registry;
+        PhysicsWorld physics{registry};
+        uint32_t config = 0;
+
+        explicit Scene(const uint32_t sleepTicks) {
+            PhysicsConfig physicsConfig;
+            physicsConfig.gravity = -32.0f;
+            physicsConfig.groundFriction = 0.8f;
+            physicsConfig.sleepTicks = sleepTicks;
+            config = physics.addConfig(physicsConfig);
+        }
+
+        void addBody(const glm::vec3 &position, const glm::vec3 &velocity) {
+            Transform transform;
+            transform.position = position;
+            transform.saveState();
+            registry.Create(transform, Motion{velocity, false}, Collider{glm::vec3(0.98f)}, RigidBody{config, 0});
+        }
+    };
+
+    struct Ticks {
+        double averageMs = 0.0;
+        double worstMs = 0.0;
+    };
+
+    Ticks runTicks(Scene &scene, const World &world, const int ticks) {
+        Ticks result;
+        for (int tick = 0; tick < ticks; ++tick) {
+            scene.physics.step(DELTA_TIME, world);
+            result.averageMs += scene.physics.getStats().stepMs / ticks;
+            result.worstMs = std::max(result.worstMs, scene.physics.getStats().stepMs);
+        }
+        return result;
+    }
+
+    // Tas de 100 × 100 colonnes de deux blocs posé sur le sol, immobile
+    void addPile(Scene &scene) {
+        for (int z = 0; z < 100; ++z) {
+            for (int x = 0; x < 100; ++x) {
+                for (int y = 0; y < 2; ++y)
+                    scene.addBody(glm::vec3(78.5f + x, FLOOR_TOP + 1.5f + y, 78.5f + z), glm::vec3(0.0f));
+            }
+        }
+    }
+
+    // Nuage d'explosion de 100k blocs projetés vers l'extérieur
+    void addExplosion(Scene &scene) {
+        std::mt19937 random(1234);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        for (int count = 0; count < 100000;) {
+            const glm::vec3 offset(unit(random), unit(random), unit(random));
+            if (glm::dot(offset, offset) > 1.0f) continue;
+            scene.addBody(glm::vec3(128.0f, 40.0f, 128.0f) + offset * 20.0f, offset * 8.0f + glm::vec3(0, 4, 0));
+            ++count;
+        }
+    }
+}
+
+// Corps endormis sur un sol de pierre de 256 × 256 :
+// - un tas de 20k blocs au repos, avec et sans sommeil, puis creusé sous les corps ;
+// - 100k blocs d'explosion qui retombent et s'endorment au fil des ticks
+int main() {
+    World world(nullptr);
+    world.fillBox({{0, 0, 0}, {255, FLOOR_TOP, 255}}, VoxelID::STONE);
+    bench::waitForWorkers(world);
+
+    std::cout << "Sleeping bodies:\n";
+
+    Scene awakePile(0);
+    addPile(awakePile);
+    const Ticks awake = runTicks(awakePile, world, 40);
+    std::cout << "  pile of " << awakePile.physics.getBodyCount() << " bodies, sleeping disabled: "
+            << awake.averageMs << " ms/tick\n";
+
+    Scene pile(20);
+    addPile(pile);
+    int settleTicks = 0;
+    double settleMs = 0.0;
+    while (pile.physics.getAwakeCount() > 0 && settleTicks < 200) {
+        pile.physics.step(DELTA_TIME, world);
+        settleMs = std::max(settleMs, pile.physics.getStats().stepMs);
+        ++settleTicks;
+    }
+    const Ticks asleep = runTicks(pile, world, 40);
+    std::cout << "  same pile, asleep after " << settleTicks << " ticks (worst " << settleMs << " ms): "
+            << asleep.averageMs << " ms/tick, " << pile.physics.getSleepingCount() << " sleeping\n";
+
+    // Creuser sous le tas : le World prévient le PhysicsWorld de chaque modification
+    world.setVoxelChangeListener([&pile](const ash::BBox3i &box) { pile.physics.wakeRegion(box); });
+
+    auto start = bench::Clock::now();
+    for (int hole = 0; hole < 100; ++hole)
+        world.setVoxel({80 + hole % 10 * 10, FLOOR_TOP, 80 + hole / 10 * 10}, VoxelID::AIR);
+    const double digMs = bench::elapsedMs(start);
+    const size_t wokenByDigging = pile.physics.getAwakeCount();
+    const Ticks afterDigging = runTicks(pile, world, 40);
+    std::cout << "  100 single blocks dug under the pile: " << digMs << " ms, " << wokenByDigging
+            << " woken, next 40 ticks " << afterDigging.averageMs << " ms/tick (worst " << afterDigging.worstMs
+            << " ms), " << pile.physics.getAwakeCount() << " still awake\n";
+
+    start = bench::Clock::now();
+    world.fillBox({{100, FLOOR_TOP, 100}, {131, FLOOR_TOP, 131}}, VoxelID::AIR);
+    const double holeMs = bench::elapsedMs(start);
+    const size_t wokenByHole = pile.physics.getAwakeCount();
+    const Ticks afterHole = runTicks(pile, world, 40);
+    std::cout << "  32 x 32 hole under the pile: " << holeMs << " ms, " << wokenByHole << " woken, next 40 ticks "
+            << afterHole.averageMs << " ms/tick (worst " << afterHole.worstMs << " ms)\n";
+    world.setVoxelChangeListener(nullptr);
+
+    // Les corps s'endorment pendant que d'autres tombent encore sur eux
+    for (const uint32_t sleepTicks: {0u, 20u}) {
+        Scene explosion(sleepTicks);
+        addExplosion(explosion);
+        const Ticks ticks = runTicks(explosion, world, 60);
+        std::cout << "  explosion of 100000 bodies, sleepTicks " << sleepTicks << ", 60 ticks: " << ticks.averageMs
+                << " ms/tick, worst " << ticks.worstMs << " ms, " << explosion.physics.getSleepingCount()
+                << " sleeping at the end\n";
+    }
+    return 0;
+}
@@ -0,0 +1,71 @@
+#include <cstdio>
+
+#include "Bench.h"
+#include "Voxelity/systems/PhysicsSystem.h"
+#include "Voxelity/voxelWorld/world/VoxelAccessor.h"
+
+using namespace voxelity;
+
+namespace {
+    constexpr int WALL_X = 70;
+    constexpr float DELTA_TIME = 0.05f;
+    constexpr int RUNS = 20000;
+
+    struct Sweep {
+        double nanoseconds;
+        glm::vec3 position;
+    };
+
+    // Un pas sans gravité vers le mur, repris RUNS fois depuis le même état ; meilleure de cinq séries
+    Sweep measureStep(const PhysicsSystem &physics, const PhysicsBody &start, VoxelAccessor &voxels,
+                      ash::Vector<VoxelType> &sweepVoxels) {
+        PhysicsBody body = start;
+        const bench::Timing timing = bench::measure(5, [&] {
+            for (int run = 0; run < RUNS; ++run) {
+                body = start;
+                physics.step(body, DELTA_TIME, voxels, sweepVoxels);
+            }
+        });
+        return {timing.bestMs * 1e6 / RUNS, body.position};
+    }
+}
+
+// Un corps lancé sur x vers un mur plein, à 1, 4, 16, 32 ou 64 blocs par pas.
+// Balayage par tranches (layerSweepDistance par défaut) contre le parcours de tout le volume balayé
+int main() {
+    World world(nullptr);
+    world.fillBox({{WALL_X, 0, 0}, {WALL_X, 63, 63}}, VoxelID::STONE);
+    bench::waitForWorkers(world);
+
+    const PhysicsConfig sliced;
+    PhysicsConfig full = sliced;
+    full.layerSweepDistance = 1e9f;
+
+    const PhysicsSystem slicedPhysics(sliced);
+    const PhysicsSystem fullPhysics(full);
+    VoxelAccessor voxels(world);
+    ash::Vector<VoxelType> sweepVoxels;
+
+    std::printf("Swept collision: sliced from %.0f blocks per step against a full scan, ns per step\n",
+                sliced.layerSweepDistance);
+    for (const float size: {0.98f, 3.0f}) {
+        for (const float motion: {1.0f, 4.0f, 16.0f, 32.0f, 64.0f}) {
+            for (const float distance: {0.5f, motion * 0.5f, 1000.0f}) {
+                PhysicsBody start;
+                start.size = glm::vec3(size);
+                start.useGravity = false;
+                start.position = glm::vec3(WALL_X - distance - size * 0.5f, 10.0f + size * 0.5f, 10.0f + size * 0.5f);
+                start.velocity = glm::vec3(motion / DELTA_TIME, 0.0f, 0.0f);
+
+                const Sweep fullSweep = measureStep(fullPhysics, start, voxels, sweepVoxels);
+                const Sweep slicedSweep = measureStep(slicedPhysics, start, voxels, sweepVoxels);
+                const char *wall = distance > 999.0f ? "none" : distance < 1.0f ? "near" : "half";
+                std::printf("  size %.2f, %5.1f blocks, wall %s: full %6.0f, sliced %6.0f, x%.2f %s\n", size, motion,
+                            wall, fullSweep.nanoseconds, slicedSweep.nanoseconds,
+                            fullSweep.nanoseconds / slicedSweep.nanoseconds,
+                            fullSweep.position == slicedSweep.position ? "same" : "DIFFERENT");
+            }
+        }
+    }
+    return 0;
+}
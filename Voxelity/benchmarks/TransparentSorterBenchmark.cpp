@@ -0,0 +1,77 @@
+#include <iostream>
+#include <random>
+
+#include "Bench.h"
+#include "Voxelity/voxelWorld/render/TransparentSorter.h"
+
+using namespace voxelity;
+
+namespace {
+    constexpr int RUNS = 200;
+
+    ash::Vector<FaceInstance> makeFaces(const size_t count, const uint32_t seed) {
+        std::mt19937 random(seed);
+        ash::Vector<FaceInstance> faces;
+        faces.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            faces.emplace_back(random() % 32, random() % 32, random() % 32, random() % 6, VoxelID::WATER,
+                               random() % 256);
+        }
+        return faces;
+    }
+
+    // Tris d'un chunk pendant une marche de la caméra le long de X, avec la réutilisation
+    // de ChunkInstanceBuffer::sortTransparent (tri gardé tant que needsResort est faux)
+    int countResorts(const glm::vec3 &chunkCenter, const float walk, const float step) {
+        int resorts = 0;
+        bool sorted = false;
+        glm::vec3 sortedFrom(0.0f);
+        for (float x = 0.0f; x <= walk; x += step) {
+            const glm::vec3 camera(x, 0.0f, 0.0f);
+            if (sorted && !TransparentSorter::needsResort(sortedFrom, camera, glm::length(chunkCenter - camera)))
+                continue;
+
+            sortedFrom = camera;
+            sorted = true;
+            ++resorts;
+        }
+        return resorts;
+    }
+}
+
+// Tri des faces transparentes d'un chunk (1 024 faces, et 16 384 : MAX_SORTED_FACES_PER_FRAME),
+// caméra déplacée d'un tri à l'autre, puis tri de 1 600 chunks. Nombre de tris évités ensuite
+// par needsResort sur une marche de 64 voxels
+int main() {
+    TransparentSorter sorter;
+    std::cout << "Transparent sorter, average of " << RUNS << " runs\n";
+    for (const size_t count: {size_t{1024}, size_t{16384}}) {
+        ash::Vector<FaceInstance> faces = makeFaces(count, 11);
+        int run = 0;
+        const bench::Timing timing = bench::measure(RUNS, [&] {
+            sorter.sortFaces(faces, glm::vec3(16.0f + static_cast<float>(run++ % 7), 20.0f, 16.0f));
+        });
+        std::cout << "  sortFaces: " << count << " faces in " << timing.averageMs << " ms (best "
+                << timing.bestMs << " ms)\n";
+    }
+
+    ash::Vector<ash::Own<Chunk> > storage;
+    ash::Vector<const Chunk *> chunks;
+    for (int x = -20; x < 20; ++x) {
+        for (int z = -20; z < 20; ++z) {
+            storage.push_back(std::make_unique<Chunk>(ChunkCoord(x, x & 3, z)));
+            chunks.push_back(storage.back().get());
+        }
+    }
+    int run = 0;
+    const bench::Timing timing = bench::measure(RUNS, [&] {
+        sorter.sortChunks(chunks, glm::vec3(static_cast<float>(run++ % 32), 40.0f, 0.0f), 1.0f);
+    });
+    std::cout << "  sortChunks: " << chunks.size() << " chunks in " << timing.averageMs << " ms (best "
+            << timing.bestMs << " ms)\n";
+
+    const int near = countResorts({16.0f, 0.0f, 16.0f}, 64.0f, 0.1f);
+    const int far = countResorts({16.0f, 0.0f, 400.0f}, 64.0f, 0.1f);
+    std::cout << "  resorts over a 64-voxel walk: " << near << " near, " << far << " at 400 voxels\n";
+    return 0;
+}
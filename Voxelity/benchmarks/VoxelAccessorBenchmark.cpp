@@ -0,0 +1,122 @@
+#include <cmath>
+#include <iostream>
+
+#include "Bench.h"
+#include "Voxelity/voxelWorld/world/VoxelAccessor.h"
+
+using namespace voxelity;
+
+namespace {
+    constexpr int SIDE = 4 * VoxelArray::SIZE;
+    constexpr int GROUND = 40;
+    constexpr int RAY_COUNT = 20000;
+    constexpr int RAY_LENGTH = 96; // Cellules traversées au plus par rayon
+
+    constexpr glm::ivec3 NEIGHBORS[6] = {{1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}};
+
+    // Voisins pleins de chaque voxel du bloc, comme le mesher ou la lumière
+    template<typename Read>
+    size_t scanNeighbors(Read &&read) {
+        size_t solid = 0;
+        for (int y = 1; y < SIDE - 1; ++y) {
+            for (int z = 1; z < SIDE - 1; ++z) {
+                for (int x = 1; x < SIDE - 1; ++x) {
+                    for (const auto &offset: NEIGHBORS)
+                        solid += read(x + offset.x, y + offset.y, z + offset.z) != VoxelID::AIR;
+                }
+            }
+        }
+        return solid;
+    }
+
+    // DDA de VoxelRaycaster, réduit à la traversée : seule la lecture des voxels change d'une mesure à l'autre
+    template<typename Read>
+    size_t castRay(const glm::vec3 &origin, const glm::vec3 &direction, Read &&read) {
+        glm::ivec3 cell = glm::ivec3(glm::floor(origin));
+        const glm::vec3 deltaDist = glm::abs(1.0f / direction);
+        const glm::ivec3 step = glm::ivec3(glm::sign(direction));
+        glm::vec3 sideDist;
+        for (int axis = 0; axis < 3; ++axis) {
+            sideDist[axis] = direction[axis] < 0
+                                 ? (origin[axis] - static_cast<float>(cell[axis])) * deltaDist[axis]
+                                 : (static_cast<float>(cell[axis] + 1) - origin[axis]) * deltaDist[axis];
+        }
+
+        for (size_t visited = 1; visited <= RAY_LENGTH; ++visited) {
+            if (read(cell.x, cell.y, cell.z) != VoxelID::AIR) return visited;
+
+            int axis = sideDist.x < sideDist.y ? 0 : 1;
+            if (sideDist.z < sideDist[axis]) axis = 2;
+            sideDist[axis] += deltaDist[axis];
+            cell[axis] += step[axis];
+        }
+        return RAY_LENGTH;
+    }
+
+    // Rayons descendants depuis le dessus du bloc, directions pseudo-aléatoires fixes.
+    // cast(origin, direction) lance un rayon et renvoie le nombre de cellules traversées
+    template<typename Cast>
+    size_t castRays(Cast &&cast) {
+        size_t visited = 0;
+        for (int ray = 0; ray < RAY_COUNT; ++ray) {
+            const float angle = static_cast<float>(ray) * 2.3999632f; // Angle d'or
+            const float tilt = 0.2f + 0.7f * static_cast<float>(ray % 97) / 97.0f;
+            const glm::vec3 origin(SIDE * 0.5f + 0.5f, SIDE - 1.5f, SIDE * 0.5f + 0.5f);
+            const glm::vec3 direction = glm::normalize(
+                glm::vec3(std::cos(angle) * tilt, -1.0f, std::sin(angle) * tilt));
+            visited += cast(origin, direction);
+        }
+        return visited;
+    }
+}
+
+// 4 × 4 × 4 chunks : pierre jusqu'à y = 39, un pilier tous les 7 blocs au-dessus, de l'air ensuite.
+// World::getVoxel (table de hachage du ChunkManager à chaque lecture) contre VoxelAccessor
+// (voisinage de chunks en cache), sur un parcours des 6 voisins de chaque voxel et sur 20 000 rayons
+int main() {
+    constexpr int RUNS = 5;
+
+    World world(nullptr);
+    world.fillBox({{0, 0, 0}, {SIDE - 1, GROUND - 1, SIDE - 1}}, VoxelID::STONE);
+    for (int z = 0; z < SIDE; z += 7) {
+        for (int x = 0; x < SIDE; x += 7)
+            world.fillBox({{x, GROUND, z}, {x, GROUND + (x + z) % 40, z}}, VoxelID::STONE);
+    }
+    bench::waitForWorkers(world);
+
+    size_t worldCount = 0;
+    size_t accessorCount = 0;
+    const auto readWorld = [&](const int x, const int y, const int z) { return world.getVoxel(x, y, z); };
+
+    const bench::Timing worldScan = bench::measure(RUNS, [&] { worldCount = scanNeighbors(readWorld); });
+    const bench::Timing accessorScan = bench::measure(RUNS, [&] {
+        VoxelAccessor voxels(world);
+        accessorCount = scanNeighbors([&](const int x, const int y, const int z) { return voxels.get(x, y, z); });
+    });
+    if (worldCount != accessorCount) std::cout << "neighbour scan results differ\n";
+
+    const bench::Timing worldRays = bench::measure(RUNS, [&] {
+        worldCount = castRays([&](const glm::vec3 &origin, const glm::vec3 &direction) {
+            return castRay(origin, direction, readWorld);
+        });
+    });
+    const bench::Timing accessorRays = bench::measure(RUNS, [&] {
+        accessorCount = castRays([&](const glm::vec3 &origin, const glm::vec3 &direction) {
+            VoxelAccessor voxels(world); // Un accessor par rayon, comme VoxelRaycaster
+            return castRay(origin, direction, [&](const int x, const int y, const int z) {
+                return voxels.get(x, y, z);
+            });
+        });
+    });
+    if (worldCount != accessorCount) std::cout << "raycast results differ\n";
+
+    const double scanReads = 6.0 * (SIDE - 2) * (SIDE - 2) * (SIDE - 2);
+    std::cout << "VoxelAccessor: " << world.getLoadedChunkCount() << " chunks, best of " << RUNS << " runs\n"
+            << "  neighbour scan (" << scanReads / 1e6 << " M reads): World::getVoxel " << worldScan.bestMs
+            << " ms, VoxelAccessor " << accessorScan.bestMs << " ms, speedup "
+            << worldScan.bestMs / accessorScan.bestMs << "x\n"
+            << "  raycasts (" << RAY_COUNT << " rays, " << worldCount << " cells): World::getVoxel "
+            << worldRays.bestMs << " ms, VoxelAccessor " << accessorRays.bestMs << " ms, speedup "
+            << worldRays.bestMs / accessorRays.bestMs << "x\n";
+    return 0;
+}
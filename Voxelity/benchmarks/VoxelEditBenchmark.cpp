@@ -0,0 +1,58 @@
+#include <cstdio>
+
+#include "Bench.h"
+
+using namespace voxelity;
+
+namespace {
+    // Une passe d'écriture : chronométrée, puis les threads de lumière et de mesh vident leurs files
+    template<typename Func>
+    double timeEdit(const World &world, Func &&func) {
+        const auto start = bench::Clock::now();
+        func();
+        const double ms = bench::elapsedMs(start);
+        bench::waitForWorkers(world);
+        return ms;
+    }
+}
+
+// 10⁴, 10⁵ puis 10⁶ voxels d'une boîte de 100 × h × 100 posée sur des chunks déjà chargés :
+// un setVoxel par voxel, un seul setVoxels, puis fillBox. Chaque passe change toutes les cellules
+int main() {
+    constexpr int SIDE = 100;
+
+    World world(nullptr);
+    world.fillBox({{0, 0, 0}, {SIDE - 1, SIDE - 1, SIDE - 1}}, VoxelID::STONE);
+    bench::waitForWorkers(world);
+
+    std::printf("Voxel edits over %zu chunks, ms and million edits per second\n", world.getLoadedChunkCount());
+    for (const int height: {1, 10, 100}) {
+        const ash::BBox3i box{{0, 0, 0}, {SIDE - 1, height - 1, SIDE - 1}};
+        const size_t count = World::getRegionVolume(box);
+
+        const double singleMs = timeEdit(world, [&] {
+            for (int y = 0; y < height; ++y) {
+                for (int z = 0; z < SIDE; ++z) {
+                    for (int x = 0; x < SIDE; ++x)
+                        world.setVoxel(x, y, z, VoxelID::DIRT);
+                }
+            }
+        });
+
+        ash::Vector<VoxelEdit> edits;
+        edits.reserve(count);
+        for (int y = 0; y < height; ++y) {
+            for (int z = 0; z < SIDE; ++z) {
+                for (int x = 0; x < SIDE; ++x)
+                    edits.push_back({{x, y, z}, VoxelID::SAND});
+            }
+        }
+        const double batchMs = timeEdit(world, [&] { world.setVoxels(edits); });
+        const double fillMs = timeEdit(world, [&] { world.fillBox(box, VoxelID::STONE); });
+
+        const auto rate = [count](const double ms) { return static_cast<double>(count) / ms / 1000.0; };
+        std::printf("  %7zu edits: setVoxel %8.1f ms (%5.2f), setVoxels %7.1f ms (%5.2f), fillBox %6.1f ms (%6.2f)\n",
+                    count, singleMs, rate(singleMs), batchMs, rate(batchMs), fillMs, rate(fillMs));
+    }
+    return 0;
+}
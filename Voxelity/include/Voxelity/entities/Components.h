@@ -0,0 +1,72 @@
+#ifndef VOXELITY_COMPONENTS_H
+#define VOXELITY_COMPONENTS_H
+
+#include <glm/glm.hpp>
+
+#include "Ashen/Math/BBox.h"
+
+#include "Voxelity/voxelWorld/voxel/VoxelType.h"
+
+namespace voxelity {
+    class Player;
+
+    // Position au tick courant et au précédent, pour l'interpolation du rendu
+    struct Transform {
+        glm::vec3 position{0.0f};
+        glm::vec3 rotation{0.0f};
+        glm::vec3 previousPosition{0.0f};
+        glm::vec3 previousRotation{0.0f};
+
+        void saveState() {
+            previousPosition = position;
+            previousRotation = rotation;
+        }
+
+        [[nodiscard]] glm::vec3 getInterpolatedPosition(const float alpha) const {
+            return glm::mix(previousPosition, position, alpha);
+        }
+
+        [[nodiscard]] glm::vec3 getInterpolatedRotation(const float alpha) const {
+            return glm::mix(previousRotation, rotation, alpha);
+        }
+    };
+
+    struct Motion {
+        glm::vec3 velocity{0.0f};
+        bool onGround = false;
+    };
+
+    // Boîte centrée sur Transform::position
+    struct Collider {
+        glm::vec3 size{1.0f};
+        bool useGravity = true;
+        bool hasCollisions = true;
+
+        [[nodiscard]] ash::BBox3 getBounds(const glm::vec3 &position) const {
+            return {position - size * 0.5f, position + size * 0.5f};
+        }
+    };
+
+    // Physique avancée en lot par le PhysicsWorld
+    struct RigidBody {
+        uint32_t config = 0; // Indice retourné par PhysicsWorld::addConfig
+        uint32_t restTicks = 0; // Pas consécutifs au repos
+    };
+
+    // Corps immobile retiré du pas physique (voir PhysicsWorld)
+    struct Sleeping {
+    };
+
+    struct FallingBlock {
+        VoxelType type = VoxelID::DIRT;
+        float age = 0.0f;
+        float lifetime = 5.0f; // Retiré au-delà, même sans avoir atterri
+    };
+
+    // Entité pilotée par les entrées d'un joueur
+    struct PlayerControl {
+        Player *player = nullptr;
+    };
+}
+
+#endif //VOXELITY_COMPONENTS_H
@@ -1,77 +1,108 @@
 #ifndef VOXELITY_ENTITYMANAGER_H
 #define VOXELITY_ENTITYMANAGER_H
 
-#include <algorithm>
-
 #include "Ashen/Core/Types.h"
-#include "Voxelity/entities/Entity.h"
+#include "Ashen/ECS/Query.h"
+#include "Ashen/ECS/Registry.h"
+#include "Ashen/ECS/Scheduler.h"
+
+#include "Voxelity/entities/Components.h"
+#include "Voxelity/entities/EntitySpatialHash.h"
+#include "Voxelity/systems/PhysicsWorld.h"
 
 namespace voxelity {
     class World;
 
+    // Entités du monde dans un Registry à archétypes ; leur logique est découpée en systèmes
+    // (joueurs, physique, blocs en chute, grille spatiale) ordonnés par le Scheduler selon
+    // les composants qu'ils lisent et écrivent.
     class EntityManager {
     public:
-        EntityManager() = default;
+        EntityManager();
 
         ~EntityManager() = default;
 
-        template<typename T, typename... Args>
-        T *createEntity(Args &&... args) {
-            static_assert(std::is_base_of_v<Entity, T>, "T must derive from Entity");
-            auto entity = ash::MakeOwn<T>(std::forward<Args>(args)...);
-            T *ptr = entity.get();
-            m_entities.push_back(std::move(entity));
-            return ptr;
-        }
+        EntityManager(const EntityManager &) = delete;
 
-        void removeEntity(Entity *entity) {
-            std::erase_if(m_entities, [entity](const std::unique_ptr<Entity> &e) { return e.get() == entity; });
-        }
+        EntityManager &operator=(const EntityManager &) = delete;
 
-        // Mise à jour physique (fixed timestep)
-        void updateAll(const float deltaTime, const World &world) {
-            std::erase_if(m_entities, [](const std::unique_ptr<Entity> &e) { return !e->isActive; });
+        // Transform, Motion et Collider, rangée dans la grille spatiale ; physique à la charge de l'appelant
+        ash::EntityId createBody(const glm::vec3 &position, const Collider &collider);
 
-            for (const auto &entity: m_entities) {
-                if (entity->isActive) {
-                    entity->update(deltaTime, world);
-                }
-            }
-        }
+        // Bloc détaché avancé par le PhysicsWorld, reposé dans le monde à l'atterrissage
+        ash::EntityId spawnFallingBlock(const glm::vec3 &position, VoxelType type, float lifetime = 5.0f);
 
-        const ash::Vector<ash::Own<Entity> > &getEntities() const { return m_entities; }
-        size_t getEntityCount() const { return m_entities.size(); }
-
-        template<typename T>
-        T *findEntity() {
-            static_assert(std::is_base_of_v<Entity, T>, "T must derive from Entity");
-            for (auto &entity: m_entities) {
-                if (T *typed = dynamic_cast<T *>(entity.get())) {
-                    return typed;
-                }
-            }
-            return nullptr;
-        }
+        // Destruction différée à la fin du tick : l'entité reste valide pour les systèmes restants.
+        // Thread principal ou système exclusif uniquement
+        void destroyEntity(ash::EntityId entity);
 
-        template<typename T>
-        ash::Vector<T *> findAllEntities() {
-            static_assert(std::is_base_of_v<Entity, T>, "T must derive from Entity");
-            ash::Vector<T *> result;
-            for (auto &entity: m_entities) {
-                if (T *typed = dynamic_cast<T *>(entity.get())) {
-                    result.push_back(typed);
-                }
-            }
-            return result;
+        // Vrai jusqu'à la fin du tick pour une entité dont la destruction est demandée
+        [[nodiscard]] bool isAlive(const ash::EntityId entity) const { return m_registry.IsAlive(entity); }
+
+        // Mise à jour physique (fixed timestep) : un passage du Scheduler, puis les destructions demandées
+        void updateAll(float deltaTime, World &world);
+
+        ash::Registry &getRegistry() { return m_registry; }
+        const ash::Registry &getRegistry() const { return m_registry; }
+        size_t getEntityCount() const { return m_registry.GetEntityCount(); }
+
+        // Requêtes de proximité sur la grille, positions à la fin du dernier updateAll
+        void findEntitiesInRadius(const glm::vec3 &center, float radius, ash::Vector<ash::EntityId> &out) const {
+            out.clear();
+            m_spatial.queryRadius(center, radius, out);
         }
 
-        void clear() {
-            m_entities.clear();
+        void findEntitiesInBox(const ash::BBox3 &box, ash::Vector<ash::EntityId> &out) const {
+            out.clear();
+            m_spatial.queryBox(box, out);
         }
 
+        const EntitySpatialHash &getSpatialHash() const { return m_spatial; }
+
+        PhysicsWorld &getPhysicsWorld() { return m_physics; }
+        const PhysicsWorld &getPhysicsWorld() const { return m_physics; }
+
+        // Durées par système du dernier updateAll
+        const ash::Scheduler &getScheduler() const { return m_scheduler; }
+
+        // Détruit toutes les entités sauf le corps des joueurs (PlayerControl), dont l'identifiant reste valide
+        void clear();
+
     private:
-        ash::Vector<ash::Own<Entity> > m_entities;
+        struct Landing {
+            ash::EntityId entity;
+            glm::ivec3 position;
+            VoxelType type;
+        };
+
+        ash::Registry m_registry; // Déclaré en premier : les requêtes et le PhysicsWorld s'y réfèrent
+        PhysicsWorld m_physics;
+        EntitySpatialHash m_spatial;
+        ash::Scheduler m_scheduler;
+
+        World *m_world = nullptr; // Monde de l'updateAll en cours
+        uint32_t m_fallingBlockConfig;
+
+        ash::Query<Transform, Motion, const Collider, const PlayerControl> m_players;
+        ash::Query<FallingBlock, const Motion, const Transform> m_fallingBlocks;
+        ash::Query<const Transform, const Collider> m_moving; // Sans Sleeping
+
+        // Résultats des blocs en chute, appliqués au monde une fois les systèmes parallèles terminés
+        ash::Vector<Landing> m_landings;
+        ash::Vector<ash::EntityId> m_expired;
+
+        ash::Vector<ash::EntityId> m_pendingDestroy;
+
+        void updatePlayers(float deltaTime);
+
+        void updateFallingBlocks(float deltaTime);
+
+        void updateSpatialHash();
+
+        void applyFallingBlocks();
+
+        void flushDestroyed();
     };
 }
 
-#endif //VOXELITY_ENTITYMANAGER_H
\ No newline at end of file
+#endif //VOXELITY_ENTITYMANAGER_H
@@ -0,0 +1,99 @@
+#ifndef VOXELITY_ENTITYSPATIALHASH_H
+#define VOXELITY_ENTITYSPATIALHASH_H
+
+#include <glm/glm.hpp>
+
+#include "Ashen/Core/Types.h"
+#include "Ashen/ECS/EntityId.h"
+#include "Ashen/Math/BBox.h"
+
+namespace voxelity {
+    // Grille creuse de cellules cubiques : chaque entité est rangée dans la cellule du centre de sa boîte.
+    // Les requêtes élargissent leur zone de la plus grande demi-taille d'entité rencontrée, une boîte
+    // qui déborde sur les cellules voisines est donc toujours trouvée.
+    // Thread principal uniquement.
+    class EntitySpatialHash {
+    public:
+        struct Entry {
+            ash::EntityId entity;
+            ash::BBox3 bounds; // Au dernier insert / update
+        };
+
+        // 16 blocs : une requête de rayon 8 couvre 2 à 3 cellules par axe
+        static constexpr float DEFAULT_CELL_SIZE = 16.0f;
+
+        explicit EntitySpatialHash(float cellSize = DEFAULT_CELL_SIZE);
+
+        void insert(ash::EntityId entity, const ash::BBox3 &bounds);
+
+        void remove(ash::EntityId entity);
+
+        // Bornes rafraîchies ; l'entité ne change de cellule que si son centre en sort
+        void update(ash::EntityId entity, const ash::BBox3 &bounds);
+
+        void clear();
+
+        // Entités dont la boîte est à moins de radius de center
+        void queryRadius(const glm::vec3 &center, float radius, ash::Vector<ash::EntityId> &out) const;
+
+        // Entités dont la boîte touche box
+        void queryBox(const ash::BBox3 &box, ash::Vector<ash::EntityId> &out) const;
+
+        // func(const Entry &) pour chaque entité d'une cellule touchant box, sans filtrage
+        template<typename Func>
+        void forEachNear(const ash::BBox3 &box, Func &&func) const {
+            const glm::ivec3 min = getCell(box.min - m_maxHalfExtent);
+            const glm::ivec3 max = getCell(box.max + m_maxHalfExtent);
+
+            for (int y = min.y; y <= max.y; ++y) {
+                for (int z = min.z; z <= max.z; ++z) {
+                    for (int x = min.x; x <= max.x; ++x) {
+                        const auto it = m_cells.find(glm::ivec3(x, y, z));
+                        if (it == m_cells.end()) continue;
+
+                        for (const Entry &entry: it->second)
+                            func(entry);
+                    }
+                }
+            }
+        }
+
+        // func(const Entry &) pour chaque entité rangée
+        template<typename Func>
+        void forEach(Func &&func) const {
+            for (const auto &[cell, entries]: m_cells) {
+                for (const Entry &entry: entries)
+                    func(entry);
+            }
+        }
+
+        glm::ivec3 getCell(const glm::vec3 &position) const;
+
+        float getCellSize() const { return m_cellSize; }
+        size_t size() const { return m_locations.size(); }
+        size_t getCellCount() const { return m_cells.size(); }
+
+    private:
+        struct CellHash {
+            size_t operator()(const glm::ivec3 &cell) const { return ash::HashCoord3(cell.x, cell.y, cell.z); }
+        };
+
+        struct Location {
+            glm::ivec3 cell{0};
+            uint32_t index = 0;
+        };
+
+        float m_cellSize;
+        float m_inverseCellSize;
+        glm::vec3 m_maxHalfExtent{0.0f}; // Ne fait que croître
+
+        ash::FlatHashMap<glm::ivec3, ash::Vector<Entry>, CellHash> m_cells;
+        ash::FlatHashMap<ash::EntityId, Location> m_locations;
+
+        void add(ash::EntityId entity, const ash::BBox3 &bounds);
+
+        void erase(const Location &location);
+    };
+}
+
+#endif //VOXELITY_ENTITYSPATIALHASH_H
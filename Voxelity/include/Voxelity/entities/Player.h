@@ -1,23 +1,42 @@
 #ifndef VOXELITY_PLAYER_H
 #define VOXELITY_PLAYER_H
 
-#include "Entity.h"
-
 #include "Ashen/Core/Types.h"
+#include "Ashen/ECS/EntityId.h"
 #include "Ashen/Graphics/Cameras/Camera.h"
+#include "Voxelity/entities/Components.h"
 #include "Voxelity/player/PlayerController.h"
 #include "Voxelity/systems/PhysicsSystem.h"
 
 namespace voxelity {
-    class Player final : public Entity {
+    class EntityManager;
+
+    // Entrées et caméra du joueur. Son état physique vit dans les composants d'une entité
+    // (PlayerControl la rattache au joueur) ; sa physique reste propre au joueur pour le mode vol
+    class Player {
     public:
-        explicit Player(ash::Ref<ash::PerspectiveCamera> camera);
+        Player(EntityManager &entities, ash::Ref<ash::PerspectiveCamera> camera);
+
+        ~Player();
+
+        Player(const Player &) = delete;
+
+        Player &operator=(const Player &) = delete;
 
-        void update(float deltaTime, const World &world) override;
+        // Appelée par le système des joueurs à chaque tick
+        void update(float deltaTime, const World &world, Transform &transform, Motion &motion,
+                    const Collider &collider);
 
         // Mise à jour visuelle avec interpolation (appelée chaque frame)
         void updateVisuals(float alpha);
 
+        ash::EntityId getEntity() const { return m_entity; }
+
+        glm::vec3 getPosition() const;
+
+        // Téléportation : pas d'interpolation depuis l'ancienne position
+        void setPosition(const glm::vec3 &position);
+
         // Gestion du contrôleur
         PlayerController &getController() { return *m_controller; }
         const PlayerController &getController() const { return *m_controller; }
@@ -26,7 +45,7 @@ namespace voxelity {
         ash::Ref<ash::PerspectiveCamera> getCamera() const { return m_camera; }
 
         // Actions
-        void jump();
+        void jump(Motion &motion) const;
 
         // Configuration
         void setJumpForce(const float force) { m_jumpForce = force; }
@@ -37,6 +56,9 @@ namespace voxelity {
         bool isFlying() const { return m_isFlying; }
 
     private:
+        EntityManager &m_entities;
+        ash::EntityId m_entity;
+
         ash::Ref<ash::PerspectiveCamera> m_camera;
         ash::Own<PlayerController> m_controller;
         ash::Own<PhysicsSystem> m_physics;
@@ -47,8 +69,8 @@ namespace voxelity {
 
         void updateCameraPosition(float alpha) const;
 
-        void handleMovement(float deltaTime);
+        void handleMovement(Motion &motion) const;
     };
 }
 
-#endif //VOXELITY_PLAYER_H
\ No newline at end of file
+#endif //VOXELITY_PLAYER_H
@@ -18,11 +18,16 @@ namespace voxelity {
     struct WorldConfig {
         int renderDistance = 8;
         int renderHeight = 2;
+        int lodLevels = 3; // Niveaux grossiers (2×, 4×, 8×) au-delà de renderDistance, 0 : désactivé
 
         // Fixed timestep Minecraft-style (20 ticks/second)
         float tickRate = 20.0f; // 20 TPS comme Minecraft
         float fixedDeltaTime = 1.0f / 20.0f; // 0.05s par tick
         int maxTicksPerFrame = 10; // Limite pour éviter spiral of death
+
+        // Dossier des fichiers de région (vide : pas de sauvegarde)
+        std::string saveDirectory = "saves/world";
+        float autosaveInterval = 60.0f; // Secondes entre deux sauvegardes automatiques (0 : désactivée)
     };
 
     class VoxelWorldLayer final : public ash::Layer {
@@ -54,13 +59,14 @@ namespace voxelity {
 
         // Fixed timestep accumulator
         float m_tickAccumulator = 0.0f;
+        float m_autosaveTimer = 0.0f;
 
         // Systèmes principaux
         ash::Own<World> m_world;
         ash::Own<WorldRenderer> m_worldRenderer;
         ash::Own<WorldInteractor> m_worldInteractor;
         ash::Own<EntityManager> m_entityManager;
-        Player *m_player; // Géré par EntityManager
+        ash::Own<Player> m_player; // Après m_entityManager : son entité est détruite avant lui
         ash::Own<InputHandler> m_inputHandler;
 
         // Caméra et shaders
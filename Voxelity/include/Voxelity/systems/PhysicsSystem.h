@@ -4,11 +4,14 @@
 #include <glm/glm.hpp>
 
 #include "Ashen/Core/Types.h"
-#include "Voxelity/entities/Entity.h"
+#include "Ashen/ECS/EntityId.h"
+#include "Ashen/Math/BBox.h"
 #include "Voxelity/voxelWorld/voxel/VoxelType.h"
 
 namespace voxelity {
     class World;
+    class VoxelAccessor;
+    class EntitySpatialHash;
 
     struct CollisionInfo {
         glm::ivec3 blockPos;
@@ -22,31 +25,30 @@ namespace voxelity {
         }
     };
 
+    // Contact le plus proche d'un balayage sur un axe
     struct CollisionResult {
         bool hasCollision = false;
-        ash::Vector<CollisionInfo> collisions;
-        glm::vec3 totalPenetration{0.0f};
-
-        void addCollision(const CollisionInfo &info) {
-            collisions.push_back(info);
-            hasCollision = true;
-        }
+        CollisionInfo closest;
+    };
 
-        void clear() {
-            collisions.clear();
-            totalPenetration = glm::vec3(0.0f);
-            hasCollision = false;
+    // État physique d'un corps, recopié depuis les composants d'une entité le temps d'un pas
+    struct PhysicsBody {
+        glm::vec3 position{0.0f};
+        glm::vec3 velocity{0.0f};
+        glm::vec3 size{1.0f};
+        bool useGravity = true;
+        bool hasCollisions = true;
+        bool onGround = false;
+
+        [[nodiscard]] ash::BBox3 getBoundingBox() const {
+            return {position - size * 0.5f, position + size * 0.5f};
         }
+    };
 
-        ash::Vector<CollisionInfo> getCollisionsOnAxis(const int axis) const {
-            ash::Vector<CollisionInfo> result;
-            for (const auto &col: collisions) {
-                if (col.axis == axis) {
-                    result.push_back(col);
-                }
-            }
-            return result;
-        }
+    // Deux entités dont les boîtes se touchent, first.index < second.index
+    struct EntityPair {
+        ash::EntityId first;
+        ash::EntityId second;
     };
 
     struct PhysicsConfig {
@@ -57,6 +59,9 @@ namespace voxelity {
         float airDrag = 0.98f; // Air resistance: 0.98 (vertical)
         float horizontalAirDrag = 0.91f; // Air resistance: 0.91 (horizontal)
         float collisionEpsilon = 0.001f;
+        float layerSweepDistance = 32.0f; // Mouvement par pas et par axe (blocs) à partir duquel on balaie par tranches
+        float sleepVelocity = 0.05f; // Vitesse (blocs/s) sous laquelle un corps est au repos
+        uint32_t sleepTicks = 20; // Pas consécutifs au repos avant endormissement (0 : jamais)
         bool useMaterialProperties = true;
     };
 
@@ -64,28 +69,67 @@ namespace voxelity {
     public:
         explicit PhysicsSystem(const PhysicsConfig &config = PhysicsConfig());
 
-        void step(Entity &entity, float deltaTime, const World &world) const;
+        // Corps isolé (joueur) : accesseur local et tampon de balayage du système
+        void step(PhysicsBody &body, float deltaTime, const World &world) const;
+
+        // Pas d'un corps isolé : accesseur et tampon de balayage fournis par l'appelant,
+        // un jeu par thread (le système lui-même n'est pas modifié)
+        void step(PhysicsBody &body, float deltaTime, VoxelAccessor &voxels,
+                  ash::Vector<VoxelType> &sweepVoxels) const;
+
+        // Phase large entité contre entité : chaque paire qui se chevauche une seule fois, sur les bornes
+        // connues de la grille (la résolution des contacts reste à l'appelant)
+        static void findEntityPairs(const EntitySpatialHash &entities, ash::Vector<EntityPair> &pairs);
 
         void setConfig(const PhysicsConfig &config) { m_config = config; }
         const PhysicsConfig &getConfig() const { return m_config; }
 
     private:
+        static constexpr int FIRST_SLICE_LAYERS = 4; // Épaisseur doublée à chaque tranche suivante
+        static constexpr size_t MAX_STEP_REGION_VOLUME = 512; // Au-delà, chaque axe copie sa propre plage
+
+        // Plage de voxels copiée une fois pour les trois axes d'un pas, dans le tampon de balayage
+        struct StepRegion {
+            glm::ivec3 min{0};
+            glm::ivec3 max{0};
+            bool valid = false; // Faux si absente, ou écrasée par la copie propre à un axe
+
+            bool contains(const glm::ivec3 &rangeMin, const glm::ivec3 &rangeMax) const {
+                return valid && glm::all(glm::greaterThanEqual(rangeMin, min)) &&
+                       glm::all(glm::lessThanEqual(rangeMax, max));
+            }
+        };
+
         PhysicsConfig m_config;
 
-        void integrate(Entity &entity, float deltaTime, const World &world) const;
+        // Tampon de step(PhysicsBody &, float, const World &), réutilisé d'un pas à l'autre (un seul thread)
+        mutable ash::Vector<VoxelType> m_sweepVoxels;
+
+        void integrate(PhysicsBody &body, float deltaTime) const;
+
+        glm::vec3 moveAndCollide(PhysicsBody &body, const glm::vec3 &motion, VoxelAccessor &voxels,
+                                 ash::Vector<VoxelType> &sweepVoxels) const;
 
-        glm::vec3 moveAndCollide(Entity &entity, const glm::vec3 &motion, const World &world) const;
+        // Petit mouvement : copie d'un bloc la plage que peuvent lire les balayages des trois axes
+        // (boîte de départ étendue du mouvement), pour ne payer qu'une fois la visite des chunks
+        void copyStepRegion(const ash::BBox3 &aabb, const glm::vec3 &motion, VoxelAccessor &voxels,
+                            ash::Vector<VoxelType> &sweepVoxels, StepRegion &stepRegion) const;
 
-        float sweepAxis(const ash::BBox3 &aabb, float motion, int axis,
-                        const World &world, CollisionResult &result) const;
+        // Parcourt sur place le volume balayé, lu dans la plage du pas s'il y tient, sinon copié d'un bloc,
+        // sans allocation une fois le tampon dimensionné. Mouvement rapide : tranches de couches parcourues
+        // dans l'ordre, chacune copiée seulement une fois atteinte, arrêt après la première touchée
+        float sweepAxis(const ash::BBox3 &aabb, float motion, int axis, VoxelAccessor &voxels,
+                        ash::Vector<VoxelType> &sweepVoxels, StepRegion &stepRegion, CollisionResult &result) const;
 
-        static void getBroadPhaseBlocks(const ash::BBox3 &aabb,
-                                        ash::Vector<glm::ivec3> &blocks,
-                                        const World &world);
+        // Contact le plus proche (plus proche que closestHit) parmi les voxels solides de [min, max],
+        // lus dans region, copie de [regionMin, regionMax]
+        static void scanRegion(const ash::BBox3 &aabb, float motion, int axis, const glm::ivec3 &min,
+                               const glm::ivec3 &max, const VoxelType *region, const glm::ivec3 &regionMin,
+                               const glm::ivec3 &regionMax, float &closestHit, CollisionResult &result);
 
-        void applyFriction(Entity &entity, float deltaTime, const World &world) const;
+        void applyFriction(PhysicsBody &body, float deltaTime, VoxelAccessor &voxels) const;
 
-        float getGroundFriction(const Entity &entity, const World &world) const;
+        float getGroundFriction(const PhysicsBody &body, VoxelAccessor &voxels) const;
     };
 }
 
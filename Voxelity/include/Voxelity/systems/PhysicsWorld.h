@@ -0,0 +1,83 @@
+#ifndef VOXELITY_PHYSICSWORLD_H
+#define VOXELITY_PHYSICSWORLD_H
+
+#include "Ashen/Core/Types.h"
+#include "Ashen/ECS/Query.h"
+
+#include "Voxelity/entities/Components.h"
+#include "Voxelity/entities/EntitySpatialHash.h"
+#include "Voxelity/systems/PhysicsSystem.h"
+
+namespace voxelity {
+    struct PhysicsWorldStats {
+        size_t bodies = 0;
+        size_t awake = 0;
+        size_t sleeping = 0;
+        double stepMs = 0.0;
+    };
+
+    // Pas physique groupé des entités portant Transform, Motion, Collider et RigidBody : les blocs
+    // de leurs archétypes sont répartis sur le JobSystem. Les corps ne touchent que les voxels :
+    // les blocs sont indépendants et lisent le monde sans le modifier.
+    // Un corps resté sleepTicks pas sous sleepVelocity reçoit Sleeping et n'est plus avancé ; il se
+    // réveille sur wake, au contact d'un corps en mouvement ou quand wakeRegion touche sa zone d'appui.
+    // Thread principal uniquement ; step ajoute et retire Sleeping, aucune Query ne doit être en cours.
+    class PhysicsWorld {
+    public:
+        static constexpr float SUPPORT_MARGIN = 1.0f; // Zone d'appui : boîte élargie d'un bloc
+        static constexpr float CONTACT_MARGIN = 0.01f; // Écart en deçà duquel deux corps se touchent
+        static constexpr float SLEEPER_CELL_SIZE = 4.0f; // Quelques corps par cellule, même dans un tas
+
+        explicit PhysicsWorld(ash::Registry &registry);
+
+        // Les corps d'une même configuration y font référence par l'indice retourné
+        uint32_t addConfig(const PhysicsConfig &config);
+
+        // Retire le corps de l'index des endormis ; à appeler avant de détruire l'entité
+        void removeBody(ash::EntityId entity);
+
+        [[nodiscard]] bool isSleeping(ash::EntityId entity) const;
+
+        // Impulsion ou téléportation : à appeler après avoir modifié Transform ou Motion du corps
+        void wake(ash::EntityId entity);
+
+        // Réveille les corps endormis dont la zone d'appui recoupe box (voxels, bornes incluses)
+        void wakeRegion(const ash::BBox3i &box);
+
+        void step(float deltaTime, const World &world);
+
+        // Oublie les corps endormis (entités détruites à part) ; les configurations restent enregistrées
+        void clear();
+
+        [[nodiscard]] size_t getBodyCount() const { return getAwakeCount() + getSleepingCount(); }
+        [[nodiscard]] size_t getAwakeCount() const { return m_awake.Count(); }
+        [[nodiscard]] size_t getSleepingCount() const { return m_sleeping.Count(); }
+        [[nodiscard]] const PhysicsWorldStats &getStats() const { return m_stats; }
+
+    private:
+        ash::Registry &m_registry;
+        ash::Vector<PhysicsSystem> m_systems;
+
+        ash::Query<Transform, Motion, const Collider, RigidBody> m_awake; // Sans Sleeping
+        ash::Query<const RigidBody, const Sleeping> m_sleeping;
+
+        // Corps endormis et leurs boîtes figées : un corps en mouvement ou une modification du monde
+        // ne teste que ses voisins proches
+        EntitySpatialHash m_sleepers{SLEEPER_CELL_SIZE};
+        ash::Vector<ash::EntityId> m_wakeQueue;
+        ash::Vector<ash::EntityId> m_sleepQueue;
+
+        PhysicsWorldStats m_stats;
+
+        ash::BBox3 getBounds(ash::EntityId entity) const;
+
+        void sleep(ash::EntityId entity);
+
+        // Met en file les corps endormis dont la boîte élargie de margin recoupe box
+        void queueSleepers(const ash::BBox3 &box, float margin);
+
+        void flushWakeQueue();
+    };
+}
+
+#endif //VOXELITY_PHYSICSWORLD_H
@@ -3,8 +3,13 @@
 
 #include <atomic>
 #include <mutex>
+#include <span>
+#include "Ashen/Core/Types.h"
 #include "Voxelity/voxelWorld/voxel/VoxelArray.h"
+#include "Voxelity/voxelWorld/voxel/LightArray.h"
+#include "Voxelity/voxelWorld/voxel/FluidArray.h"
 #include "Voxelity/voxelWorld/chunk/ChunkMesh.h"
+#include "Voxelity/voxelWorld/chunk/ChunkVisibility.h"
 #include "Ashen/GraphicsAPI/Shader.h"
 
 namespace voxelity {
@@ -28,6 +33,57 @@ namespace voxelity {
         }
     };
 
+    // Modification exprimée en coordonnées locales au chunk
+    struct LocalVoxelEdit {
+        uint8_t x, y, z;
+        VoxelType type;
+    };
+
+    // Résultat d'une modification groupée
+    struct ChunkEditResult {
+        int changedCount = 0;
+        uint8_t borderMask = 0; // Bit CubicDirection : une face du chunk a été modifiée
+        glm::ivec3 min{VoxelArray::SIZE}, max{-1}; // Boîte locale des cellules modifiées
+
+        bool changed() const { return changedCount > 0; }
+
+        void touch(const int x, const int y, const int z) {
+            ++changedCount;
+            min = glm::min(min, glm::ivec3(x, y, z));
+            max = glm::max(max, glm::ivec3(x, y, z));
+            if (z == VoxelArray::SIZE - 1) borderMask |= 1 << 0; // ZP
+            if (z == 0) borderMask |= 1 << 1; // ZN
+            if (x == VoxelArray::SIZE - 1) borderMask |= 1 << 2; // XP
+            if (x == 0) borderMask |= 1 << 3; // XN
+            if (y == VoxelArray::SIZE - 1) borderMask |= 1 << 4; // YP
+            if (y == 0) borderMask |= 1 << 5; // YN
+        }
+
+        void touchRow(const int minX, const int maxX, const int y, const int z, const int count) {
+            changedCount += count;
+            min = glm::min(min, glm::ivec3(minX, y, z));
+            max = glm::max(max, glm::ivec3(maxX, y, z));
+            if (z == VoxelArray::SIZE - 1) borderMask |= 1 << 0;
+            if (z == 0) borderMask |= 1 << 1;
+            if (maxX == VoxelArray::SIZE - 1) borderMask |= 1 << 2;
+            if (minX == 0) borderMask |= 1 << 3;
+            if (y == VoxelArray::SIZE - 1) borderMask |= 1 << 4;
+            if (y == 0) borderMask |= 1 << 5;
+        }
+    };
+
+    // Contenu persistant d'un chunk (décodé depuis le disque)
+    struct ChunkData {
+        VoxelArray voxels;
+        ash::Own<FluidArray> fluid; // nullptr : aucun liquide en écoulement
+    };
+
+    // Instantané en lecture seule, partagé avec le chunk jusqu'à sa prochaine modification
+    struct ChunkSnapshot {
+        ash::Ref<const VoxelArray> voxels;
+        ash::Ref<const FluidArray> fluid; // nullptr : aucun liquide en écoulement
+    };
+
     class Chunk {
     public:
         explicit Chunk(ChunkCoord coord);
@@ -44,45 +100,132 @@ namespace voxelity {
 
         void fill(VoxelType ID);
 
-        void markDirty();
+        // Remplace tout le contenu en une seule prise du verrou
+        void assign(const VoxelArray &voxels, const FluidArray *fluid = nullptr);
 
-        glm::ivec3 getPosition() const;
+        // Instantané cohérent en O(1) : les données sont partagées et copiées
+        // à la première écriture suivante (copie à l'écriture)
+        ChunkSnapshot snapshot() const;
+
+        // Modifications groupées : une seule prise du verrou pour tout le lot.
+        // applied reçoit les modifications qui ont réellement changé une cellule
+        ChunkEditResult setVoxels(std::span<const LocalVoxelEdit> edits,
+                                  ash::Vector<LocalVoxelEdit> *applied = nullptr);
+
+        // Applique func(x, y, z, actuel) -> nouveau sur la région locale [min, max] (bornes incluses)
+        template<typename Func>
+        ChunkEditResult editRegion(const glm::ivec3 &min, const glm::ivec3 &max, Func &&func);
+
+        // Copie ligne par ligne de la région locale [min, max] vers / depuis un tampon
+        // (X contigu, une ligne tous les rowStride voxels, une couche Y tous les layerStride)
+        void copyRegion(const glm::ivec3 &min, const glm::ivec3 &max,
+                        VoxelType *dst, size_t rowStride, size_t layerStride) const;
+
+        ChunkEditResult pasteRegion(const glm::ivec3 &min, const glm::ivec3 &max,
+                                    const VoxelType *src, size_t rowStride, size_t layerStride);
+
+        // Lumière (thread-safe, écrite par le LightEngine)
+        uint8_t getLight(int x, int y, int z) const;
+
+        uint8_t getSkyLight(int x, int y, int z) const;
+
+        uint8_t getBlockLight(int x, int y, int z) const;
 
-        // Upload de mesh (thread principal uniquement - OpenGL)
-        void uploadMesh(const ash::Vector<FaceInstance> &opaqueFaces,
-                        const ash::Vector<FaceInstance> &transparentFaces);
+        void setSkyLight(int x, int y, int z, uint8_t level);
 
-        // Rendu (thread principal uniquement)
-        void drawOpaque(const ash::ShaderProgram &shader) const;
+        void setBlockLight(int x, int y, int z, uint8_t level);
 
-        void drawTransparent(const ash::ShaderProgram &shader) const;
+        // Accès groupés (propagation) : verrou pris une fois, puis niveaux lus et écrits
+        // directement dans getLightData() tant qu'il est tenu
+        std::unique_lock<std::mutex> lockLight() const { return std::unique_lock(m_lightMutex); }
+
+        LightArray &getLightData() { return m_light; }
+        const LightArray &getLightData() const { return m_light; }
+
+        // État d'écoulement des liquides (voir FluidArray), remis à zéro à chaque modification du voxel.
+        // Alloué à la première écriture : les chunks sans fluide en mouvement n'en paient pas le coût.
+        uint8_t getFluidState(int x, int y, int z) const;
+
+        void setFluidState(int x, int y, int z, uint8_t state);
+
+        void markDirty();
+
+        // Contenu différent de la version sauvegardée (modifié ou jamais écrit sur disque)
+        bool isModified() const { return m_modified; }
+        void setModified(const bool modified) { m_modified = modified; }
+
+        glm::ivec3 getPosition() const;
+
+        // Thread principal, une fois les faces envoyées dans le ChunkInstanceBuffer, avec
+        // la connectivité des faces calculée en même temps que le mesh
+        void markMeshUploaded(const ChunkVisibility &visibility);
 
         bool isDirty() const { return m_dirty; }
         bool hasMesh() const { return m_hasMesh; }
 
+        // Thread principal uniquement
+        const ChunkVisibility &getVisibility() const { return m_visibility; }
+
     private:
         ChunkCoord m_position;
-        VoxelArray m_storage;
+        ash::Ref<VoxelArray> m_storage;
         mutable std::mutex m_storageMutex; // Pour lecture thread-safe
+        ash::Ref<FluidArray> m_fluid; // Protégé par m_storageMutex
 
-        ChunkMesh m_opaqueMesh;
-        ChunkMesh m_transparentMesh;
+        LightArray m_light;
+        mutable std::mutex m_lightMutex;
+
+        ChunkVisibility m_visibility;
 
         std::atomic<bool> m_dirty{true};
         std::atomic<bool> m_hasMesh{false};
+        std::atomic<bool> m_modified{false};
 
         static bool isInBounds(int x, int y, int z);
+
+        void markModified() {
+            m_modified = true;
+            markDirty();
+        }
+
+        // m_storageMutex doit être tenu. Copie les données encore partagées avec un instantané
+        void detachStorage();
+
+        void detachFluid();
+
+        void resetFluidState(int x, int y, int z);
     };
+
+    template<typename Func>
+    ChunkEditResult Chunk::editRegion(const glm::ivec3 &min, const glm::ivec3 &max, Func &&func) {
+        ChunkEditResult result; {
+            std::lock_guard lock(m_storageMutex);
+            for (int y = min.y; y <= max.y; ++y) {
+                for (int z = min.z; z <= max.z; ++z) {
+                    for (int x = min.x; x <= max.x; ++x) {
+                        const VoxelType current = m_storage->get(x, y, z);
+                        const VoxelType voxel = func(x, y, z, current);
+                        if (voxel == current) continue;
+
+                        if (!result.changed()) detachStorage();
+                        m_storage->set(x, y, z, voxel);
+                        resetFluidState(x, y, z);
+                        result.touch(x, y, z);
+                    }
+                }
+            }
+        }
+
+        if (result.changed()) markModified();
+        return result;
+    }
 }
 
 namespace std {
     template<>
     struct hash<voxelity::ChunkCoord> {
         size_t operator()(const voxelity::ChunkCoord &coord) const noexcept {
-            const size_t h1 = hash<int>{}(coord.x);
-            const size_t h2 = hash<int>{}(coord.y);
-            const size_t h3 = hash<int>{}(coord.z);
-            return h1 ^ h2 << 1 ^ h3 << 2;
+            return ash::HashCoord3(coord.x, coord.y, coord.z);
         }
     };
 }
@@ -16,34 +16,42 @@ namespace voxelity {
                 uint32_t z: 5;
                 uint32_t faceID: 3;
                 uint32_t voxelID: 8;
-                uint32_t _unused: 6;
+                uint32_t skyLight: 3; // Niveaux 0-15 réduits à 0-7
+                uint32_t blockLight: 3;
             };
         };
 
         FaceInstance() = default;
 
-        FaceInstance(const uint8_t x, const uint8_t y, const uint8_t z, const uint8_t faceID, const uint8_t voxelID) {
-            set(x, y, z, faceID, voxelID);
+        // light : valeur combinée d'un LightArray (ciel << 4 | bloc)
+        FaceInstance(const uint8_t x, const uint8_t y, const uint8_t z, const uint8_t faceID, const uint8_t voxelID,
+                     const uint8_t light = 0xF0) {
+            set(x, y, z, faceID, voxelID, light);
         }
 
-        explicit FaceInstance(const glm::ivec3 &pos, const uint8_t faceID, const uint8_t voxelID)
-            : FaceInstance(pos.x, pos.y, pos.z, faceID, voxelID) {
+        explicit FaceInstance(const glm::ivec3 &pos, const uint8_t faceID, const uint8_t voxelID,
+                              const uint8_t light = 0xF0)
+            : FaceInstance(pos.x, pos.y, pos.z, faceID, voxelID, light) {
         }
 
-        void set(const uint8_t _x, const uint8_t _y, const uint8_t _z, const uint8_t f, const uint8_t v) {
+        void set(const uint8_t _x, const uint8_t _y, const uint8_t _z, const uint8_t f, const uint8_t v,
+                 const uint8_t light = 0xF0) {
             data = 0;
             x = _x & 0x1F;
             y = _y & 0x1F;
             z = _z & 0x1F;
             faceID = f & 0x07;
             voxelID = v & 0xFF;
-            _unused = 0;
+            skyLight = light >> 5;
+            blockLight = (light & 0x0F) >> 1;
         }
     };
 
+    // Faces d'un mesh dans son propre VAO/VBO. Le buffer n'est réalloué que si les faces
+    // dépassent la capacité, arrondie à une puissance de deux (voir ChunkMeshPool)
     class ChunkMesh {
     public:
-        ChunkMesh();
+        explicit ChunkMesh(size_t capacity = 0);
 
         ~ChunkMesh() = default;
 
@@ -53,9 +61,14 @@ namespace voxelity {
 
         void uploadInstances(std::span<const FaceInstance> instances);
 
+        // Réalloue le buffer pour capacity faces (contenu perdu)
+        void reserve(size_t capacity);
+
         void draw() const;
 
         [[nodiscard]] size_t getInstanceCount() const { return m_instanceCount; }
+        [[nodiscard]] size_t getCapacity() const { return m_capacity; }
+        [[nodiscard]] size_t getBufferSize() const { return m_capacity * sizeof(FaceInstance); }
         [[nodiscard]] bool IsEmpty() const { return m_instanceCount == 0; }
 
     private:
@@ -64,6 +77,7 @@ namespace voxelity {
         ash::Ref<ash::VertexArray> m_vao;
         ash::Ref<ash::VertexBuffer> m_instanceBuffer;
         size_t m_instanceCount = 0;
+        size_t m_capacity = 0;
     };
 }
 
@@ -0,0 +1,77 @@
+#ifndef VOXELITY_CHUNKMESHPOOL_H
+#define VOXELITY_CHUNKMESHPOOL_H
+
+#include <array>
+#include <deque>
+#include <span>
+
+#include "Ashen/Core/Types.h"
+
+#include "Voxelity/voxelWorld/chunk/ChunkMesh.h"
+
+namespace voxelity {
+    struct ChunkMeshPoolStats {
+        size_t hits = 0; // Mesh libre réutilisé
+        size_t misses = 0; // Mesh créé ou agrandi
+        size_t residentBytes = 0; // Buffers de tous les meshes vivants (utilisés, en attente et libres)
+        size_t idleBytes = 0;
+        size_t pendingMeshes = 0;
+
+        double getHitRate() const {
+            const size_t total = hits + misses;
+            return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+        }
+    };
+
+    // Meshes réutilisés au lieu de recréer VAO et VBO à chaque chargement. Les meshes libres sont
+    // rangés par capacité (puissance de deux). Un mesh rendu n'est réutilisé ou détruit qu'après
+    // FRAMES_IN_FLIGHT frames, quand le GPU ne peut plus lire ses anciennes faces.
+    // Thread principal uniquement.
+    class ChunkMeshPool {
+    public:
+        static constexpr uint64_t FRAMES_IN_FLIGHT = 3;
+        static constexpr size_t MIN_CAPACITY = 256; // Faces
+
+        explicit ChunkMeshPool(size_t maxIdleBytes = 64u << 20);
+
+        ~ChunkMeshPool();
+
+        ChunkMeshPool(const ChunkMeshPool &) = delete;
+
+        ChunkMeshPool &operator=(const ChunkMeshPool &) = delete;
+
+        // Mesh contenant les faces données (nullptr si aucune face)
+        ash::Own<ChunkMesh> acquire(std::span<const FaceInstance> faces);
+
+        void release(ash::Own<ChunkMesh> mesh);
+
+        // Une fois par frame : les meshes rendus depuis FRAMES_IN_FLIGHT frames redeviennent
+        // disponibles, au-delà de maxIdleBytes ils sont détruits
+        void advanceFrame();
+
+        // Détruit les meshes libres ; ceux en attente suivent leur délai
+        void trim();
+
+        const ChunkMeshPoolStats &getStats() const { return m_stats; }
+
+    private:
+        static constexpr size_t BUCKET_COUNT = 32;
+
+        struct PendingMesh {
+            ash::Own<ChunkMesh> mesh;
+            uint64_t frame;
+        };
+
+        std::array<ash::Vector<ash::Own<ChunkMesh> >, BUCKET_COUNT> m_buckets; // Indice : log2(capacité)
+        std::deque<PendingMesh> m_pending; // Par frame croissante
+        uint64_t m_frame = 0;
+        size_t m_maxIdleBytes;
+        ChunkMeshPoolStats m_stats;
+
+        static size_t getBucket(size_t capacity);
+
+        void destroy(ash::Own<ChunkMesh> mesh);
+    };
+}
+
+#endif //VOXELITY_CHUNKMESHPOOL_H
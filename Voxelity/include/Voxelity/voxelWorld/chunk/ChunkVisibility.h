@@ -0,0 +1,46 @@
+#ifndef VOXELITY_CHUNKVISIBILITY_H
+#define VOXELITY_CHUNKVISIBILITY_H
+
+#include <cstdint>
+
+#include "Voxelity/voxelWorld/voxel/VoxelArray.h"
+
+namespace voxelity {
+    // Paires de faces d'un chunk reliées par des voxels non opaques (indices CubicDirection).
+    // Sert au cave culling : un chunk n'est vu à travers un voisin que si le regard
+    // peut entrer par une face et ressortir par une autre.
+    class ChunkVisibility {
+    public:
+        static constexpr int FACE_COUNT = 6;
+
+        // Par défaut tout est relié : un chunk pas encore meshé ne masque rien
+        ChunkVisibility() : m_connections(ALL_CONNECTED) {
+        }
+
+        bool isConnected(const int from, const int to) const {
+            return m_connections >> (from * FACE_COUNT + to) & 1;
+        }
+
+        void setConnected(int from, int to);
+
+        bool isOpaque() const { return m_connections == 0; }
+
+        static ChunkVisibility none() { return ChunkVisibility(0); }
+
+        // Remplissage par diffusion des voxels non opaques depuis les bords du chunk :
+        // chaque composante relie entre elles toutes les faces qu'elle touche
+        static ChunkVisibility compute(const VoxelArray &voxels);
+
+    private:
+        static constexpr uint64_t ALL_CONNECTED = (uint64_t{1} << FACE_COUNT * FACE_COUNT) - 1;
+
+        uint64_t m_connections; // Bit from * 6 + to, symétrique
+
+        explicit ChunkVisibility(const uint64_t connections) : m_connections(connections) {
+        }
+
+        void connectAll(uint8_t faceMask);
+    };
+}
+
+#endif //VOXELITY_CHUNKVISIBILITY_H
@@ -0,0 +1,38 @@
+#ifndef VOXELITY_COLUMNCACHE_H
+#define VOXELITY_COLUMNCACHE_H
+
+#include <mutex>
+#include <unordered_map>
+
+#include "Ashen/Core/Types.h"
+
+#include "Voxelity/voxelWorld/generation/GenerationStage.h"
+
+namespace voxelity {
+    class ITerrainGenerator;
+
+    // Cache thread-safe des données de colonne (heightmap, biomes)
+    // Tous les chunks d'une même colonne X/Z partagent le même ColumnData
+    class ColumnCache {
+    public:
+        explicit ColumnCache(ITerrainGenerator &generator);
+
+        ash::Ref<const ColumnData> getOrBuild(const ColumnCoord &coord);
+
+        // Ramène le cache à maxEntries colonnes en libérant d'abord les plus éloignées de center.
+        // Une colonne encore référencée (chunk en génération, LOD) n'est jamais libérée
+        void prune(const ColumnCoord &center, size_t maxEntries);
+
+        void clear();
+
+        size_t size();
+
+    private:
+        ITerrainGenerator &m_generator;
+
+        std::unordered_map<ColumnCoord, ash::Ref<const ColumnData> > m_columns;
+        std::mutex m_mutex;
+    };
+}
+
+#endif //VOXELITY_COLUMNCACHE_H
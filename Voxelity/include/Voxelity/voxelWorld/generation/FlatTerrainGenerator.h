@@ -9,13 +9,18 @@ namespace voxelity {
         explicit FlatTerrainGenerator(const uint32_t seed) : ITerrainGenerator(seed) {
         }
 
-        VoxelType generateVoxel(const glm::ivec3 &worldPos) override;
+        void buildColumn(ColumnData &column) override;
 
-        void generateChunk(Chunk &voxelChunk) override;
+        bool isChunkEmpty(const ChunkCoord &coord, const ColumnData &column) const override;
+
+    protected:
+        void generateDensity(GenerationContext &context) override;
+
+        void applySurface(GenerationContext &context) override;
 
     private:
         static constexpr int HEIGHT = 4;
     };
 }
 
-#endif //VOXELITY_FLATTERRAINGENERATOR_H
\ No newline at end of file
+#endif //VOXELITY_FLATTERRAINGENERATOR_H
@@ -0,0 +1,89 @@
+#ifndef VOXELITY_GENERATIONSTAGE_H
+#define VOXELITY_GENERATIONSTAGE_H
+
+#include <array>
+#include <cstdint>
+
+#include "Voxelity/voxelWorld/chunk/Chunk.h"
+
+namespace voxelity {
+    // Étapes de génération, exécutées dans cet ordre pour chaque chunk
+    enum class GenerationStage : uint8_t {
+        DENSITY = 0, // Forme du terrain (pierre / eau / air)
+        SURFACE = 1, // Règles de surface selon le biome
+        CARVERS = 2, // Cavernes
+        ORES = 3, // Minerais
+        FEATURES = 4, // Structures (arbres)
+        COUNT = 5
+    };
+
+    constexpr int GENERATION_STAGE_COUNT = static_cast<int>(GenerationStage::COUNT);
+
+    inline GenerationStage nextStage(const GenerationStage stage) {
+        return static_cast<GenerationStage>(static_cast<int>(stage) + 1);
+    }
+
+    // Ce qu'une étape attend des chunks voisins à la même hauteur, dans un rayon horizontal
+    // (en chunks) : qu'ils aient terminé l'étape requiredStage
+    struct StageDependency {
+        int radius = 0;
+        GenerationStage requiredStage = GenerationStage::DENSITY;
+    };
+
+    // Coordonnée d'une colonne de chunks (X, Z)
+    struct ColumnCoord {
+        int x, z;
+
+        bool operator==(const ColumnCoord &other) const {
+            return x == other.x && z == other.z;
+        }
+    };
+
+    // Données 2D partagées par tous les chunks d'une même colonne
+    struct ColumnData {
+        static constexpr int AREA = VoxelArray::SIZE * VoxelArray::SIZE;
+
+        ColumnCoord coord{0, 0};
+        std::array<int, AREA> heightMap{};
+        std::array<uint8_t, AREA> biomeMap{};
+
+        static int index(const int x, const int z) { return x + z * VoxelArray::SIZE; }
+
+        int getHeight(const int x, const int z) const { return heightMap[index(x, z)]; }
+        uint8_t getBiome(const int x, const int z) const { return biomeMap[index(x, z)]; }
+    };
+
+    // Contexte passé à chaque étape : le chunk en cours et sa colonne
+    struct GenerationContext {
+        ChunkCoord coord;
+        VoxelArray &voxels;
+        const ColumnData &column;
+
+        // Colonnes voisines (3 x 3, centre compris), pour les structures qui débordent du chunk.
+        // Fournies aux étapes qui déclarent un rayon de voisinage ; nullptr sinon
+        std::array<const ColumnData *, 9> neighborColumns{};
+
+        glm::ivec3 getWorldOrigin() const {
+            return {coord.x * VoxelArray::SIZE, coord.y * VoxelArray::SIZE, coord.z * VoxelArray::SIZE};
+        }
+
+        // Colonne contenant la position locale (x, z), jusqu'à un chunk hors des bords
+        const ColumnData *getColumnAt(const int x, const int z) const {
+            const int dx = x < 0 ? -1 : x >= VoxelArray::SIZE ? 1 : 0;
+            const int dz = z < 0 ? -1 : z >= VoxelArray::SIZE ? 1 : 0;
+            if (dx == 0 && dz == 0) return &column;
+            return neighborColumns[(dx + 1) + (dz + 1) * 3];
+        }
+    };
+}
+
+namespace std {
+    template<>
+    struct hash<voxelity::ColumnCoord> {
+        size_t operator()(const voxelity::ColumnCoord &coord) const noexcept {
+            return ash::HashCoord3(coord.x, 0, coord.z);
+        }
+    };
+}
+
+#endif //VOXELITY_GENERATIONSTAGE_H
@@ -2,6 +2,7 @@
 #define VOXELITY_ITERRAINGENERATOR_H
 
 #include "Voxelity/voxelWorld/chunk/Chunk.h"
+#include "Voxelity/voxelWorld/generation/GenerationStage.h"
 
 namespace voxelity {
     class ITerrainGenerator {
@@ -11,13 +12,45 @@ namespace voxelity {
 
         virtual ~ITerrainGenerator() = default;
 
-        virtual void generateChunk(Chunk &voxelChunk) = 0;
+        // Étape 2D bon marché, calculée une seule fois par colonne et partagée
+        virtual void buildColumn(ColumnData &column) = 0;
+
+        // Voisins qui doivent avoir avancé avant que cette étape puisse s'exécuter sur un chunk ;
+        // rayon nul : aucune dépendance
+        virtual StageDependency getStageDependency(GenerationStage stage) const { return {}; }
+
+        void runStage(GenerationStage stage, GenerationContext &context);
+
+        // Génération complète et séquentielle d'un chunk (toutes les étapes)
+        void generateChunk(Chunk &voxelChunk);
+
+        // Génération allégée des chunks lointains rendus en LOD : forme et surface seulement,
+        // les cavernes, minerais et structures ne se voient pas à cette distance
+        void generateLodChunk(GenerationContext &context);
+
+        // Vrai si le chunk est certainement vide (au-dessus du relief) : le LOD saute sa génération
+        virtual bool isChunkEmpty(const ChunkCoord &coord, const ColumnData &column) const { return false; }
 
     protected:
         uint32_t m_seed;
 
-        virtual VoxelType generateVoxel(const glm::ivec3 &worldPos) = 0;
+        virtual void generateDensity(GenerationContext &context) = 0;
+
+        virtual void applySurface(GenerationContext &context) {
+        }
+
+        virtual void applyCarvers(GenerationContext &context) {
+        }
+
+        virtual void applyOres(GenerationContext &context) {
+        }
+
+        // Chaque chunk écrit sa part des structures qui le touchent, y compris celles nées dans
+        // une colonne voisine (lue dans context.neighborColumns) : aucune écriture hors du chunk,
+        // résultat indépendant de l'ordre
+        virtual void placeFeatures(GenerationContext &context) {
+        }
     };
 }
 
-#endif //VOXELITY_ITERRAINGENERATOR_H
\ No newline at end of file
+#endif //VOXELITY_ITERRAINGENERATOR_H
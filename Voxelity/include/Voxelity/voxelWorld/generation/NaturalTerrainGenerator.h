@@ -24,13 +24,52 @@ namespace voxelity {
         bool hasWater;
         bool hasTrees;
         bool hasOres;
-        double treeChance;
+        float treeChance;
+    };
+
+    // Température et humidité normalisées entre 0 et 1
+    struct ClimateSample {
+        float temperature;
+        float humidity;
     };
 
     class NaturalTerrainGenerator final : public ITerrainGenerator {
+    public:
+        // Relief et climat, partagés avec les calculs de référence des tests et des benchmarks
+        static constexpr double CONTINENT_SCALE = 0.0008;
+        static constexpr double ELEVATION_SCALE = 0.015;
+        static constexpr double DETAIL_SCALE = 0.05;
+        static constexpr double TEMPERATURE_SCALE = 0.004;
+        static constexpr double HUMIDITY_SCALE = 0.003;
+        static constexpr float BIOME_ALTITUDE_COOLING = 0.01f;
+
+        static constexpr int SEA_LEVEL = 24;
+        static constexpr int BEACH_HEIGHT = SEA_LEVEL + 3;
+        static constexpr int MOUNTAIN_HEIGHT = SEA_LEVEL + 60;
+
+        // Pas de la grille grossière sur laquelle le climat est échantillonné
+        static constexpr int CLIMATE_GRID_STEP = 8;
+
+    private:
+        // 80 cases par axe : les seuils du classement (multiples de 0.1) tombent
+        // exactement sur des bords de case, la table ne déplace aucune frontière
+        static constexpr int BIOME_TABLE_SIZE = 80;
+
+        // Arbres : hauteur du tronc et portée horizontale de la couronne
+        static constexpr int TREE_MIN_HEIGHT = 4;
+        static constexpr int TREE_MAX_HEIGHT = 6;
+        static constexpr int TREE_RADIUS = 2;
+
         OpenSimplex2S noise;
+        std::array<BiomeType, BIOME_TABLE_SIZE * BIOME_TABLE_SIZE> m_biomeTable{};
+
+        void buildBiomeTable();
 
-        BiomeType getBiome(const glm::ivec3 &worldPos, double elevation);
+        static BiomeType classifyClimate(float temperature, float humidity);
+
+        ClimateSample sampleClimate(int worldX, int worldZ);
+
+        BiomeType getBiome(const ClimateSample &climate, int elevation) const;
 
         double getCaveNoise(const glm::ivec3 &worldPos);
 
@@ -38,15 +77,31 @@ namespace voxelity {
 
         bool shouldGenerateTree(const glm::ivec3 &worldPos, const BiomeData &biome);
 
-        static void generateTree(Chunk &voxelChunk, const glm::ivec3 &localPos, const glm::ivec3 &chunkPos);
+        // localPos : pied du tronc, éventuellement hors du chunk
+        static void generateTree(VoxelArray &voxels, const glm::ivec3 &localPos, int height);
 
     public:
         explicit NaturalTerrainGenerator(const uint32_t seed) : ITerrainGenerator(seed) {
+            buildBiomeTable();
         }
 
-        VoxelType generateVoxel(const glm::ivec3 &worldPos) override;
+        void buildColumn(ColumnData &column) override;
+
+        // Structures : les colonnes voisines doivent exister (étape DENSITY passée)
+        StageDependency getStageDependency(GenerationStage stage) const override;
+
+        bool isChunkEmpty(const ChunkCoord &coord, const ColumnData &column) const override;
+
+    protected:
+        void generateDensity(GenerationContext &context) override;
+
+        void applySurface(GenerationContext &context) override;
+
+        void applyCarvers(GenerationContext &context) override;
+
+        void applyOres(GenerationContext &context) override;
 
-        void generateChunk(Chunk &voxelChunk) override;
+        void placeFeatures(GenerationContext &context) override;
     };
 }
 
@@ -0,0 +1,23 @@
+#ifndef VOXELITY_LODDOWNSAMPLER_H
+#define VOXELITY_LODDOWNSAMPLER_H
+
+#include <glm/glm.hpp>
+
+#include "Voxelity/voxelWorld/voxel/VoxelArray.h"
+
+namespace voxelity {
+    // Réduction d'une grille de voxels : chaque cellule de scale³ voxels devient un seul voxel
+    class LodDownsampler {
+    public:
+        // Écrit les (SIZE / scale)³ cellules de src dans dst à partir de dstOffset (en cellules).
+        // scale : puissance de 2 entre 1 et SIZE
+        static void downsample(const VoxelArray &src, int scale, VoxelArray &dst, const glm::ivec3 &dstOffset);
+
+        // Cellule pleine si au moins la moitié de son volume est opaque : elle prend alors le type
+        // le plus fréquent de sa couche opaque la plus haute (l'herbe plutôt que la terre dessous).
+        // Sinon, liquide ou transparent si ceux-ci complètent la moitié (type le plus fréquent), sinon air.
+        static VoxelType mergeCell(const VoxelArray &src, const glm::ivec3 &min, int scale);
+    };
+}
+
+#endif //VOXELITY_LODDOWNSAMPLER_H
@@ -0,0 +1,141 @@
+#ifndef VOXELITY_LODMANAGER_H
+#define VOXELITY_LODMANAGER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+#include "Ashen/Core/Types.h"
+
+#include "Voxelity/voxelWorld/chunk/ChunkMesh.h"
+#include "Voxelity/voxelWorld/chunk/ChunkMeshPool.h"
+#include "Voxelity/voxelWorld/lod/LodSelector.h"
+
+namespace voxelity {
+    class ChunkManager;
+    class ColumnCache;
+    class ITerrainGenerator;
+
+    // Mesh d'un noeud LOD : 32³ cellules de getScale() voxels
+    struct LodMesh {
+        LodNode node;
+        ash::Own<ChunkMesh> opaqueMesh; // nullptr : aucune face
+        ash::Own<ChunkMesh> transparentMesh;
+
+        size_t getInstanceCount() const;
+    };
+
+    // Terrain lointain en niveaux de détail. Les noeuds grossiers sont générés (forme et surface),
+    // réduits puis meshés par un thread dédié ; seules les faces sont gardées, pas les voxels.
+    // Un noeud qui quitte la sélection reste affiché jusqu'à ce que ses remplaçants soient prêts.
+    class LodManager {
+    public:
+        LodManager(ChunkManager &chunkManager, ITerrainGenerator *generator, ColumnCache *columnCache);
+
+        ~LodManager();
+
+        LodManager(const LodManager &) = delete;
+
+        LodManager &operator=(const LodManager &) = delete;
+
+        // Niveaux grossiers (0 : désactivé, jusqu'à LOD_MAX_LEVEL), à régler avant le premier update
+        void setLevelCount(int levelCount);
+
+        int getLevelCount() const { return m_levelCount; }
+
+        bool isEnabled() const { return m_levelCount > 0 && m_generator && m_columnCache; }
+
+        // Thread principal, quand le joueur change de chunk : renderDistance est le rayon chargé
+        // par le ChunkManager, les chunks pleine résolution doivent pouvoir être meshés
+        void update(const glm::ivec3 &playerChunk, int renderDistance);
+
+        // Thread principal (OpenGL) : upload des meshes terminés et retrait des noeuds remplacés
+        void processCompleted();
+
+        // Le chunk est rendu en pleine résolution (toujours vrai si le LOD est désactivé)
+        bool isChunkVisible(const ChunkCoord &coord) const;
+
+        void forEachMesh(const std::function<void(const LodMesh &)> &func) const;
+
+        size_t getMeshCount() const { return m_meshes.size(); }
+
+        size_t getInstanceCount() const;
+
+        size_t getPendingBuildCount();
+
+        const ChunkMeshPoolStats &getMeshPoolStats() const { return m_meshPool.getStats(); }
+
+        void clear();
+
+        void shutdown();
+
+        // Maillage d'une grille de cellules, indépendant du monde. neighbors(x, y, z) donne
+        // les cellules hors de la grille (en cellules, relatives à la grille)
+        static void buildMesh(const VoxelArray &cells,
+                              const std::function<VoxelType(int, int, int)> &neighbors,
+                              ash::Vector<FaceInstance> &opaqueFaces,
+                              ash::Vector<FaceInstance> &transparentFaces);
+
+    private:
+        struct BuildRequest {
+            LodNode node;
+            int priority;
+
+            bool operator<(const BuildRequest &other) const {
+                return priority > other.priority;
+            }
+        };
+
+        struct BuildResult {
+            LodNode node;
+            ash::Vector<FaceInstance> opaqueFaces;
+            ash::Vector<FaceInstance> transparentFaces;
+        };
+
+        ChunkManager &m_chunkManager;
+        ITerrainGenerator *m_generator;
+        ColumnCache *m_columnCache;
+        int m_levelCount = 0;
+
+        // Thread principal uniquement. Le pool est déclaré avant les meshes qui lui reviennent
+        ChunkMeshPool m_meshPool;
+        ash::FlatHashSet<LodNode> m_selection;
+        ash::FlatHashSet<ChunkCoord> m_visibleChunks; // Niveau 0 sélectionné ou en attente de remplacement
+        ash::FlatHashMap<LodNode, ash::Own<LodMesh> > m_meshes;
+        ash::Vector<LodNode> m_retired; // Hors sélection, affichés jusqu'à être recouverts
+
+        std::priority_queue<BuildRequest> m_buildQueue;
+        std::mutex m_buildQueueMutex;
+        std::condition_variable m_buildCV;
+
+        std::queue<BuildResult> m_completed;
+        std::mutex m_completedMutex;
+
+        std::atomic<bool> m_running{true};
+        std::thread m_thread;
+
+        void worker();
+
+        BuildResult buildNode(const LodNode &node);
+
+        // Cellules du noeud : chunks générés puis réduits, ou remplis d'après la colonne
+        void sampleNode(const LodNode &node, VoxelArray &cells);
+
+        // Cellule hors du noeud, déduite de la hauteur du sol. Une marge de deux cellules sous
+        // la surface laisse des faces en jupe qui masquent les fentes entre niveaux voisins
+        VoxelType sampleOutside(const glm::ivec3 &cellMin, int scale);
+
+        // Tous les chunks du noeud sont recouverts par des noeuds sélectionnés et prêts
+        bool isCovered(const LodNode &node) const;
+
+        bool isReady(const LodNode &node) const;
+
+        // Rend au pool les meshes du noeud puis le retire
+        void eraseMesh(const LodNode &node);
+    };
+}
+
+#endif //VOXELITY_LODMANAGER_H
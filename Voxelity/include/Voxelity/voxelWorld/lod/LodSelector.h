@@ -0,0 +1,59 @@
+#ifndef VOXELITY_LODSELECTOR_H
+#define VOXELITY_LODSELECTOR_H
+
+#include "Ashen/Core/Types.h"
+
+#include "Voxelity/voxelWorld/chunk/Chunk.h"
+
+namespace voxelity {
+    // Niveau le plus grossier : cellules de 2^3 = 8 voxels de côté
+    constexpr int LOD_MAX_LEVEL = 3;
+
+    // Bloc de 2^level chunks par axe, rendu comme un seul chunk de 32³ cellules
+    // de 2^level voxels. Le niveau 0 est un chunk ordinaire.
+    struct LodNode {
+        ChunkCoord origin; // En chunks, multiple de getSize()
+        uint8_t level = 0;
+
+        int getSize() const { return 1 << level; } // En chunks
+        int getScale() const { return 1 << level; } // Voxels par cellule
+
+        bool contains(const ChunkCoord &coord) const;
+
+        // Noeud de ce niveau contenant le chunk
+        static LodNode containing(const ChunkCoord &coord, uint8_t level);
+
+        bool operator==(const LodNode &other) const {
+            return origin == other.origin && level == other.level;
+        }
+    };
+
+    // Choix des niveaux de détail en anneaux autour du joueur : un noeud de niveau L
+    // est subdivisé tant qu'il est à moins de L * detailRadius chunks (distance de Chebyshev).
+    // Le résultat couvre le cube de rayon getMaxDistance() sans trou ni recouvrement.
+    class LodSelector {
+    public:
+        // Distance de Chebyshev (en chunks) entre un chunk et le noeud, 0 à l'intérieur
+        static int distanceToNode(const glm::ivec3 &center, const LodNode &node);
+
+        static int getMaxDistance(int detailRadius, int levelCount);
+
+        // detailRadius : rayon des chunks pleine résolution ; levelCount : niveaux grossiers (0 à LOD_MAX_LEVEL)
+        static void select(const glm::ivec3 &center, int detailRadius, int levelCount, ash::Vector<LodNode> &out);
+
+    private:
+        static void selectNode(const glm::ivec3 &center, const LodNode &node, int detailRadius,
+                               ash::Vector<LodNode> &out);
+    };
+}
+
+namespace std {
+    template<>
+    struct hash<voxelity::LodNode> {
+        size_t operator()(const voxelity::LodNode &node) const noexcept {
+            return ash::MixHash(ash::HashCoord3(node.origin.x, node.origin.y, node.origin.z) ^ node.level);
+        }
+    };
+}
+
+#endif //VOXELITY_LODSELECTOR_H
@@ -0,0 +1,41 @@
+#ifndef VOXELITY_CHUNKFRUSTUMCULLER_H
+#define VOXELITY_CHUNKFRUSTUMCULLER_H
+
+#include <span>
+
+#include "Ashen/Core/Types.h"
+#include "Ashen/Graphics/Frustum.h"
+
+#include "Voxelity/voxelWorld/chunk/Chunk.h"
+
+namespace voxelity {
+    // Frustum culling des chunks en deux niveaux : chaque groupe de 4³ chunks est classé une fois,
+    // puis seuls les chunks des groupes à cheval sur un plan sont testés, par lot.
+    // Indépendant du rendu, ne dépend que des coordonnées.
+    class ChunkFrustumCuller {
+    public:
+        static constexpr int GROUP_SHIFT = 2; // Groupes de 2^2 = 4 chunks par axe
+
+        // visible[i] reçoit 1 si le chunk coords[i] recoupe le frustum.
+        // chunkSize : côté d'un chunk en unités monde (écartement de débogage compris)
+        void cull(const ash::Frustum &frustum, std::span<const ChunkCoord> coords, float chunkSize,
+                  ash::Vector<uint8_t> &visible);
+
+        size_t getGroupCount() const { return m_groupCount; }
+
+        size_t getBatchSize() const { return m_batchIndices.size(); }
+
+    private:
+        static constexpr uint8_t UNCLASSIFIED = 0xFF;
+
+        // Réutilisés d'une frame à l'autre. Les groupes forment une grille dense couvrant
+        // les coordonnées reçues : une indexation par chunk au lieu d'une recherche dans une table
+        ash::Vector<uint8_t> m_groups; // Intersection, ou UNCLASSIFIED
+        size_t m_groupCount = 0;
+        ash::AABBBatch m_batch;
+        ash::Vector<uint32_t> m_batchIndices;
+        ash::Vector<uint8_t> m_batchResults;
+    };
+}
+
+#endif //VOXELITY_CHUNKFRUSTUMCULLER_H
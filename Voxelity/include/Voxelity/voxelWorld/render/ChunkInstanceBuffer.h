@@ -0,0 +1,101 @@
+#ifndef VOXELITY_CHUNKINSTANCEBUFFER_H
+#define VOXELITY_CHUNKINSTANCEBUFFER_H
+
+#include <span>
+
+#include "Ashen/Core/Types.h"
+#include "Ashen/GraphicsAPI/Buffer.h"
+#include "Ashen/GraphicsAPI/VertexArray.h"
+
+#include "Voxelity/voxelWorld/chunk/Chunk.h"
+#include "Voxelity/voxelWorld/chunk/ChunkMesh.h"
+#include "Voxelity/voxelWorld/render/InstanceArena.h"
+#include "Voxelity/voxelWorld/render/TransparentSorter.h"
+
+namespace voxelity {
+    // Point de liaison du SSBO des origines de chunks (chunk.vert)
+    constexpr uint32_t CHUNK_ORIGIN_BINDING = 0;
+
+    // Faces de tous les chunks dans un seul buffer d'instances, découpé par un InstanceArena.
+    // Un pass entier est soumis en un glMultiDrawArraysIndirect : chaque commande commence à
+    // l'offset du mesh (baseInstance) et lit l'origine de son chunk à l'indice gl_DrawIDARB.
+    // Thread principal uniquement ; les objets OpenGL sont créés au premier upload.
+    class ChunkInstanceBuffer {
+    public:
+        explicit ChunkInstanceBuffer(uint32_t initialCapacity = 1u << 20);
+
+        ChunkInstanceBuffer(const ChunkInstanceBuffer &) = delete;
+
+        ChunkInstanceBuffer &operator=(const ChunkInstanceBuffer &) = delete;
+
+        // Remplace les meshes du chunk ; sans aucune face, le chunk est retiré
+        void upload(const ChunkCoord &coord, std::span<const FaceInstance> opaqueFaces,
+                    std::span<const FaceInstance> transparentFaces);
+
+        void release(const ChunkCoord &coord);
+
+        void clear();
+
+        // Vrai si le chunk a au moins une face dans le buffer
+        bool contains(const ChunkCoord &coord) const;
+
+        bool hasTransparentFaces(const ChunkCoord &coord) const;
+
+        // Retrie les faces transparentes des chunks (déjà ordonnés du plus loin au plus proche)
+        // dont le dernier tri est périmé, les plus proches d'abord, dans la limite de
+        // MAX_SORTED_FACES_PER_FRAME. Les faces triées remplacent les anciennes dans l'arène.
+        void sortTransparent(std::span<const Chunk *const> chunks, const glm::vec3 &camera, float chunkSpacing,
+                             TransparentSortStats &stats);
+
+        // Un seul appel de dessin pour tous les chunks donnés, dans cet ordre (shader déjà lié)
+        void draw(std::span<const Chunk *const> chunks, bool transparent);
+
+        // Incrémenté quand un chunk entre dans le buffer ou en sort, pas à son remaillage
+        uint64_t getRevision() const { return m_revision; }
+
+        size_t getChunkCount() const { return m_entries.size(); }
+        const InstanceArena &getArena() const { return m_arena; }
+        size_t getCompactionCount() const { return m_compactionCount; }
+
+    private:
+        static constexpr size_t MAX_SORTED_FACES_PER_FRAME = 1u << 14;
+
+        struct Entry {
+            InstanceArena::Handle opaque = InstanceArena::INVALID_HANDLE;
+            InstanceArena::Handle transparent = InstanceArena::INVALID_HANDLE;
+
+            // Copie des faces transparentes pour les retrier sans relire le GPU
+            ash::Vector<FaceInstance> transparentFaces;
+            glm::vec3 sortedFrom{0.0f}; // Caméra du dernier tri, en voxels dans le chunk
+            bool sorted = false;
+        };
+
+        // Commandes et origines d'un pass, réutilisées d'une frame à l'autre
+        struct Batch {
+            ash::Ref<ash::IndirectBuffer> commands;
+            ash::Ref<ash::ShaderStorageBuffer> origins;
+            ash::Vector<ash::DrawArraysIndirectCommand> commandData;
+            ash::Vector<glm::vec4> originData;
+        };
+
+        InstanceArena m_arena;
+        ash::FlatHashMap<ChunkCoord, Entry> m_entries;
+
+        ash::Ref<ash::VertexArray> m_vao;
+        ash::Ref<ash::VertexBuffer> m_instances;
+        Batch m_batches[2];
+        ash::Vector<InstanceArena::Move> m_moves;
+        TransparentSorter m_sorter;
+        size_t m_compactionCount = 0;
+        uint64_t m_revision = 0;
+
+        void createBuffers();
+
+        InstanceArena::Handle allocate(std::span<const FaceInstance> faces);
+
+        // Compacte l'arène (et l'agrandit si nécessaire) puis recopie les faces dans un nouveau buffer
+        void relocate(uint32_t capacity);
+    };
+}
+
+#endif //VOXELITY_CHUNKINSTANCEBUFFER_H
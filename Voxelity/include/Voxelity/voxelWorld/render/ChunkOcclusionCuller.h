@@ -0,0 +1,42 @@
+#ifndef VOXELITY_CHUNKOCCLUSIONCULLER_H
+#define VOXELITY_CHUNKOCCLUSIONCULLER_H
+
+#include <functional>
+
+#include "Ashen/Core/Types.h"
+
+#include "Voxelity/voxelWorld/chunk/Chunk.h"
+#include "Voxelity/voxelWorld/chunk/ChunkVisibility.h"
+
+namespace voxelity {
+    // Cave culling : parcours en largeur depuis le chunk de la caméra à travers le graphe
+    // de connectivité des faces. On n'entre dans un voisin que si la face d'entrée du chunk
+    // courant est reliée à la face de sortie, sans jamais revenir sur une direction déjà prise.
+    // Indépendant du rendu : les chunks sont fournis par une fonction de recherche.
+    class ChunkOcclusionCuller {
+    public:
+        // nullptr : chunk absent, le parcours ne le traverse pas
+        using VisibilityLookup = std::function<const ChunkVisibility *(const ChunkCoord &)>;
+
+        // false si le chunk de départ est absent (caméra hors du monde chargé) : rien n'est écarté
+        bool update(const ChunkCoord &start, const VisibilityLookup &lookup);
+
+        bool isVisible(const ChunkCoord &coord) const { return m_visible.contains(coord); }
+
+        size_t getVisibleCount() const { return m_visible.size(); }
+
+    private:
+        struct Step {
+            ChunkCoord coord;
+            const ChunkVisibility *visibility;
+            int8_t entryFace; // Face du chunk par laquelle on est entré, -1 au départ
+            uint8_t directions; // Directions déjà parcourues (bits CubicDirection)
+        };
+
+        // Réutilisés d'une frame à l'autre
+        ash::FlatHashSet<ChunkCoord> m_visible;
+        ash::Vector<Step> m_queue;
+    };
+}
+
+#endif //VOXELITY_CHUNKOCCLUSIONCULLER_H
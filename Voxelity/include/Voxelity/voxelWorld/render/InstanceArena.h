@@ -0,0 +1,77 @@
+#ifndef VOXELITY_INSTANCEARENA_H
+#define VOXELITY_INSTANCEARENA_H
+
+#include <cstdint>
+
+#include "Ashen/Core/Types.h"
+
+namespace voxelity {
+    // Sous-allocateur de plages d'instances dans un buffer unique, sans aucun appel OpenGL :
+    // seules les positions sont gérées, le propriétaire du buffer applique les déplacements.
+    // Blocs libres triés par position et fusionnés à la libération, placement au plus juste.
+    class InstanceArena {
+    public:
+        using Handle = uint32_t;
+        static constexpr Handle INVALID_HANDLE = UINT32_MAX;
+
+        struct Range {
+            uint32_t offset = 0;
+            uint32_t count = 0;
+        };
+
+        // Copie à effectuer après un compactage, de l'ancien emplacement vers le nouveau
+        struct Move {
+            uint32_t from = 0;
+            uint32_t to = 0;
+            uint32_t count = 0;
+        };
+
+        explicit InstanceArena(uint32_t capacity = 0);
+
+        // INVALID_HANDLE si count est nul ou si aucun bloc libre n'est assez grand
+        Handle allocate(uint32_t count);
+
+        void free(Handle handle);
+
+        bool isValid(Handle handle) const;
+
+        // Emplacement actuel, modifié par compact()
+        Range get(Handle handle) const;
+
+        // L'espace ajouté prolonge le dernier bloc libre ; les allocations ne bougent pas
+        void grow(uint32_t capacity);
+
+        // Regroupe les allocations en tête sans changer leur ordre, il ne reste qu'un bloc libre.
+        // moves couvre toutes les allocations (plages contiguës fusionnées), déplacées ou non,
+        // pour permettre une recopie complète vers un nouveau buffer
+        void compact(ash::Vector<Move> &moves);
+
+        void clear();
+
+        uint32_t getCapacity() const { return m_capacity; }
+        uint32_t getUsedCount() const { return m_used; }
+        uint32_t getFreeCount() const { return m_capacity - m_used; }
+        uint32_t getLargestFreeBlock() const;
+        size_t getFreeBlockCount() const { return m_freeBlocks.size(); }
+        size_t getAllocationCount() const { return m_slots.size() - m_freeSlots.size(); }
+
+        // 0 : espace libre d'un seul tenant, proche de 1 : très morcelé
+        float getFragmentation() const;
+
+    private:
+        struct Slot {
+            Range range;
+            bool used = false;
+        };
+
+        ash::Vector<Range> m_freeBlocks; // Triés par offset, jamais adjacents
+        ash::Vector<Slot> m_slots;
+        ash::Vector<Handle> m_freeSlots;
+        uint32_t m_capacity = 0;
+        uint32_t m_used = 0;
+
+        void insertFreeBlock(Range range);
+    };
+}
+
+#endif //VOXELITY_INSTANCEARENA_H
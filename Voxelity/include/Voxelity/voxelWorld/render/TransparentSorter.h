@@ -0,0 +1,61 @@
+#ifndef VOXELITY_TRANSPARENTSORTER_H
+#define VOXELITY_TRANSPARENTSORTER_H
+
+#include <span>
+
+#include <glm/glm.hpp>
+
+#include "Ashen/Core/Types.h"
+
+#include "Voxelity/voxelWorld/chunk/Chunk.h"
+
+namespace voxelity {
+    // Travail de tri du pass transparent pendant la dernière frame
+    struct TransparentSortStats {
+        size_t chunks = 0; // Chunks ayant des faces transparentes à l'écran
+        size_t resortedChunks = 0;
+        size_t resortedFaces = 0;
+        double sortMs = 0.0;
+    };
+
+    // Ordre de dessin des faces transparentes (eau, verre) : du plus loin au plus proche de la
+    // caméra, les chunks entre eux puis les faces dans chaque chunk. Sans état OpenGL.
+    class TransparentSorter {
+    public:
+        // Les faces d'un chunk sont retriées quand la caméra s'est déplacée de plus de
+        // RESORT_DISTANCE + RESORT_RATIO * distance au chunk (en voxels) depuis le dernier tri
+        static constexpr float RESORT_DISTANCE = 1.0f;
+        static constexpr float RESORT_RATIO = 0.125f;
+
+        static bool needsResort(const glm::vec3 &sortedFrom, const glm::vec3 &camera, float distance);
+
+        // Centre de la face (milieu du voxel décalé vers sa normale), en voxels dans le chunk
+        static glm::vec3 getFaceCenter(const FaceInstance &face);
+
+        // cameraLocal : position de la caméra dans le repère du chunk, en voxels
+        void sortFaces(std::span<FaceInstance> faces, const glm::vec3 &cameraLocal);
+
+        // Distance décroissante au centre du chunk ; à égalité l'ordre ne dépend que des coordonnées
+        void sortChunks(ash::Vector<const Chunk *> &chunks, const glm::vec3 &camera, float chunkSpacing);
+
+        // Origine du chunk dans le monde, telle que la calcule chunk.vert
+        static glm::vec3 getChunkOrigin(const glm::ivec3 &position, float chunkSpacing);
+
+    private:
+        struct FaceKey {
+            float distance;
+            uint32_t data;
+        };
+
+        struct ChunkKey {
+            float distance;
+            glm::ivec3 position;
+            const Chunk *chunk;
+        };
+
+        ash::Vector<FaceKey> m_faceKeys;
+        ash::Vector<ChunkKey> m_chunkKeys;
+    };
+}
+
+#endif //VOXELITY_TRANSPARENTSORTER_H
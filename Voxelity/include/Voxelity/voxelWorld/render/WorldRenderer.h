@@ -4,6 +4,10 @@
 #include "Ashen/Graphics/Cameras/Camera.h"
 #include "Ashen/GraphicsAPI/Shader.h"
 #include "Ashen/GraphicsAPI/TextureAtlas.h"
+#include "Voxelity/voxelWorld/render/ChunkDrawOrder.h"
+#include "Voxelity/voxelWorld/render/ChunkFrustumCuller.h"
+#include "Voxelity/voxelWorld/render/ChunkOcclusionCuller.h"
+#include "Voxelity/voxelWorld/render/TransparentSorter.h"
 #include "Voxelity/voxelWorld/world/World.h"
 
 namespace voxelity {
@@ -13,6 +17,18 @@ namespace voxelity {
         TextureArray // Texture array moderne
     };
 
+    // Chunks maillés de la dernière frame
+    struct ChunkCullingStats {
+        size_t drawnChunks = 0;
+        size_t occlusionCulledChunks = 0; // Invisibles depuis la caméra (cave culling)
+        size_t frustumCulledChunks = 0; // Hors du champ de vision
+        size_t frustumGroups = 0; // Groupes de chunks classés en bloc
+        size_t frustumTestedChunks = 0; // Chunks des groupes à cheval, testés un à un
+        double cullingMs = 0.0; // Coût total des deux tests et du tri sur le thread principal
+        double orderMs = 0.0; // Tri du plus proche au plus lointain (0 s'il est réutilisé)
+        bool orderReused = false;
+    };
+
     class WorldRenderer {
     public:
         WorldRenderer(World &world, ash::Camera &camera, ash::ShaderProgram &shader);
@@ -31,6 +47,16 @@ namespace voxelity {
         void setChunkSpacing(const float spacing) { m_chunkSpacing = spacing; }
         [[nodiscard]] float getChunkSpacing() const { return m_chunkSpacing; }
 
+        void setOcclusionCulling(const bool enabled) { m_occlusionCulling = enabled; }
+        [[nodiscard]] bool isOcclusionCullingEnabled() const { return m_occlusionCulling; }
+
+        void setFrustumCulling(const bool enabled) { m_frustumCulling = enabled; }
+        [[nodiscard]] bool isFrustumCullingEnabled() const { return m_frustumCulling; }
+
+        [[nodiscard]] const ChunkCullingStats &getCullingStats() const { return m_cullingStats; }
+
+        [[nodiscard]] const TransparentSortStats &getTransparentSortStats() const { return m_transparentSortStats; }
+
     private:
         World &m_world;
         ash::Camera &m_camera;
@@ -44,14 +70,52 @@ namespace voxelity {
         float m_chunkSpacing = 1.0f;
         glm::mat4 m_viewProjection{};
 
+        // Chunks à dessiner cette frame, du plus proche au plus lointain, communs aux deux passes
+        ash::Vector<const Chunk *> m_drawList;
+
+        // Chunks maillés triés autour du chunk caméra, gardés tant que la caméra reste dans
+        // ce chunk et que l'ensemble des meshes n'a pas changé
+        ChunkDrawOrder m_drawOrder;
+        ash::Vector<const Chunk *> m_orderedChunks; // Indexés comme m_drawOrder
+        ChunkCoord m_orderCenter;
+        uint64_t m_orderRevision = 0;
+        bool m_orderValid = false;
+        ChunkOcclusionCuller m_occlusionCuller;
+        bool m_occlusionCulling = true;
+
+        ChunkFrustumCuller m_frustumCuller;
+        bool m_frustumCulling = true;
+        ash::Vector<const Chunk *> m_candidates;
+        ash::Vector<ChunkCoord> m_candidateCoords;
+        ash::Vector<uint8_t> m_inFrustum;
+        ChunkCullingStats m_cullingStats;
+
+        // Chunks de m_drawList ayant des faces transparentes, du plus loin au plus proche
+        ash::Vector<const Chunk *> m_transparentList;
+        TransparentSorter m_transparentSorter;
+        TransparentSortStats m_transparentSortStats;
+
         void setupMatrices();
 
+        void collectVisibleChunks();
+
+        // Les pointeurs gardés restent valides : décharger un chunk change la révision
+        void updateDrawOrder(const ChunkCoord &cameraChunk);
+
+        void sortTransparentChunks();
+
         void bindCommonResources() const;
 
         void renderOpaquePass() const;
 
         void renderTransparentPass() const;
 
+        // Chunks donnés en un seul appel de dessin, dans leur ordre
+        void renderChunks(std::span<const Chunk *const> chunks, bool transparent) const;
+
+        // Noeuds LOD du terrain lointain, avec la taille de leurs cellules
+        void renderLodMeshes(bool transparent) const;
+
         void initializeAtlases();
     };
 }
@@ -0,0 +1,40 @@
+#ifndef VOXELITY_CHUNKCODEC_H
+#define VOXELITY_CHUNKCODEC_H
+
+#include <span>
+
+#include "Ashen/Core/Types.h"
+
+#include "Voxelity/voxelWorld/chunk/Chunk.h"
+
+namespace voxelity {
+    // Sérialisation compacte d'un chunk : en-tête (version, drapeaux, coordonnée du chunk,
+    // somme de contrôle), puis plages (longueur varint, valeur) sur les voxels dans l'ordre
+    // de stockage, suivies des états de liquide s'il y en a.
+    // Un chunk de terrain typique (couches homogènes) tient en quelques centaines d'octets.
+    class ChunkCodec {
+    public:
+        static constexpr uint8_t VERSION = 2;
+
+        static ash::Vector<uint8_t> encode(const ChunkCoord &coord, const VoxelArray &voxels, const FluidArray *fluid);
+
+        // false si les données sont tronquées ou corrompues (somme de contrôle) ;
+        // coord reçoit la coordonnée enregistrée, à comparer à celle attendue
+        static bool decode(std::span<const uint8_t> bytes, ChunkCoord &coord, ChunkData &out);
+
+    private:
+        static constexpr uint8_t FLAG_FLUID = 1 << 0;
+
+        static constexpr size_t CHECKSUM_OFFSET = 2 + 3 * sizeof(int32_t);
+        static constexpr size_t HEADER_SIZE = CHECKSUM_OFFSET + sizeof(uint32_t);
+
+        // FNV-1a sur tous les octets sauf la somme elle-même
+        static uint32_t computeChecksum(std::span<const uint8_t> bytes);
+
+        static void appendRuns(ash::Vector<uint8_t> &out, const uint8_t *values, size_t count);
+
+        static bool readRuns(std::span<const uint8_t> bytes, size_t &cursor, uint8_t *values, size_t count);
+    };
+}
+
+#endif //VOXELITY_CHUNKCODEC_H
@@ -0,0 +1,103 @@
+#ifndef VOXELITY_REGIONFILE_H
+#define VOXELITY_REGIONFILE_H
+
+#include <array>
+#include <filesystem>
+#include <shared_mutex>
+#include <span>
+#include <glm/glm.hpp>
+
+#include "Ashen/Core/Types.h"
+
+namespace voxelity {
+    // Fichier de région : SIZE³ chunks par fichier.
+    // En-tête : magic, version, puis une table (secteur, taille) par chunk.
+    // Les données sont écrites par secteurs de SECTOR_SIZE octets, toujours dans des
+    // secteurs libres : l'ancienne version reste valide jusqu'à la mise à jour de la table.
+    // Quand une écriture remplace une version existante ou réutilise des secteurs libérés,
+    // les données sont forcées sur le support avant la table, et la table avant la réutilisation
+    // des anciens secteurs : une coupure de courant laisse l'ancienne ou la nouvelle version,
+    // jamais un mélange ni les données d'un autre chunk.
+    // Lectures concurrentes possibles (pread), écritures exclusives.
+    class RegionFile {
+    public:
+        static constexpr int SIZE = 16;
+        static constexpr int SHIFT = 4;
+        static constexpr int MASK = SIZE - 1;
+        static constexpr int CHUNK_COUNT = SIZE * SIZE * SIZE;
+        static constexpr size_t SECTOR_SIZE = 4096;
+
+        struct ChunkWrite {
+            glm::ivec3 localCoord;
+            std::span<const uint8_t> data;
+        };
+
+        // Ouvre ou crée le fichier ; std::runtime_error en cas d'échec
+        RegionFile(const std::filesystem::path &path, bool create);
+
+        ~RegionFile();
+
+        RegionFile(const RegionFile &) = delete;
+
+        RegionFile &operator=(const RegionFile &) = delete;
+
+        // localCoord dans [0, SIZE) ; false si le chunk n'a jamais été écrit
+        bool read(const glm::ivec3 &localCoord, ash::Vector<uint8_t> &out) const;
+
+        void write(const glm::ivec3 &localCoord, std::span<const uint8_t> data);
+
+        // Un seul couple de fsync pour tout le lot, aucun s'il n'écrit que des chunks nouveaux
+        // dans des secteurs ajoutés en fin de fichier. std::runtime_error en cas d'échec,
+        // table et secteurs libres laissés dans leur état d'avant l'appel
+        void write(std::span<const ChunkWrite> chunks);
+
+        bool contains(const glm::ivec3 &localCoord) const;
+
+        // Force l'écriture sur le support (fsync)
+        void sync() const;
+
+        const std::filesystem::path &getPath() const { return m_path; }
+
+    private:
+        static constexpr uint32_t MAGIC = 0x47525856; // "VXRG"
+        static constexpr uint32_t VERSION = 1;
+
+        struct Entry {
+            uint32_t sector = 0; // 0 : absent
+            uint32_t length = 0; // Octets
+        };
+
+        static constexpr size_t HEADER_SIZE = 2 * sizeof(uint32_t) + CHUNK_COUNT * sizeof(Entry);
+        static constexpr uint32_t HEADER_SECTORS = (HEADER_SIZE + SECTOR_SIZE - 1) / SECTOR_SIZE;
+
+        std::filesystem::path m_path;
+        int m_fd = -1;
+
+        std::array<Entry, CHUNK_COUNT> m_entries{};
+        ash::Vector<bool> m_usedSectors;
+        mutable std::shared_mutex m_mutex;
+
+        void readHeader();
+
+        void writeHeader();
+
+        uint32_t allocateSectors(uint32_t count);
+
+        void markSectors(const Entry &entry, bool used);
+
+        // Appelant sous m_mutex
+        bool writeEntry(int index) const;
+
+        void syncLocked() const;
+
+        static uint32_t getSectorCount(uint32_t length);
+
+        static int toIndex(const glm::ivec3 &localCoord);
+
+        bool readAt(uint64_t offset, void *buffer, size_t size) const;
+
+        bool writeAt(uint64_t offset, const void *buffer, size_t size) const;
+    };
+}
+
+#endif //VOXELITY_REGIONFILE_H
@@ -0,0 +1,64 @@
+#ifndef VOXELITY_REGIONSTORAGE_H
+#define VOXELITY_REGIONSTORAGE_H
+
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+
+#include "Ashen/Core/Types.h"
+
+#include "Voxelity/voxelWorld/chunk/Chunk.h"
+
+namespace voxelity {
+    class RegionFile;
+
+    struct EncodedChunk {
+        ChunkCoord coord;
+        ash::Vector<uint8_t> bytes; // Sortie de ChunkCodec::encode
+    };
+
+    // Persistance des chunks d'un monde : un RegionFile par bloc de 16³ chunks,
+    // ouvert à la demande et gardé en cache. Thread-safe.
+    class RegionStorage {
+    public:
+        explicit RegionStorage(std::filesystem::path directory, size_t maxOpenRegions = 64);
+
+        ~RegionStorage();
+
+        // false si le chunk n'a jamais été sauvegardé ou si ses données sont illisibles
+        bool loadChunk(const ChunkCoord &coord, ChunkData &out);
+
+        // Écrit des chunks appartenant tous à la même région ; les écritures sont sérialisées.
+        // filter, appelé sous le verrou d'écriture, écarte les versions devenues périmées.
+        // rewrite : la région est recopiée dans un fichier temporaire renommé ensuite par-dessus
+        // l'original, un arrêt brutal laisse l'ancienne version intacte. Sinon écriture en place.
+        // false en cas d'erreur d'écriture
+        bool writeChunks(std::span<const EncodedChunk> chunks, bool rewrite,
+                         const std::function<bool(const ChunkCoord &)> &filter = {});
+
+        const std::filesystem::path &getDirectory() const { return m_directory; }
+
+        static ChunkCoord toRegionCoord(const ChunkCoord &coord);
+
+    private:
+        std::filesystem::path m_directory;
+        size_t m_maxOpenRegions;
+
+        std::unordered_map<ChunkCoord, ash::Ref<RegionFile> > m_regions;
+        std::mutex m_mutex;
+        std::mutex m_writeMutex;
+
+        // nullptr si le fichier n'existe pas et que create est faux
+        ash::Ref<RegionFile> getRegion(const ChunkCoord &regionCoord, bool create);
+
+        std::filesystem::path getRegionPath(const ChunkCoord &regionCoord) const;
+
+        bool rewriteRegion(const ChunkCoord &regionCoord, std::span<const EncodedChunk *const> chunks);
+
+        static glm::ivec3 toLocalCoord(const ChunkCoord &coord);
+    };
+}
+
+#endif //VOXELITY_REGIONSTORAGE_H
@@ -0,0 +1,83 @@
+#ifndef VOXELITY_BLOCKBEHAVIOR_H
+#define VOXELITY_BLOCKBEHAVIOR_H
+
+#include <array>
+#include <functional>
+#include <glm/glm.hpp>
+
+#include "Ashen/Core/Types.h"
+#include "Ashen/Math/Random.h"
+
+#include "Voxelity/voxelWorld/voxel/VoxelType.h"
+#include "Voxelity/voxelWorld/world/VoxelAccessor.h"
+#include "Voxelity/voxelWorld/world/World.h"
+
+namespace voxelity {
+    struct ScheduledTickRequest {
+        glm::ivec3 position;
+        uint32_t delay;
+    };
+
+    struct FallingBlockSpawn {
+        glm::ivec3 position;
+        VoxelType type;
+    };
+
+    // Contexte d'un comportement de bloc : lecture du monde,
+    // écritures différées et appliquées en lot à la fin de la phase
+    class TickContext {
+    public:
+        TickContext(const World &world, uint64_t currentTick, uint64_t seed);
+
+        VoxelType getVoxel(const glm::ivec3 &pos) { return m_voxels.get(pos); }
+
+        void setVoxel(const glm::ivec3 &pos, VoxelType type);
+
+        void scheduleTick(const glm::ivec3 &pos, uint32_t delay);
+
+        void spawnFallingBlock(const glm::ivec3 &pos, VoxelType type);
+
+        uint64_t getCurrentTick() const { return m_currentTick; }
+        ash::FastRandom &getRandom() { return m_random; }
+
+        // Résultats
+        ash::Vector<VoxelEdit> edits;
+        ash::Vector<ScheduledTickRequest> scheduledTicks;
+        ash::Vector<FallingBlockSpawn> fallingBlocks;
+
+    private:
+        VoxelAccessor m_voxels;
+        uint64_t m_currentTick;
+        ash::FastRandom m_random;
+    };
+
+    using BlockTickHandler = std::function<void(TickContext &context, const glm::ivec3 &pos, VoxelType voxel)>;
+
+    // Réactions d'un type de bloc ; un handler vide = pas de réaction
+    struct BlockBehavior {
+        BlockTickHandler onScheduledTick;
+        BlockTickHandler onRandomTick;
+        BlockTickHandler onNeighborUpdate;
+    };
+
+    class BlockBehaviorRegistry {
+    private:
+        std::array<BlockBehavior, 256> registry;
+        static BlockBehaviorRegistry *instance;
+
+        BlockBehaviorRegistry();
+
+    public:
+        static BlockBehaviorRegistry &getInstance();
+
+        [[nodiscard]] const BlockBehavior &getBehavior(VoxelType voxelID) const noexcept;
+
+        void setBehavior(VoxelType voxelID, const BlockBehavior &behavior) noexcept;
+
+        void resetToDefaults() noexcept;
+    };
+
+    [[nodiscard]] const BlockBehavior &getBlockBehavior(VoxelType voxelID) noexcept;
+}
+
+#endif //VOXELITY_BLOCKBEHAVIOR_H
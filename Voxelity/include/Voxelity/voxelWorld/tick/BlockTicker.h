@@ -0,0 +1,101 @@
+#ifndef VOXELITY_BLOCKTICKER_H
+#define VOXELITY_BLOCKTICKER_H
+
+#include <functional>
+#include <queue>
+#include <glm/glm.hpp>
+
+#include "Ashen/Core/Types.h"
+#include "Ashen/Math/BBox.h"
+
+#include "Voxelity/voxelWorld/chunk/Chunk.h"
+
+namespace voxelity {
+    class World;
+    class TickContext;
+
+    // Mises à jour de blocs : ticks programmés (tas min par chunk), notifications
+    // de voisinage après setVoxel et ticks aléatoires.
+    // Les chunks sont traités en parallèle par groupes de parité (x, y, z) :
+    // deux chunks d'un même groupe ne sont jamais adjacents. Les écritures des
+    // comportements sont appliquées en lot entre deux groupes.
+    class BlockTicker {
+    public:
+        using FallingBlockSpawner = std::function<void(const glm::ivec3 &pos, VoxelType type)>;
+
+        explicit BlockTicker(World &world);
+
+        // Thread principal uniquement
+        void scheduleTick(const glm::ivec3 &worldPos, uint32_t delay);
+
+        // Prévient le voxel modifié et ses 6 voisins
+        void notifyNeighbors(const glm::ivec3 &worldPos);
+
+        // Prévient les voxels d'une boîte élargie d'un voxel (modifications en masse) :
+        // une copie de la région au lieu d'une lecture par voisin
+        void notifyRegion(const ash::BBox3i &box);
+
+        void tick();
+
+        void setRandomTickSpeed(const int voxelsPerChunk) { m_randomTickSpeed = voxelsPerChunk; }
+        int getRandomTickSpeed() const { return m_randomTickSpeed; }
+
+        void setFallingBlockSpawner(FallingBlockSpawner spawner) { m_fallingBlockSpawner = std::move(spawner); }
+
+        uint64_t getCurrentTick() const { return m_currentTick; }
+
+        size_t getPendingTickCount() const;
+
+        void clear();
+
+    private:
+        struct ScheduledTick {
+            uint64_t tick;
+            uint32_t order; // Ordre d'insertion à tick égal
+            uint16_t index; // Index local dans le chunk
+
+            bool operator>(const ScheduledTick &other) const {
+                return tick != other.tick ? tick > other.tick : order > other.order;
+            }
+        };
+
+        // Des voxels voisins ont des index consécutifs : sans mélange (std::hash est l'identité), ils
+        // forment une seule grappe que chaque suppression parcourt jusqu'au bout
+        struct IndexHash {
+            size_t operator()(const uint16_t index) const { return static_cast<size_t>(ash::MixHash(index)); }
+        };
+
+        struct ChunkTickQueue {
+            std::priority_queue<ScheduledTick, ash::Vector<ScheduledTick>, std::greater<> > scheduled;
+            ash::FlatHashSet<uint16_t, IndexHash> scheduledSet; // Un seul tick en attente par voxel
+
+            ash::Vector<uint16_t> neighborUpdates;
+            ash::FlatHashSet<uint16_t, IndexHash> neighborSet;
+
+            bool empty() const { return scheduled.empty() && neighborUpdates.empty(); }
+        };
+
+        World &m_world;
+
+        ash::FlatHashMap<ChunkCoord, ChunkTickQueue> m_queues;
+        uint64_t m_currentTick = 0;
+        uint32_t m_order = 0;
+        int m_randomTickSpeed = 3;
+
+        FallingBlockSpawner m_fallingBlockSpawner;
+
+        ash::Vector<VoxelType> m_regionBuffer; // Tampon de notifyRegion, conservé d'un appel à l'autre
+
+        void queueNeighborUpdate(const glm::ivec3 &worldPos);
+
+        void processChunk(const ChunkCoord &coord, ChunkTickQueue *queue, TickContext &context) const;
+
+        void applyResults(ash::Vector<TickContext> &contexts);
+
+        static uint16_t toIndex(const glm::ivec3 &localPos);
+
+        static glm::ivec3 toLocalPos(uint16_t index);
+    };
+}
+
+#endif //VOXELITY_BLOCKTICKER_H
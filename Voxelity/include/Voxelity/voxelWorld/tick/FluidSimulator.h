@@ -0,0 +1,92 @@
+#ifndef VOXELITY_FLUIDSIMULATOR_H
+#define VOXELITY_FLUIDSIMULATOR_H
+
+#include <glm/glm.hpp>
+
+#include "Ashen/Core/Types.h"
+#include "Ashen/Math/Math.h"
+#include "Ashen/Math/BBox.h"
+
+#include "Voxelity/voxelWorld/chunk/Chunk.h"
+
+namespace voxelity {
+    class World;
+    class VoxelAccessor;
+
+    struct FluidProperties {
+        VoxelType type;
+        uint8_t maxSpread; // Distance horizontale maximale depuis une source (<= FluidArray::LEVEL_MASK)
+        uint32_t tickInterval; // Un pas de simulation tous les tickInterval ticks du monde
+        bool renewable; // Deux sources voisines créent une nouvelle source
+    };
+
+    // Écoulement des liquides par automate cellulaire.
+    // Seules les cellules actives (modifiées ou voisines d'une modification) sont évaluées :
+    // chaque cellule recalcule son propre état à partir de l'état précédent de ses voisins,
+    // ce qui permet de traiter tous les chunks en parallèle sans conflit d'écriture.
+    // Les cellules à activer hors du chunk traité sont transmises au thread principal,
+    // qui applique toutes les modifications du pas en un seul World::applySimulationEdits.
+    class FluidSimulator {
+    public:
+        explicit FluidSimulator(World &world);
+
+        // Active la cellule et ses 6 voisines (thread principal)
+        void activate(const glm::ivec3 &worldPos);
+
+        // Active les liquides d'une boîte élargie d'un voxel (modifications en masse)
+        void activateBox(const ash::BBox3i &box);
+
+        void tick();
+
+        size_t getActiveCellCount() const;
+
+        // Modifications appliquées au dernier pas
+        size_t getLastChangeCount() const { return m_lastChangeCount; }
+
+        void clear();
+
+    private:
+        struct FluidChannel {
+            FluidProperties properties;
+            ash::FlatHashMap<ChunkCoord, ash::FlatHashSet<uint16_t> > active;
+        };
+
+        struct FluidCell {
+            VoxelType type = VoxelID::AIR;
+            uint8_t state = 0;
+        };
+
+        struct FluidChange {
+            glm::ivec3 position;
+            VoxelType type;
+            uint8_t state;
+        };
+
+        // Résultat d'un chunk, fusionné par le thread principal
+        struct StepOutput {
+            ash::Vector<FluidChange> changes;
+            ash::Vector<glm::ivec3> activations;
+        };
+
+        World &m_world;
+
+        ash::Vector<FluidChannel> m_channels;
+        uint64_t m_currentTick = 0;
+        size_t m_lastChangeCount = 0;
+
+        void step(FluidChannel &channel);
+
+        void evaluateCell(const FluidProperties &properties, VoxelAccessor &voxels,
+                          const glm::ivec3 &pos, StepOutput &output) const;
+
+        void activateCell(FluidChannel &channel, const glm::ivec3 &worldPos);
+
+        FluidChannel *findChannel(VoxelType type);
+
+        static FluidCell readCell(VoxelAccessor &voxels, const glm::ivec3 &worldPos);
+
+        static bool canFlowInto(VoxelType type);
+    };
+}
+
+#endif //VOXELITY_FLUIDSIMULATOR_H
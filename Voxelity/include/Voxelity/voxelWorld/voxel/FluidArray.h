@@ -0,0 +1,44 @@
+#ifndef VOXELITY_FLUIDARRAY_H
+#define VOXELITY_FLUIDARRAY_H
+
+#include <array>
+#include <cstdint>
+
+#include "VoxelArray.h"
+
+namespace voxelity {
+    // Niveaux d'écoulement d'un chunk : un quartet par voxel (deux voxels par octet).
+    // Bits 0-2 : distance à la source (0 = source), bit 3 : fluide en chute.
+    // N'a de sens que pour les voxels liquides.
+    class FluidArray {
+    public:
+        static constexpr uint8_t LEVEL_MASK = 0x07;
+        static constexpr uint8_t FALLING = 0x08;
+
+        FluidArray();
+
+        uint8_t get(int x, int y, int z) const;
+
+        void set(int x, int y, int z, uint8_t state);
+
+        // Remise à zéro d'une ligne X [minX, maxX]
+        void clearRow(int minX, int maxX, int y, int z);
+
+        void clear();
+
+        // Octets bruts (VOLUME / 2), pour la sérialisation
+        static constexpr size_t BYTE_SIZE = VoxelArray::VOLUME / 2;
+        const uint8_t *data() const { return states.data(); }
+        uint8_t *data() { return states.data(); }
+
+        static uint8_t getLevel(const uint8_t state) { return state & LEVEL_MASK; }
+        static bool isFalling(const uint8_t state) { return (state & FALLING) != 0; }
+
+    private:
+        static int index(int x, int y, int z);
+
+        std::array<uint8_t, BYTE_SIZE> states;
+    };
+}
+
+#endif //VOXELITY_FLUIDARRAY_H
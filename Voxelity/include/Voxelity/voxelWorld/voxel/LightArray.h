@@ -0,0 +1,42 @@
+#ifndef VOXELITY_LIGHTARRAY_H
+#define VOXELITY_LIGHTARRAY_H
+
+#include <array>
+#include <cstdint>
+
+#include "VoxelArray.h"
+
+namespace voxelity {
+    // Lumière d'un chunk : un octet par voxel,
+    // lumière du ciel dans le quartet haut, lumière des blocs dans le quartet bas
+    class LightArray {
+    public:
+        static constexpr uint8_t MAX_LEVEL = 15;
+
+        LightArray();
+
+        // Valeur combinée (ciel << 4 | bloc)
+        uint8_t get(int x, int y, int z) const;
+
+        uint8_t getSky(int x, int y, int z) const;
+
+        uint8_t getBlock(int x, int y, int z) const;
+
+        void setSky(int x, int y, int z, uint8_t level);
+
+        void setBlock(int x, int y, int z, uint8_t level);
+
+        void clear();
+
+        static uint8_t pack(const uint8_t sky, const uint8_t block) { return static_cast<uint8_t>(sky << 4 | block); }
+        static uint8_t unpackSky(const uint8_t light) { return light >> 4; }
+        static uint8_t unpackBlock(const uint8_t light) { return light & 0x0F; }
+
+    private:
+        static int index(int x, int y, int z);
+
+        std::array<uint8_t, VoxelArray::VOLUME> levels;
+    };
+}
+
+#endif //VOXELITY_LIGHTARRAY_H
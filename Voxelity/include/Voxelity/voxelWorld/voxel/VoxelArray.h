@@ -11,6 +11,11 @@ namespace voxelity {
         static constexpr int SIZE = 32;
         static constexpr int VOLUME = SIZE * SIZE * SIZE;
 
+        // SIZE étant une puissance de 2 : coord >> SHIFT = chunk, coord & MASK = local
+        static constexpr int SHIFT = 5;
+        static constexpr int MASK = SIZE - 1;
+        static_assert(1 << SHIFT == SIZE, "VoxelArray::SIZE doit être une puissance de 2");
+
         VoxelArray();
 
         VoxelType get(int x, int y, int z) const;
@@ -19,6 +24,15 @@ namespace voxelity {
 
         void fill(VoxelType ID);
 
+        // Ligne contiguë de SIZE voxels selon X
+        const VoxelType *getRow(int y, int z) const;
+
+        VoxelType *getRow(int y, int z);
+
+        // Tableau complet de VOLUME voxels (sérialisation)
+        const VoxelType *data() const { return voxels.data(); }
+        VoxelType *data() { return voxels.data(); }
+
         static double getMemoryUsage();
 
     private:
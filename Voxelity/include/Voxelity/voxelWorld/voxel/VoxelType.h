@@ -24,6 +24,7 @@ namespace voxelity {
         bool hasCollision;
         float friction = 0.6f; // Coefficient de friction
         float bounciness = 0.0f; // Coefficient de rebond
+        uint8_t lightEmission = 0; // Niveau de lumière émise (0-15)
 
         explicit VoxelDefinition(
             std::string_view displayName = "Unknown Block",
@@ -84,6 +85,8 @@ namespace voxelity {
 
         void setBounciness(VoxelType voxelID, float bounciness) noexcept;
 
+        void setLightEmission(VoxelType voxelID, uint8_t level) noexcept;
+
         void resetToDefaults() noexcept;
     };
 
@@ -114,6 +117,11 @@ namespace voxelity {
 
     [[nodiscard]] bool isVoxelSolid(VoxelType voxelID) noexcept;
 
+    [[nodiscard]] uint8_t getVoxelLightEmission(VoxelType voxelID) noexcept;
+
+    // Les blocs opaques arrêtent la lumière, les autres la laissent passer
+    [[nodiscard]] bool doesVoxelBlockLight(VoxelType voxelID) noexcept;
+
     [[nodiscard]] bool shouldRenderVoxelFace(VoxelType currentVoxel, VoxelType neighborVoxel) noexcept;
 }
 
@@ -3,39 +3,67 @@
 
 #include <functional>
 #include <unordered_map>
-#include <unordered_set>
 #include <queue>
 #include <thread>
 #include <mutex>
+#include <shared_mutex>
 #include <condition_variable>
 #include <atomic>
+#include <chrono>
 
 #include "Ashen/Core/Types.h"
 
 #include "Voxelity/voxelWorld/chunk/Chunk.h"
+#include "Voxelity/voxelWorld/generation/GenerationStage.h"
 
 namespace voxelity {
     class ITerrainGenerator;
+    class ChunkInstanceBuffer;
+    class ColumnCache;
+    class LightEngine;
+    class LodManager;
+    class RegionStorage;
     class World;
 
     struct ChunkLoadRequest {
         ChunkCoord coord;
         int priority;
+        GenerationStage stage = GenerationStage::DENSITY;
 
         bool operator<(const ChunkLoadRequest &other) const {
             return priority > other.priority;
         }
     };
 
+    // Chunk en cours de génération, avancé étape par étape par les workers
+    struct ProtoChunk {
+        std::unique_ptr<VoxelArray> voxels;
+        ash::Ref<const ColumnData> column; // Posée par l'étape DENSITY, lue par les voisins ensuite
+        GenerationStage nextStage = GenerationStage::DENSITY;
+        int priority = 0; // Reprise à chaque remise en file
+        bool waiting = false; // En attente des voisins pour lancer nextStage
+    };
+
     struct GeneratedChunkData {
         ChunkCoord coord;
         std::unique_ptr<VoxelArray> voxelData;
+        ash::Own<FluidArray> fluidData;
+        bool fromStorage = false; // Déjà à jour sur disque
     };
 
     struct MeshData {
         ChunkCoord coord;
         ash::Vector<FaceInstance> opaqueFaces;
         ash::Vector<FaceInstance> transparentFaces;
+        ChunkVisibility visibility;
+    };
+
+    // Statistiques de la dernière sauvegarde du monde
+    struct WorldSaveStats {
+        size_t chunkCount = 0;
+        size_t byteCount = 0; // Après encodage
+        double pauseMs = 0.0; // Thread principal : capture des instantanés
+        double durationMs = 0.0; // De la demande à la dernière écriture
     };
 
     struct MeshBuildRequest {
@@ -59,7 +87,14 @@ namespace voxelity {
 
         Chunk *getChunk(const ChunkCoord &coord);
 
-        Chunk *getOrCreateChunk(const ChunkCoord &coord);
+        // Workers : le chunk reste valide tant que la référence est tenue, même s'il est
+        // déchargé entre-temps par le thread principal
+        ash::Ref<Chunk> acquireChunk(const ChunkCoord &coord) const;
+
+        // Chunk à modifier (thread principal). Un chunk absent n'est créé vide que dans un monde
+        // sans générateur ni stockage : ailleurs ses données existent ou vont arriver, et un chunk
+        // vide les écraserait. nullptr : la modification est abandonnée
+        Chunk *getEditableChunk(const ChunkCoord &coord);
 
         void unloadChunk(const ChunkCoord &coord);
 
@@ -70,6 +105,9 @@ namespace voxelity {
 
         void processCompletedMeshes();
 
+        // Reconstruit les meshes dont la lumière a changé
+        void processLighting();
+
         void markChunkForMeshRebuild(const ChunkCoord &coord, int priority = 9999);
 
         void forEachChunk(const std::function<void(const ChunkCoord &, Chunk *)> &func);
@@ -83,15 +121,86 @@ namespace voxelity {
 
         size_t getPendingMeshCount();
 
+        LightEngine &getLightEngine() { return *m_lightEngine; }
+
+        LodManager &getLodManager() { return *m_lodManager; }
+
+        // Faces de tous les chunks chargés, pour le rendu
+        ChunkInstanceBuffer &getInstanceBuffer() { return *m_instanceBuffer; }
+
+        // Persistance (optionnelle, à configurer avant le premier chargement) :
+        // les chunks sont relus depuis le disque au lieu d'être régénérés,
+        // et les chunks modifiés sont sauvegardés par les workers au déchargement
+        void setStorage(ash::Own<RegionStorage> storage);
+
+        bool hasStorage() const { return m_storage != nullptr; }
+
+        // Sauvegarde asynchrone (thread principal, entre deux ticks) : capture un instantané
+        // de chaque chunk modifié puis réécrit les régions concernées sur les workers.
+        // false si une sauvegarde est déjà en cours
+        bool requestSave();
+
+        bool isSaving() const { return m_saveInProgress; }
+
+        WorldSaveStats getLastSaveStats();
+
+        // Sauvegarde synchrone de tous les chunks modifiés et des sauvegardes en attente
+        void saveAll();
+
+        size_t getPendingSaveCount();
+
         void clear();
 
         void shutdown();
 
     private:
-        // Données principales (thread principal uniquement)
-        std::unordered_map<ChunkCoord, ash::Own<Chunk> > m_chunks;
+        // Données principales : modifiées par le thread principal uniquement,
+        // lues par les workers sous verrou partagé (voir acquireChunk)
+        ash::FlatHashMap<ChunkCoord, ash::Ref<Chunk> > m_chunks;
+        mutable std::shared_mutex m_chunksMutex;
         ash::Own<ITerrainGenerator> m_generator;
 
+        ash::Own<ColumnCache> m_columnCache;
+        ash::Own<LightEngine> m_lightEngine;
+        ash::Own<RegionStorage> m_storage;
+        ash::Own<LodManager> m_lodManager; // Détruit avant le générateur et le cache de colonnes qu'il utilise
+        ash::Own<ChunkInstanceBuffer> m_instanceBuffer;
+
+        // Version d'un chunk en attente d'écriture, relue ici si le chunk est redemandé entre-temps.
+        // sequence croît à chaque instantané : seule la version la plus récente est écrite.
+        struct PendingSave {
+            ChunkSnapshot snapshot;
+            uint64_t sequence = 0;
+        };
+
+        struct SaveProgress {
+            std::chrono::steady_clock::time_point start;
+            double pauseMs = 0.0;
+            std::atomic<size_t> remainingJobs{0};
+            std::atomic<size_t> chunkCount{0};
+            std::atomic<size_t> byteCount{0};
+        };
+
+        // Chunks d'une même région ; rewrite : réécriture atomique de la région
+        struct SaveJob {
+            ash::Vector<ChunkCoord> chunks;
+            bool rewrite = false;
+            ash::Ref<SaveProgress> progress; // nullptr hors sauvegarde du monde
+        };
+
+        std::unordered_map<ChunkCoord, PendingSave> m_pendingSaves;
+        std::mutex m_pendingSavesMutex;
+        uint64_t m_saveSequence = 0; // Protégé par m_pendingSavesMutex
+        std::queue<SaveJob> m_saveQueue; // Protégée par m_generationQueueMutex
+
+        std::atomic<bool> m_saveInProgress{false};
+        WorldSaveStats m_lastSaveStats;
+        std::mutex m_saveStatsMutex;
+
+        // Chunks en cours de génération (une tâche par étape)
+        std::unordered_map<ChunkCoord, ash::Ref<ProtoChunk> > m_protoChunks;
+        std::mutex m_protoChunksMutex;
+
         // Files thread-safe pour communication inter-threads
         std::priority_queue<ChunkLoadRequest> m_generationQueue;
         std::mutex m_generationQueueMutex;
@@ -108,7 +217,7 @@ namespace voxelity {
         std::mutex m_completedMeshesMutex;
 
         // État
-        std::unordered_set<ChunkCoord> m_chunksInQueue;
+        ash::FlatHashSet<ChunkCoord> m_chunksInQueue;
         std::atomic<bool> m_running{true};
 
         glm::ivec3 m_lastPlayerChunk{0, 0, 0};
@@ -125,10 +234,36 @@ namespace voxelity {
 
         void queueChunkLoad(const ChunkCoord &coord, int priority);
 
+        // Workers : lecture depuis le disque (ou une sauvegarde en attente) et écriture
+        bool loadStoredChunk(GeneratedChunkData &data);
+
+        void runSave(const SaveJob &job);
+
+        // À appeler avec m_pendingSavesMutex verrouillé
+        void addPendingSave(const ChunkCoord &coord, Chunk &chunk);
+
+        void finishSave(const SaveProgress &progress);
+
+        int getChunkPriority(const ChunkCoord &coord) const;
+
+        // Demande le mesh d'un chunk prêt et de ses voisins qui l'attendaient
+        void requestMeshWithNeighbors(const ChunkCoord &coord);
+
         static ash::Vector<ChunkCoord> getChunksInRadius(const glm::ivec3 &center, int radius);
 
         // Génération et construction de mesh (appelées depuis les threads)
-        std::unique_ptr<VoxelArray> generateChunkData(const ChunkCoord &coord) const;
+        void runGenerationStage(const ChunkLoadRequest &request);
+
+        // À appeler avec m_protoChunksMutex verrouillé
+        bool areStageDependenciesMet(const ChunkCoord &coord, GenerationStage stage) const;
+
+        void scheduleStage(const ChunkCoord &coord, ProtoChunk &proto);
+
+        void wakeWaitingNeighbors(const ChunkCoord &coord);
+
+        // Colonnes 3 x 3 autour du chunk : celles des voisins qui ont passé leur étape DENSITY,
+        // le cache pour les voisins hors du pipeline
+        void gatherNeighborColumns(const ChunkCoord &coord, std::array<ash::Ref<const ColumnData>, 9> &columns);
 
         MeshData buildChunkMesh(const ChunkCoord &coord);
 
@@ -136,6 +271,8 @@ namespace voxelity {
         bool areNeighborsLoaded(const ChunkCoord &coord);
 
         VoxelType getVoxelSafe(int worldX, int worldY, int worldZ) const;
+
+        uint8_t getLightSafe(int worldX, int worldY, int worldZ) const;
     };
 }
 
@@ -0,0 +1,137 @@
+#ifndef VOXELITY_LIGHTENGINE_H
+#define VOXELITY_LIGHTENGINE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <glm/glm.hpp>
+
+#include "Ashen/Core/Types.h"
+
+#include "Voxelity/voxelWorld/chunk/Chunk.h"
+
+namespace voxelity {
+    class ChunkManager;
+
+    enum class LightChannel : uint8_t {
+        SKY = 0,
+        BLOCK = 1
+    };
+
+    struct LightNode {
+        glm::ivec3 pos; // Coordonnées monde
+        uint8_t level;
+    };
+
+    // Résultats récupérés par le thread principal
+    struct LightResults {
+        ash::Vector<ChunkCoord> litChunks; // Premier éclairage terminé
+        ash::Vector<ChunkCoord> relitChunks; // Lumière modifiée, mesh à reconstruire
+    };
+
+    // Propagation de la lumière par parcours en largeur (ciel + blocs).
+    // Les tâches sont traitées dans l'ordre par un thread dédié ; les files BFS
+    // sont en coordonnées monde et traversent librement les frontières de chunks.
+    class LightEngine {
+    public:
+        explicit LightEngine(ChunkManager &chunkManager);
+
+        ~LightEngine();
+
+        LightEngine(const LightEngine &) = delete;
+
+        LightEngine &operator=(const LightEngine &) = delete;
+
+        // Éclairage complet d'un chunk nouvellement chargé
+        void enqueueChunk(const ChunkCoord &coord);
+
+        // Ré-éclairage d'un chunk après une modification en masse. Sans effet si un ré-éclairage
+        // du chunk attend déjà en file : il lira les voxels à jour
+        void enqueueRelight(const ChunkCoord &coord);
+
+        // Mise à jour incrémentale après la modification d'un voxel
+        void enqueueVoxelChange(const glm::ivec3 &worldPos);
+
+        // Thread principal
+        LightResults takeResults();
+
+        // Tâches en file, plus celle en cours : 0 une fois toute la lumière demandée propagée
+        size_t getPendingJobCount();
+
+        void clear();
+
+        void shutdown();
+
+    private:
+        enum class JobType : uint8_t {
+            CHUNK,
+            RELIGHT,
+            VOXEL
+        };
+
+        struct LightJob {
+            JobType type;
+            ChunkCoord coord;
+            glm::ivec3 worldPos{0};
+        };
+
+        // État d'une propagation : files par canal, chunks touchés et cache du dernier chunk.
+        // Les chunks rencontrés restent en vie jusqu'à la fin de la tâche, même déchargés entre-temps ;
+        // le verrou de lumière du chunk en cache est tenu jusqu'au passage à un autre chunk
+        struct Propagation {
+            ash::Deque<LightNode> addQueues[2];
+            ash::Deque<LightNode> removeQueues[2];
+            ash::HashSet<ChunkCoord> touched;
+
+            ash::HashMap<ChunkCoord, ash::Ref<Chunk> > chunks;
+
+            ChunkCoord cachedCoord;
+            Chunk *cachedChunk = nullptr;
+            bool hasCache = false;
+            std::unique_lock<std::mutex> lightLock; // Déclaré après chunks : relâché avant eux
+        };
+
+        ChunkManager &m_chunkManager;
+
+        std::deque<LightJob> m_jobs;
+        ash::HashSet<ChunkCoord> m_pendingRelights; // Tâches RELIGHT encore en file
+        bool m_jobRunning = false; // Protégé par m_jobsMutex
+        std::mutex m_jobsMutex;
+        std::condition_variable m_jobsCV;
+
+        LightResults m_results;
+        std::mutex m_resultsMutex;
+
+        std::atomic<bool> m_running{true};
+        std::thread m_thread;
+
+        void worker();
+
+        void processJob(const LightJob &job);
+
+        void lightChunk(Propagation &propagation, const ChunkCoord &coord, bool relight);
+
+        void updateVoxel(Propagation &propagation, const glm::ivec3 &worldPos);
+
+        void propagateRemovals(Propagation &propagation, LightChannel channel);
+
+        void propagateAdditions(Propagation &propagation, LightChannel channel);
+
+        // Accès aux voxels et à la lumière en coordonnées monde. Le chunk renvoyé a son verrou
+        // de lumière tenu jusqu'au prochain appel qui change de chunk : getLevel et setLevel
+        // ne s'utilisent que sur le dernier chunk obtenu
+        Chunk *chunkAt(Propagation &propagation, const glm::ivec3 &worldPos) const;
+
+        static uint8_t getLevel(const Chunk &chunk, LightChannel channel, const glm::ivec3 &worldPos);
+
+        void setLevel(Propagation &propagation, Chunk &chunk, LightChannel channel,
+                      const glm::ivec3 &worldPos, uint8_t level) const;
+
+        // Pousse dans la file d'ajout les voisins éclairés de worldPos
+        void pullFromNeighbors(Propagation &propagation, const glm::ivec3 &worldPos) const;
+    };
+}
+
+#endif //VOXELITY_LIGHTENGINE_H
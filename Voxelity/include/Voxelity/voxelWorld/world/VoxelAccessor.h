@@ -0,0 +1,52 @@
+#ifndef VOXELITY_VOXELACCESSOR_H
+#define VOXELITY_VOXELACCESSOR_H
+
+#include <array>
+#include <glm/glm.hpp>
+
+#include "Voxelity/voxelWorld/chunk/Chunk.h"
+
+namespace voxelity {
+    class World;
+
+    // Accès rapide aux voxels pour des requêtes spatialement cohérentes
+    // (physique, raycast, parcours de voisins). Garde en cache le voisinage
+    // 3x3x3 de chunks autour du dernier chunk consulté : la plupart des lectures
+    // évitent la table de hachage du ChunkManager.
+    // Objet local, non thread-safe, à ne pas conserver d'une frame à l'autre
+    // (les chunks peuvent être déchargés).
+    class VoxelAccessor {
+    public:
+        explicit VoxelAccessor(const World &world);
+
+        VoxelType get(int x, int y, int z);
+
+        VoxelType get(const glm::ivec3 &worldPos) { return get(worldPos.x, worldPos.y, worldPos.z); }
+
+        // nullptr si le chunk n'est pas chargé
+        const Chunk *getChunk(const ChunkCoord &coord);
+
+        // Copie la région monde [min, max] (bornes incluses) dans dst, X contigu puis Z puis Y :
+        // un seul verrou par chunk traversé, les chunks absents sont lus comme de l'air
+        void copyRegion(const glm::ivec3 &min, const glm::ivec3 &max, VoxelType *dst);
+
+        // Oublie le voisinage en cache (après un chargement / déchargement de chunks)
+        void invalidate();
+
+    private:
+        static constexpr int NEIGHBORHOOD = 3;
+
+        const World &m_world;
+
+        ChunkCoord m_center;
+        bool m_hasCenter = false;
+
+        // Un chunk absent est aussi mis en cache : m_fetched distingue "absent" de "pas encore cherché"
+        std::array<const Chunk *, NEIGHBORHOOD * NEIGHBORHOOD * NEIGHBORHOOD> m_chunks{};
+        uint32_t m_fetched = 0;
+
+        void recenter(const ChunkCoord &coord);
+    };
+}
+
+#endif //VOXELITY_VOXELACCESSOR_H
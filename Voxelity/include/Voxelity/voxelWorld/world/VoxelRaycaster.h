@@ -6,6 +6,7 @@
 
 namespace voxelity {
     class World;
+    class VoxelAccessor;
 
     struct RaycastHit {
         glm::ivec3 blockPos; // Position du bloc touché
@@ -36,7 +37,7 @@ namespace voxelity {
         [[nodiscard]] std::optional<RaycastHit> performDDA(const glm::vec3 &origin, const glm::vec3 &direction) const;
 
         // Vérifie si un bloc existe à la position donnée
-        [[nodiscard]] bool isBlockSolid(const glm::ivec3 &pos) const;
+        [[nodiscard]] static bool isBlockSolid(VoxelAccessor &voxels, const glm::ivec3 &pos);
 
         // Calcule la normale de la face touchée
         static glm::ivec3 calculateFaceNormal(const glm::ivec3 &blockPos, const glm::ivec3 &previousPos);
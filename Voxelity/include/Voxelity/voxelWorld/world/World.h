@@ -1,28 +1,75 @@
 #ifndef VOXELITY_WORLD_H
 #define VOXELITY_WORLD_H
 
+#include <filesystem>
+
 #include "Ashen/Core/Types.h"
+#include "Ashen/Math/Math.h"
+#include "Ashen/Math/BBox.h"
 
 #include "Voxelity/voxelWorld/chunk/Chunk.h"
 #include "Voxelity/voxelWorld/voxel/VoxelType.h"
 #include "Voxelity/voxelWorld/world/ChunkManager.h"
 
 namespace voxelity {
+    class BlockTicker;
+    class FluidSimulator;
+    class ChunkInstanceBuffer;
+    class LodManager;
+
+    // Modification d'un voxel en coordonnées monde
+    struct VoxelEdit {
+        glm::ivec3 position;
+        VoxelType type;
+    };
+
     class World {
     public:
+        // Boîte monde (bornes incluses) recouvrant des voxels modifiés, appelé sur le thread principal
+        using VoxelChangeListener = std::function<void(const ash::BBox3i &box)>;
+
         explicit World(ash::Own<ITerrainGenerator> generator);
 
-        ~World() = default;
+        ~World();
 
         // Accès aux voxels
         VoxelType getVoxel(int worldX, int worldY, int worldZ) const;
 
         VoxelType getVoxel(const glm::ivec3 &worldPos) const;
 
+        // Une modification qui tombe dans un chunk non chargé (en génération ou encore sur disque)
+        // est abandonnée : un chunk vide écraserait ses données (voir ChunkManager::getEditableChunk)
         void setVoxel(int worldX, int worldY, int worldZ, VoxelType type);
 
         void setVoxel(const glm::ivec3 &worldPos, VoxelType type);
 
+        // Modifications groupées : regroupées par chunk, un verrou par chunk
+        // et une seule demande de reconstruction de mesh par chunk touché.
+        // Les modifications sans effet ne notifient personne. Comme pour setVoxel, celles qui tombent
+        // dans un chunk non chargé sont abandonnées : renvoie leur nombre
+        size_t setVoxels(std::span<const VoxelEdit> edits);
+
+        // Lot produit par une simulation (liquides) : mêmes écritures que setVoxels, mais les blocs
+        // voisins et l'auditeur sont prévenus une fois par chunk touché, et les liquides ne sont pas
+        // réactivés (la simulation gère elle-même ses cellules actives)
+        size_t applySimulationEdits(std::span<const VoxelEdit> edits);
+
+        // Bornes de la boîte incluses. Comme setVoxels, les parties non chargées sont ignorées
+        void fillBox(const ash::BBox3i &box, VoxelType type);
+
+        void fillSphere(const glm::ivec3 &center, int radius, VoxelType type);
+
+        void replace(const ash::BBox3i &box, VoxelType from, VoxelType to);
+
+        // Copie d'une région (bornes incluses) vers un tampon plat : X contigu, puis Z, puis Y,
+        // soit index = x + sizeX * (z + sizeZ * y). Les chunks non chargés sont remplis avec fill.
+        void copyRegion(const ash::BBox3i &box, std::span<VoxelType> out, VoxelType fill = VoxelID::AIR) const;
+
+        // Inverse de copyRegion, même disposition du tampon ; les chunks non chargés sont ignorés
+        void pasteRegion(const ash::BBox3i &box, std::span<const VoxelType> voxels);
+
+        static size_t getRegionVolume(const ash::BBox3i &box);
+
         // Accès aux chunks
         Chunk *getChunk(const ChunkCoord &coord) const;
 
@@ -36,6 +83,34 @@ namespace voxelity {
 
         void processMeshBuilding() const;
 
+        // Sauvegarde des chunks dans des fichiers de région (à appeler avant le premier chargement)
+        void enablePersistence(const std::filesystem::path &directory) const;
+
+        // Écrit tous les chunks modifiés (bloquant)
+        void save() const;
+
+        // Sauvegarde en arrière-plan d'un instantané cohérent (à appeler entre deux ticks)
+        bool requestSave() const;
+
+        bool isSaving() const;
+
+        WorldSaveStats getLastSaveStats() const;
+
+        // Tick de simulation des blocs (pas fixe, thread principal)
+        void tick();
+
+        BlockTicker &getBlockTicker() const { return *m_blockTicker; }
+
+        FluidSimulator &getFluidSimulator() const { return *m_fluidSimulator; }
+
+        // Réveil des corps physiques endormis sur les voxels modifiés
+        void setVoxelChangeListener(VoxelChangeListener listener) { m_voxelChangeListener = std::move(listener); }
+
+        // Terrain lointain en niveaux de détail
+        LodManager &getLodManager() const { return m_chunkManager->getLodManager(); }
+
+        ChunkInstanceBuffer &getInstanceBuffer() const { return m_chunkManager->getInstanceBuffer(); }
+
         // Itération sur les chunks
         void forEachChunk(const std::function<void(const ChunkCoord &, Chunk *)> &func) const;
 
@@ -60,13 +135,59 @@ namespace voxelity {
 
         size_t getPendingMeshCount() const;
 
+        size_t getPendingLightCount() const;
+
         void clear() const;
 
     private:
+        // Au-delà de ce nombre de cellules modifiées dans un même chunk, setVoxels ré-éclaire
+        // ce chunk entier plutôt que voxel par voxel
+        static constexpr size_t INCREMENTAL_LIGHT_EDIT_LIMIT = 64;
+
         ash::Own<ChunkManager> m_chunkManager;
+        ash::Own<BlockTicker> m_blockTicker;
+        ash::Own<FluidSimulator> m_fluidSimulator;
+        VoxelChangeListener m_voxelChangeListener;
+
+        // notifyCells : ticks de voisinage et liquides prévenus cellule par cellule, sinon par chunk
+        size_t applyEdits(std::span<const VoxelEdit> edits, bool notifyCells);
 
         void markNeighborChunksDirty(const ChunkCoord &chunkCoord, const glm::ivec3 &localPos) const;
+
+        // Appelle func(chunk, localMin, localMax, chunkOrigin) pour chaque chunk modifiable recoupant la boîte
+        template<typename Func>
+        void forEachChunkInBox(const ash::BBox3i &box, Func &&func);
+
+        void collectRebuilds(const ChunkCoord &coord, const ChunkEditResult &result,
+                             ash::HashSet<ChunkCoord> &rebuilds) const;
+
+        void relightEditedChunk(const ChunkCoord &coord, const ChunkEditResult &result) const;
+
+        void flushRebuilds(const ash::HashSet<ChunkCoord> &rebuilds) const;
+
+        void notifyVoxelChange(const ash::BBox3i &box) const;
     };
+
+    template<typename Func>
+    void World::forEachChunkInBox(const ash::BBox3i &box, Func &&func) {
+        const ash::IVec3 minChunk = toChunkCoord(box.min);
+        const ash::IVec3 maxChunk = toChunkCoord(box.max);
+
+        for (int cy = minChunk.y; cy <= maxChunk.y; ++cy) {
+            for (int cz = minChunk.z; cz <= maxChunk.z; ++cz) {
+                for (int cx = minChunk.x; cx <= maxChunk.x; ++cx) {
+                    const ChunkCoord coord{cx, cy, cz};
+                    Chunk *chunk = m_chunkManager->getEditableChunk(coord);
+                    if (!chunk) continue;
+
+                    const ash::IVec3 origin = toWorldPos({cx, cy, cz});
+                    const ash::IVec3 localMin = glm::max(box.min - origin, ash::IVec3(0));
+                    const ash::IVec3 localMax = glm::min(box.max - origin, ash::IVec3(VoxelArray::SIZE - 1));
+                    func(coord, *chunk, localMin, localMax, origin);
+                }
+            }
+        }
+    }
 }
 
 #endif
\ No newline at end of file
@@ -2,7 +2,7 @@
 
 in vec4 vBlockColor;
 in vec3 vFaceNormal;
-in float vAO;
+in float vLight;
 
 out vec4 FragColor;
 
@@ -15,11 +15,10 @@ void main() {
     float diff = max(dot(normalize(vFaceNormal), lightDir), 0.0);
     diff = mix(minLight, maxLight, diff);
 
-    // Appliquer l'ambient occlusion
-    // L'AO assombrit les coins et arêtes
-    float aoFactor = mix(0.4, 1.0, vAO);// Plus sombre dans les coins
+    // Lumière propagée : les grottes restent sombres, courbe quadratique
+    float lightFactor = mix(0.08, 1.0, vLight * vLight);
 
-    vec3 color = vBlockColor.rgb * diff * aoFactor;
+    vec3 color = vBlockColor.rgb * diff * lightFactor;
 
     FragColor = vec4(color, vBlockColor.a);
 }
\ No newline at end of file
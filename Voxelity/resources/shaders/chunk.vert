@@ -1,4 +1,5 @@
 #version 430 core
+#extension GL_ARB_shader_draw_parameters : require
 
 layout (location = 0) in uint iData;
 
@@ -6,10 +7,17 @@ uniform mat4 u_ViewProjection;
 uniform vec3 u_ChunkPos;
 uniform sampler1D u_ColorTex;
 uniform float u_ChunkSpacing = 1.f;
+uniform float u_VoxelScale = 1.f;// Taille d'une cellule (noeuds LOD : 2, 4 ou 8 voxels)
+uniform bool u_MultiDraw = false;// Chunks soumis en un seul glMultiDrawArraysIndirect
+
+// Origine (xyz) et taille de cellule (w) de chaque commande, indexées par gl_DrawIDARB
+layout (std430, binding = 0) readonly buffer ChunkOrigins {
+    vec4 chunkOrigins[];
+};
 
 out vec4 vBlockColor;
 out vec3 vFaceNormal;
-out float vAO;// Ambient Occlusion per vertex
+out float vLight;// Lumière ciel / blocs (0-1)
 
 const vec3 FACE_QUAD[6][6] = vec3[6][6](
 vec3[6](vec3(0, 0, 1), vec3(1, 0, 1), vec3(1, 1, 1), vec3(0, 0, 1), vec3(1, 1, 1), vec3(0, 1, 1)), // Z+
@@ -35,14 +43,23 @@ void main() {
     uint z = (iData >> 10u) & 31u;
     uint faceID = (iData >> 15u) & 7u;
     uint voxelID = (iData >> 18u) & 255u;
-    uint aoData = (iData >> 26u) & 3u;// 2 bits pour AO (0-3)
+    uint skyLight = (iData >> 26u) & 7u;// 3 bits (niveau 0-15 / 2)
+    uint blockLight = (iData >> 29u) & 7u;
 
     vec3 voxelPos = vec3(float(x), float(y), float(z));
     vec4 localPos = vec4(FACE_QUAD[faceID][gl_VertexID], 1.0);
 
+    vec3 chunkPos = u_ChunkPos;
+    float voxelScale = u_VoxelScale;
+    if (u_MultiDraw) {
+        vec4 origin = chunkOrigins[gl_DrawIDARB];
+        chunkPos = origin.xyz;
+        voxelScale = origin.w;
+    }
+
     // Position monde
-    vec4 worldPos = vec4(u_ChunkPos * u_ChunkSpacing + voxelPos, 0.0) + localPos;
-    gl_Position = u_ViewProjection * vec4(worldPos.xyz, 1.0);
+    vec3 worldPos = chunkPos * u_ChunkSpacing + (voxelPos + localPos.xyz) * voxelScale;
+    gl_Position = u_ViewProjection * vec4(worldPos, 1.0);
 
     // Couleur bloc
     float texSize = float(textureSize(u_ColorTex, 0));
@@ -52,8 +69,6 @@ void main() {
     // Normale face
     vFaceNormal = FACE_NORMALS[faceID];
 
-    // Ambient Occlusion : convertir 0-3 en facteur d'ombrage
-    // 0 = coin complètement occlus (plus sombre)
-    // 3 = pas d'occlusion (plus clair)
-    vAO = 1.0 - (float(aoData) * 0.25);// 1.0, 0.75, 0.5, 0.25
+    // La plus forte des deux lumières éclaire la face
+    vLight = float(max(skyLight, blockLight)) / 7.0;
 }
\ No newline at end of file
@@ -0,0 +1,146 @@
+#include "Voxelity/entities/EntityManager.h"
+
+#include "Voxelity/entities/Player.h"
+#include "Voxelity/voxelWorld/world/World.h"
+
+namespace voxelity {
+    EntityManager::EntityManager()
+        : m_physics(m_registry),
+          m_players(m_registry),
+          m_fallingBlocks(m_registry),
+          m_moving(m_registry, ash::MaskOf<Sleeping>()) {
+        PhysicsConfig fallingBlockConfig;
+        fallingBlockConfig.gravity = -32.0f;
+        fallingBlockConfig.groundFriction = 0.8f; // Plus de friction pour s'arrêter vite
+        m_fallingBlockConfig = m_physics.addConfig(fallingBlockConfig);
+
+        // Les entrées du joueur sont lues sur le thread principal : seul dans sa première étape,
+        // le système y est exécuté directement
+        m_scheduler.Add("players", ash::SystemAccess::Of<Transform, Motion, const Collider, const PlayerControl>(),
+                        [this](const float deltaTime) { updatePlayers(deltaTime); });
+        m_scheduler.Add("physics", ash::SystemAccess::Exclusive(),
+                        [this](const float deltaTime) { m_physics.step(deltaTime, *m_world); });
+
+        // Indépendants : exécutés en parallèle
+        m_scheduler.Add("fallingBlocks", ash::SystemAccess::Of<FallingBlock, const Motion, const Transform>(),
+                        [this](const float deltaTime) { updateFallingBlocks(deltaTime); });
+        m_scheduler.Add("spatialHash", ash::SystemAccess::Of<const Transform, const Collider>(),
+                        [this](float) { updateSpatialHash(); });
+
+        m_scheduler.Add("applyFallingBlocks", ash::SystemAccess::Exclusive(),
+                        [this](float) { applyFallingBlocks(); });
+    }
+
+    ash::EntityId EntityManager::createBody(const glm::vec3 &position, const Collider &collider) {
+        Transform transform;
+        transform.position = position;
+        transform.saveState();
+
+        const ash::EntityId entity = m_registry.Create(transform, Motion{}, collider);
+        m_spatial.insert(entity, collider.getBounds(position));
+        return entity;
+    }
+
+    ash::EntityId EntityManager::spawnFallingBlock(const glm::vec3 &position, const VoxelType type,
+                                                   const float lifetime) {
+        Transform transform;
+        transform.position = position;
+        transform.saveState();
+
+        Collider collider;
+        collider.size = glm::vec3(0.98f); // Légèrement plus petit qu'un bloc
+
+        // Archétype final dès la création : aucun déplacement entre archétypes
+        const ash::EntityId entity = m_registry.Create(transform, Motion{}, collider,
+                                                       RigidBody{m_fallingBlockConfig, 0},
+                                                       FallingBlock{type, 0.0f, lifetime});
+        m_spatial.insert(entity, collider.getBounds(position));
+        return entity;
+    }
+
+    void EntityManager::destroyEntity(const ash::EntityId entity) {
+        if (m_registry.IsAlive(entity)) m_pendingDestroy.push_back(entity);
+    }
+
+    void EntityManager::updateAll(const float deltaTime, World &world) {
+        m_world = &world;
+        m_scheduler.Run(deltaTime);
+        m_world = nullptr;
+
+        flushDestroyed();
+    }
+
+    void EntityManager::clear() {
+        // Le corps des joueurs est gardé : Player conserve son identifiant
+        ash::Vector<ash::EntityId> entities;
+        for (const ash::Archetype *archetype: m_registry.Match(0, ash::MaskOf<PlayerControl>())) {
+            for (ash::Size chunk = 0; chunk < archetype->GetChunkCount(); ++chunk) {
+                const ash::EntityId *ids = archetype->GetEntities(chunk);
+                entities.insert(entities.end(), ids, ids + archetype->GetChunkSize(chunk));
+            }
+        }
+        for (const ash::EntityId entity: entities) {
+            m_spatial.remove(entity);
+            m_registry.Destroy(entity);
+        }
+
+        m_pendingDestroy.clear();
+        m_physics.clear();
+        m_landings.clear();
+        m_expired.clear();
+    }
+
+    void EntityManager::updatePlayers(const float deltaTime) {
+        m_players.Each([this, deltaTime](ash::EntityId, Transform &transform, Motion &motion,
+                                         const Collider &collider, const PlayerControl &control) {
+            control.player->update(deltaTime, *m_world, transform, motion, collider);
+        });
+    }
+
+    void EntityManager::updateFallingBlocks(const float deltaTime) {
+        m_fallingBlocks.Each([this, deltaTime](const ash::EntityId entity, FallingBlock &block,
+                                               const Motion &motion, const Transform &transform) {
+            block.age += deltaTime;
+            if (block.age >= block.lifetime) {
+                m_expired.push_back(entity);
+                return;
+            }
+
+            // Au sol et presque immobile : redevient un bloc du monde
+            if (motion.onGround && glm::length(motion.velocity) < 0.1f)
+                m_landings.push_back({entity, glm::ivec3(glm::floor(transform.position)), block.type});
+        });
+    }
+
+    void EntityManager::updateSpatialHash() {
+        // Un corps endormi n'a pas bougé depuis sa dernière mise à jour
+        m_moving.Each([this](const ash::EntityId entity, const Transform &transform, const Collider &collider) {
+            m_spatial.update(entity, collider.getBounds(transform.position));
+        });
+    }
+
+    void EntityManager::applyFallingBlocks() {
+        for (const Landing &landing: m_landings) {
+            if (m_world->getVoxel(landing.position) == VoxelID::AIR)
+                m_world->setVoxel(landing.position, landing.type);
+            destroyEntity(landing.entity);
+        }
+        m_landings.clear();
+
+        for (const ash::EntityId entity: m_expired)
+            destroyEntity(entity);
+        m_expired.clear();
+    }
+
+    void EntityManager::flushDestroyed() {
+        // Une entité demandée deux fois n'est détruite qu'à la première
+        for (const ash::EntityId entity: m_pendingDestroy) {
+            if (!m_registry.IsAlive(entity)) continue;
+
+            m_spatial.remove(entity);
+            m_physics.removeBody(entity);
+            m_registry.Destroy(entity);
+        }
+        m_pendingDestroy.clear();
+    }
+}
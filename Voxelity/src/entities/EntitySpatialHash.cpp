@@ -0,0 +1,97 @@
+#include "Voxelity/entities/EntitySpatialHash.h"
+
+#include <cmath>
+
+namespace voxelity {
+    EntitySpatialHash::EntitySpatialHash(const float cellSize)
+        : m_cellSize(cellSize), m_inverseCellSize(1.0f / cellSize) {
+    }
+
+    glm::ivec3 EntitySpatialHash::getCell(const glm::vec3 &position) const {
+        return {
+            static_cast<int>(std::floor(position.x * m_inverseCellSize)),
+            static_cast<int>(std::floor(position.y * m_inverseCellSize)),
+            static_cast<int>(std::floor(position.z * m_inverseCellSize))
+        };
+    }
+
+    void EntitySpatialHash::insert(const ash::EntityId entity, const ash::BBox3 &bounds) {
+        if (m_locations.find(entity) != m_locations.end()) return;
+
+        add(entity, bounds);
+    }
+
+    void EntitySpatialHash::remove(const ash::EntityId entity) {
+        const auto it = m_locations.find(entity);
+        if (it == m_locations.end()) return;
+
+        const Location location = it->second;
+        m_locations.erase(entity);
+        erase(location);
+    }
+
+    void EntitySpatialHash::update(const ash::EntityId entity, const ash::BBox3 &bounds) {
+        const auto it = m_locations.find(entity);
+        if (it == m_locations.end()) return;
+
+        const glm::ivec3 cell = getCell((bounds.min + bounds.max) * 0.5f);
+        if (cell == it->second.cell) {
+            m_maxHalfExtent = glm::max(m_maxHalfExtent, (bounds.max - bounds.min) * 0.5f);
+            m_cells.find(cell)->second[it->second.index].bounds = bounds;
+            return;
+        }
+
+        const Location previous = it->second;
+        m_locations.erase(entity);
+        erase(previous);
+        add(entity, bounds);
+    }
+
+    void EntitySpatialHash::clear() {
+        m_cells.clear();
+        m_locations.clear();
+        m_maxHalfExtent = glm::vec3(0.0f);
+    }
+
+    void EntitySpatialHash::queryRadius(const glm::vec3 &center, const float radius,
+                                        ash::Vector<ash::EntityId> &out) const {
+        const float radiusSquared = radius * radius;
+        const ash::BBox3 box(center - radius, center + radius);
+
+        forEachNear(box, [&](const Entry &entry) {
+            // Point de la boîte le plus proche du centre
+            const glm::vec3 closest = glm::clamp(center, entry.bounds.min, entry.bounds.max);
+            const glm::vec3 delta = closest - center;
+            if (glm::dot(delta, delta) <= radiusSquared) out.push_back(entry.entity);
+        });
+    }
+
+    void EntitySpatialHash::queryBox(const ash::BBox3 &box, ash::Vector<ash::EntityId> &out) const {
+        forEachNear(box, [&](const Entry &entry) {
+            if (entry.bounds.Intersects(box)) out.push_back(entry.entity);
+        });
+    }
+
+    void EntitySpatialHash::add(const ash::EntityId entity, const ash::BBox3 &bounds) {
+        m_maxHalfExtent = glm::max(m_maxHalfExtent, (bounds.max - bounds.min) * 0.5f);
+
+        const glm::ivec3 cell = getCell((bounds.min + bounds.max) * 0.5f);
+        auto &bucket = m_cells[cell];
+        m_locations.emplace(entity, Location{cell, static_cast<uint32_t>(bucket.size())});
+        bucket.push_back({entity, bounds});
+    }
+
+    void EntitySpatialHash::erase(const Location &location) {
+        const auto it = m_cells.find(location.cell);
+        auto &bucket = it->second;
+
+        // Retrait par échange avec la dernière entrée de la cellule
+        if (location.index + 1 != bucket.size()) {
+            bucket[location.index] = bucket.back();
+            m_locations.find(bucket[location.index].entity)->second.index = location.index;
+        }
+        bucket.pop_back();
+
+        if (bucket.empty()) m_cells.erase(location.cell);
+    }
+}
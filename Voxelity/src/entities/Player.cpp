@@ -2,12 +2,15 @@
 
 #include "Ashen/Core/Input.h"
 
+#include "Voxelity/entities/EntityManager.h"
+
 namespace voxelity {
-    Player::Player(std::shared_ptr<ash::PerspectiveCamera> camera)
-        : m_camera(std::move(camera)) {
-        boundingBoxSize = glm::vec3(0.6f, 1.8f, 0.6f);
-        useGravity = true;
-        hasCollisions = true;
+    Player::Player(EntityManager &entities, std::shared_ptr<ash::PerspectiveCamera> camera)
+        : m_entities(entities), m_camera(std::move(camera)) {
+        Collider collider;
+        collider.size = glm::vec3(0.6f, 1.8f, 0.6f);
+        m_entity = m_entities.createBody(glm::vec3(0.0f), collider);
+        m_entities.getRegistry().Add<PlayerControl>(m_entity, PlayerControl{this});
 
         m_controller = std::make_unique<PlayerController>(m_camera);
 
@@ -20,26 +23,46 @@ namespace voxelity {
         m_physics = std::make_unique<PhysicsSystem>(physicsConfig);
     }
 
-    void Player::update(const float deltaTime, const World &world) {
-        if (!isActive) return;
+    Player::~Player() {
+        // La destruction de l'entité attend la fin du tick : le système des joueurs ne doit plus
+        // rappeler ce joueur d'ici là
+        if (m_entities.isAlive(m_entity))
+            m_entities.getRegistry().Remove<PlayerControl>(m_entity);
+        m_entities.destroyEntity(m_entity);
+    }
 
+    void Player::update(const float deltaTime, const World &world, Transform &transform, Motion &motion,
+                        const Collider &collider) {
         // Sauvegarder l'état actuel avant modification (pour interpolation)
-        saveState();
+        transform.saveState();
 
         // 1. Gérer le mouvement basé sur les inputs
-        handleMovement(deltaTime);
+        handleMovement(motion);
 
         // 2. Appliquer la physique
         if (m_isFlying) {
-            position += velocity * deltaTime;
-            onGround = false;
-        } else {
-            m_physics->step(*this, deltaTime, world);
+            transform.position += motion.velocity * deltaTime;
+            motion.onGround = false;
+            return;
         }
+
+        PhysicsBody body;
+        body.position = transform.position;
+        body.velocity = motion.velocity;
+        body.size = collider.size;
+        body.useGravity = collider.useGravity;
+        body.hasCollisions = collider.hasCollisions;
+        body.onGround = motion.onGround;
+
+        m_physics->step(body, deltaTime, world);
+
+        transform.position = body.position;
+        motion.velocity = body.velocity;
+        motion.onGround = body.onGround;
     }
 
     void Player::updateVisuals(const float alpha) {
-        if (!isActive) return;
+        if (!m_entities.isAlive(m_entity)) return;
 
         // Mise à jour du contrôleur (rotation caméra, inputs)
         // Note: deltaTime n'est plus utilisé pour les visuels
@@ -49,7 +72,18 @@ namespace voxelity {
         updateCameraPosition(alpha);
     }
 
-    void Player::handleMovement(const float deltaTime) {
+    glm::vec3 Player::getPosition() const {
+        return m_entities.getRegistry().Get<Transform>(m_entity).position;
+    }
+
+    void Player::setPosition(const glm::vec3 &position) {
+        Transform &transform = m_entities.getRegistry().Get<Transform>(m_entity);
+        transform.position = position;
+        transform.saveState();
+        m_entities.getRegistry().Get<Motion>(m_entity).velocity = glm::vec3(0.0f);
+    }
+
+    void Player::handleMovement(Motion &motion) const {
         const glm::vec3 input = m_controller->getMovementInput();
 
         if (m_isFlying) {
@@ -59,39 +93,42 @@ namespace voxelity {
                 flySpeed *= 2.0f;
             }
 
-            velocity.x = input.x * flySpeed;
-            velocity.z = input.z * flySpeed;
+            motion.velocity.x = input.x * flySpeed;
+            motion.velocity.z = input.z * flySpeed;
 
-            velocity.y = 0.0f;
+            motion.velocity.y = 0.0f;
             if (ash::Input::IsKeyPressed(ash::Key::Space)) {
-                velocity.y = flySpeed;
+                motion.velocity.y = flySpeed;
             }
             if (ash::Input::IsKeyPressed(ash::Key::LeftShift)) {
-                velocity.y = -flySpeed;
+                motion.velocity.y = -flySpeed;
             }
         } else {
-            velocity.x = input.x;
-            velocity.z = input.z;
+            motion.velocity.x = input.x;
+            motion.velocity.z = input.z;
 
-            if (m_controller->wantsToJump() && onGround) {
-                jump();
+            if (m_controller->wantsToJump() && motion.onGround) {
+                jump(motion);
             }
         }
     }
 
-    void Player::jump() {
-        if (onGround) {
-            velocity.y = m_jumpForce;
+    void Player::jump(Motion &motion) const {
+        if (motion.onGround) {
+            motion.velocity.y = m_jumpForce;
         }
     }
 
     void Player::updateCameraPosition(const float alpha) const {
+        const ash::Registry &registry = m_entities.getRegistry();
+        const glm::vec3 size = registry.Get<Collider>(m_entity).size;
+
         // Interpoler la position pour un rendu fluide
-        const glm::vec3 interpolatedPos = getInterpolatedPosition(alpha);
+        const glm::vec3 interpolatedPos = registry.Get<Transform>(m_entity).getInterpolatedPosition(alpha);
 
         constexpr float eyeHeight = 0.85f;
-        const float eyeY = interpolatedPos.y - boundingBoxSize.y * 0.5f + boundingBoxSize.y * eyeHeight;
+        const float eyeY = interpolatedPos.y - size.y * 0.5f + size.y * eyeHeight;
         const auto cameraPos = glm::vec3(interpolatedPos.x, eyeY, interpolatedPos.z);
         m_camera->SetPosition(cameraPos);
     }
-}
\ No newline at end of file
+}
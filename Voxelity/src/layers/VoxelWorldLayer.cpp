@@ -7,6 +7,9 @@
 
 #include "Voxelity/entities/Player.h"
 #include "Voxelity/voxelWorld/generation/NaturalTerrainGenerator.h"
+#include "Voxelity/voxelWorld/lod/LodManager.h"
+#include "Voxelity/voxelWorld/render/ChunkInstanceBuffer.h"
+#include "Voxelity/voxelWorld/tick/BlockTicker.h"
 
 namespace voxelity {
     VoxelWorldLayer::VoxelWorldLayer() {
@@ -55,9 +58,17 @@ namespace voxelity {
         // Exécuter les ticks physiques avec delta fixe
         int ticksExecuted = 0;
         while (m_tickAccumulator >= m_config.fixedDeltaTime && ticksExecuted < m_config.maxTicksPerFrame) {
+            m_world->tick();
             m_entityManager->updateAll(m_config.fixedDeltaTime, *m_world);
             m_tickAccumulator -= m_config.fixedDeltaTime;
             ticksExecuted++;
+
+            // Sauvegarde automatique en fin de tick : l'instantané voit un monde cohérent
+            m_autosaveTimer += m_config.fixedDeltaTime;
+            if (m_config.autosaveInterval > 0.0f && m_autosaveTimer >= m_config.autosaveInterval) {
+                m_autosaveTimer = 0.0f;
+                m_world->requestSave();
+            }
         }
 
         // Calculer l'alpha d'interpolation (entre 0 et 1)
@@ -68,7 +79,7 @@ namespace voxelity {
         m_player->updateVisuals(alpha);
 
         // Mise à jour du monde (chaque frame)
-        m_world->updateLoadedChunks(m_player->position, m_config.renderDistance);
+        m_world->updateLoadedChunks(m_player->getPosition(), m_config.renderDistance);
         m_world->processChunkLoading();
         m_world->processMeshBuilding();
 
@@ -78,6 +89,24 @@ namespace voxelity {
             ash::Logger::Info() << "Chunks: " << m_world->getLoadedChunkCount()
                     << " | Pending Load: " << m_world->getPendingLoadCount()
                     << " | Pending Mesh: " << m_world->getPendingMeshCount()
+                    << " | Pending Light: " << m_world->getPendingLightCount()
+                    << " | LOD: " << m_world->getLodManager().getMeshCount() << " meshes, "
+                    << m_world->getLodManager().getInstanceCount() << " faces, pool "
+                    << m_world->getLodManager().getMeshPoolStats().getHitRate() * 100.0 << "% hits, "
+                    << m_world->getLodManager().getMeshPoolStats().residentBytes / (1024 * 1024) << " MB"
+                    << " | Faces: " << m_world->getInstanceBuffer().getArena().getUsedCount() << " / "
+                    << m_world->getInstanceBuffer().getArena().getCapacity() << ", "
+                    << m_world->getInstanceBuffer().getArena().getFragmentation() * 100.0f << "% fragmented, "
+                    << m_world->getInstanceBuffer().getCompactionCount() << " compactions"
+                    << " | Drawn: " << m_worldRenderer->getCullingStats().drawnChunks
+                    << " | Occluded: " << m_worldRenderer->getCullingStats().occlusionCulledChunks
+                    << " | Off-screen: " << m_worldRenderer->getCullingStats().frustumCulledChunks
+                    << " | Culling: " << m_worldRenderer->getCullingStats().cullingMs << " ms, "
+                    << m_worldRenderer->getCullingStats().frustumGroups << " groups, "
+                    << m_worldRenderer->getCullingStats().frustumTestedChunks << " chunks tested"
+                    << " | Transparent: " << m_worldRenderer->getTransparentSortStats().chunks << " chunks, "
+                    << m_worldRenderer->getTransparentSortStats().resortedFaces << " faces sorted in "
+                    << m_worldRenderer->getTransparentSortStats().sortMs << " ms"
                     << " | Ticks: " << ticksExecuted
                     << " | Alpha: " << alpha;
         }
@@ -111,19 +140,29 @@ namespace voxelity {
     void VoxelWorldLayer::setupWorld() {
         auto generator = std::make_unique<NaturalTerrainGenerator>(0);
         m_world = std::make_unique<World>(std::move(generator));
+        m_world->getLodManager().setLevelCount(m_config.lodLevels);
+        if (!m_config.saveDirectory.empty())
+            m_world->enablePersistence(m_config.saveDirectory);
         m_worldRenderer = std::make_unique<WorldRenderer>(*m_world, *m_camera, *m_shader);
     }
 
     void VoxelWorldLayer::setupEntityManager() {
         m_entityManager = std::make_unique<EntityManager>();
+
+        // Blocs soumis à la gravité détachés par le tick du monde
+        m_world->getBlockTicker().setFallingBlockSpawner([this](const glm::ivec3 &pos, const VoxelType type) {
+            m_entityManager->spawnFallingBlock(glm::vec3(pos) + 0.5f, type);
+        });
+
+        // Poser ou casser un bloc réveille les corps endormis qui s'y appuient
+        m_world->setVoxelChangeListener([this](const ash::BBox3i &box) {
+            m_entityManager->getPhysicsWorld().wakeRegion(box);
+        });
     }
 
     void VoxelWorldLayer::setupPlayer() {
-        m_player = m_entityManager->createEntity<Player>(m_camera);
-        m_player->position = {0, 70, 0};
-        m_player->velocity = {0.0f, 0.0f, 0.0f};
-        // Initialiser previousPosition pour éviter un saut au démarrage
-        m_player->previousPosition = m_player->position;
+        m_player = std::make_unique<Player>(*m_entityManager, m_camera);
+        m_player->setPosition({0, 70, 0});
     }
 
     void VoxelWorldLayer::setupWorldInteractor() {
@@ -1,65 +1,76 @@
 #include "Voxelity/systems/PhysicsSystem.h"
 
+#include <algorithm>
 #include <cmath>
 
-#include "Voxelity/voxelWorld/world/World.h"
+#include "Voxelity/entities/EntitySpatialHash.h"
+#include "Voxelity/voxelWorld/world/VoxelAccessor.h"
 
 namespace voxelity {
     PhysicsSystem::PhysicsSystem(const PhysicsConfig &config)
         : m_config(config) {
     }
 
-    void PhysicsSystem::step(Entity &entity, const float deltaTime, const World &world) const {
-        if (!entity.isActive) return;
+    void PhysicsSystem::step(PhysicsBody &body, const float deltaTime, const World &world) const {
+        // Toutes les requêtes du corps restent dans un voisinage de chunks réduit
+        VoxelAccessor voxels(world);
+        step(body, deltaTime, voxels, m_sweepVoxels);
+    }
 
+    void PhysicsSystem::step(PhysicsBody &body, const float deltaTime, VoxelAccessor &voxels,
+                             ash::Vector<VoxelType> &sweepVoxels) const {
         // 1. Gravité et air drag
-        integrate(entity, deltaTime, world);
+        integrate(body, deltaTime);
 
         // 2. Mouvement et collisions
-        const glm::vec3 motion = entity.velocity * deltaTime;
-        const glm::vec3 actualMotion = moveAndCollide(entity, motion, world);
-        entity.position += actualMotion;
+        const glm::vec3 motion = body.velocity * deltaTime;
+        const glm::vec3 actualMotion = moveAndCollide(body, motion, voxels, sweepVoxels);
+        body.position += actualMotion;
 
         // 3. Friction au sol (appliquée APRÈS le mouvement dans Minecraft)
-        applyFriction(entity, deltaTime, world);
+        applyFriction(body, deltaTime, voxels);
     }
 
-    void PhysicsSystem::integrate(Entity &entity, const float deltaTime, const World &world) const {
-        if (!entity.useGravity) return;
+    void PhysicsSystem::integrate(PhysicsBody &body, const float deltaTime) const {
+        if (!body.useGravity) return;
 
         // Dans Minecraft, la gravité s'applique AVANT le drag
-        entity.velocity.y += m_config.gravity * deltaTime;
+        body.velocity.y += m_config.gravity * deltaTime;
 
         // Air drag vertical (0.98 dans Minecraft)
-        entity.velocity.y *= m_config.airDrag;
+        body.velocity.y *= m_config.airDrag;
 
         // Limiter à la terminal velocity
-        if (entity.velocity.y < m_config.terminalVelocity) {
-            entity.velocity.y = m_config.terminalVelocity;
+        if (body.velocity.y < m_config.terminalVelocity) {
+            body.velocity.y = m_config.terminalVelocity;
         }
     }
 
-    glm::vec3 PhysicsSystem::moveAndCollide(Entity &entity, const glm::vec3 &motion,
-                                            const World &world) const {
-        if (!entity.hasCollisions) return motion;
+    glm::vec3 PhysicsSystem::moveAndCollide(PhysicsBody &body, const glm::vec3 &motion, VoxelAccessor &voxels,
+                                            ash::Vector<VoxelType> &sweepVoxels) const {
+        if (!body.hasCollisions) return motion;
 
-        entity.onGround = false;
+        body.onGround = false;
 
-        ash::BBox3 entityBox = entity.getBoundingBox();
+        ash::BBox3 entityBox = body.getBoundingBox();
         glm::vec3 remainingMotion = motion;
         glm::vec3 actualMotion(0.0f);
 
+        StepRegion stepRegion;
+        copyStepRegion(entityBox, motion, voxels, sweepVoxels, stepRegion);
+
         constexpr int axisOrder[3] = {1, 0, 2};
 
         for (const int axis: axisOrder) {
             if (std::abs(remainingMotion[axis]) < m_config.collisionEpsilon) continue;
 
             CollisionResult collisions;
-            const float moved = sweepAxis(entityBox, remainingMotion[axis], axis, world, collisions);
+            const float moved = sweepAxis(entityBox, remainingMotion[axis], axis, voxels, sweepVoxels, stepRegion,
+                                          collisions);
 
             actualMotion[axis] += moved;
 
-            entityBox = entityBox.translated(glm::vec3(
+            entityBox = entityBox.Translated(glm::vec3(
                 axis == 0 ? moved : 0.0f,
                 axis == 1 ? moved : 0.0f,
                 axis == 2 ? moved : 0.0f
@@ -69,19 +80,19 @@ namespace voxelity {
                 remainingMotion[axis] = 0.0f;
 
                 // Appliquer le rebond si le matériau le permet
-                if (m_config.useMaterialProperties && !collisions.collisions.empty()) {
-                    const float bounciness = getVoxelBounciness(collisions.collisions[0].blockType);
+                if (m_config.useMaterialProperties) {
+                    const float bounciness = getVoxelBounciness(collisions.closest.blockType);
                     if (bounciness > 0.01f) {
-                        entity.velocity[axis] = -entity.velocity[axis] * bounciness;
+                        body.velocity[axis] = -body.velocity[axis] * bounciness;
                     } else {
-                        entity.velocity[axis] = 0.0f;
+                        body.velocity[axis] = 0.0f;
                     }
                 } else {
-                    entity.velocity[axis] = 0.0f;
+                    body.velocity[axis] = 0.0f;
                 }
 
                 if (axis == 1 && motion.y < 0.0f) {
-                    entity.onGround = true;
+                    body.onGround = true;
                 }
             } else {
                 remainingMotion[axis] = 0.0f;
@@ -91,9 +102,33 @@ namespace voxelity {
         return actualMotion;
     }
 
-    float PhysicsSystem::sweepAxis(const ash::BBox3 &aabb, const float motion, const int axis,
-                                   const World &world, CollisionResult &result) const {
-        result.clear();
+    void PhysicsSystem::copyStepRegion(const ash::BBox3 &aabb, const glm::vec3 &motion, VoxelAccessor &voxels,
+                                       ash::Vector<VoxelType> &sweepVoxels, StepRegion &stepRegion) const {
+        if (glm::all(glm::lessThan(glm::abs(motion), glm::vec3(m_config.collisionEpsilon)))) return;
+
+        // Chaque axe déplace la boîte d'au plus son mouvement, à collisionEpsilon près, et son balayage
+        // l'étend encore de collisionEpsilon : deux fois la marge. Un axe qui en sort quand même
+        // (recul hors d'un bloc déjà pénétré) copie sa propre plage
+        const float margin = 2.0f * m_config.collisionEpsilon;
+        const glm::vec3 low = glm::min(aabb.min, aabb.min + motion) - margin;
+        const glm::vec3 high = glm::max(aabb.max, aabb.max + motion) + margin;
+        const glm::ivec3 min(glm::floor(low));
+        const glm::ivec3 max(glm::floor(high));
+
+        const glm::ivec3 size = max - min + 1;
+        const size_t volume = static_cast<size_t>(size.x) * static_cast<size_t>(size.y) *
+                              static_cast<size_t>(size.z);
+        if (volume > MAX_STEP_REGION_VOLUME) return;
+
+        sweepVoxels.resize(volume);
+        voxels.copyRegion(min, max, sweepVoxels.data());
+        stepRegion = {min, max, true};
+    }
+
+    float PhysicsSystem::sweepAxis(const ash::BBox3 &aabb, const float motion, const int axis, VoxelAccessor &voxels,
+                                   ash::Vector<VoxelType> &sweepVoxels, StepRegion &stepRegion,
+                                   CollisionResult &result) const {
+        result = {};
 
         if (std::abs(motion) < m_config.collisionEpsilon) return 0.0f;
 
@@ -104,47 +139,95 @@ namespace voxelity {
             sweepBox.min[axis] += motion;
         }
 
-        sweepBox = sweepBox.expanded(m_config.collisionEpsilon);
+        sweepBox = sweepBox.Expanded(m_config.collisionEpsilon);
 
-        ash::Vector<glm::ivec3> blocks;
-        getBroadPhaseBlocks(sweepBox, blocks, world);
+        const glm::ivec3 min(static_cast<int>(std::floor(sweepBox.min.x)),
+                             static_cast<int>(std::floor(sweepBox.min.y)),
+                             static_cast<int>(std::floor(sweepBox.min.z)));
+        // floor et non ceil : un bloc d'indice supérieur commence après sweepBox.max et ne peut pas toucher
+        const glm::ivec3 max(static_cast<int>(std::floor(sweepBox.max.x)),
+                             static_cast<int>(std::floor(sweepBox.max.y)),
+                             static_cast<int>(std::floor(sweepBox.max.z)));
 
         float closestHit = motion;
-        bool hitFound = false;
-
-        for (const auto &blockPos: blocks) {
-            const ash::BBox3 blockBox = ash::BBox3::fromBlock(blockPos);
 
-            float hitDist;
-            if (motion > 0.0f) {
-                hitDist = blockBox.min[axis] - aabb.max[axis];
-            } else {
-                hitDist = blockBox.max[axis] - aabb.min[axis];
+        if (std::abs(motion) < m_config.layerSweepDistance) {
+            // Toute la plage lue d'un bloc : un verrou par chunk au lieu d'un par voxel
+            glm::ivec3 regionMin = stepRegion.min;
+            glm::ivec3 regionMax = stepRegion.max;
+            if (!stepRegion.contains(min, max)) {
+                sweepVoxels.resize(static_cast<size_t>(max.x - min.x + 1) * static_cast<size_t>(max.y - min.y + 1) *
+                                   static_cast<size_t>(max.z - min.z + 1));
+                voxels.copyRegion(min, max, sweepVoxels.data());
+                regionMin = min;
+                regionMax = max;
+                stepRegion.valid = false;
             }
-
-            if (std::abs(hitDist) < std::abs(closestHit)) {
-                ash::BBox3 testBox = aabb.translated(glm::vec3(
-                    axis == 0 ? hitDist : 0.0f,
-                    axis == 1 ? hitDist : 0.0f,
-                    axis == 2 ? hitDist : 0.0f
-                ));
-
-                if (testBox.intersects(blockBox)) {
-                    closestHit = hitDist;
-                    hitFound = true;
-
-                    CollisionInfo info;
-                    info.blockPos = blockPos;
-                    info.axis = axis;
-                    info.distance = std::abs(hitDist);
-                    info.penetration[axis] = hitDist;
-                    info.blockType = world.getVoxel(blockPos);
-                    result.addCollision(info);
+            scanRegion(aabb, motion, axis, min, max, sweepVoxels.data(), regionMin, regionMax, closestHit, result);
+        } else {
+            // Couches déjà occupées par la boîte d'abord (contacts en recouvrement), puis des tranches
+            // de couches de plus en plus épaisses dans le sens du mouvement. La distance de contact croît
+            // avec l'éloignement de la couche : on s'arrête dès qu'elle dépasse le contact trouvé.
+            // Chaque tranche n'est lue qu'une fois atteinte, jusqu'au bord de son chunk : sans contact,
+            // chaque chunk traversé n'est visité qu'une fois, comme par une copie de toute la plage
+            const int direction = motion > 0.0f ? 1 : -1;
+            const int last = motion > 0.0f ? max[axis] : min[axis];
+            const auto chunkEdge = [direction](const int layer) {
+                return direction > 0 ? layer | VoxelArray::MASK : layer & ~VoxelArray::MASK;
+            };
+
+            glm::ivec3 regionMin = stepRegion.min;
+            glm::ivec3 regionMax = stepRegion.max;
+            bool hasRegion = stepRegion.contains(min, max);
+            const auto scanSlice = [&](const glm::ivec3 &sliceMin, const glm::ivec3 &sliceMax) {
+                if (!hasRegion || sliceMin[axis] < regionMin[axis] || sliceMax[axis] > regionMax[axis]) {
+                    regionMin = sliceMin;
+                    regionMax = sliceMax;
+                    if (direction > 0) {
+                        regionMax[axis] = std::min(chunkEdge(sliceMax[axis]), last);
+                    } else {
+                        regionMin[axis] = std::max(chunkEdge(sliceMin[axis]), last);
+                    }
+                    sweepVoxels.resize(static_cast<size_t>(regionMax.x - regionMin.x + 1) *
+                                       static_cast<size_t>(regionMax.y - regionMin.y + 1) *
+                                       static_cast<size_t>(regionMax.z - regionMin.z + 1));
+                    voxels.copyRegion(regionMin, regionMax, sweepVoxels.data());
+                    hasRegion = true;
+                    stepRegion.valid = false;
                 }
+                scanRegion(aabb, motion, axis, sliceMin, sliceMax, sweepVoxels.data(), regionMin, regionMax,
+                           closestHit, result);
+            };
+
+            const int boxMin = static_cast<int>(std::floor(aabb.min[axis] - m_config.collisionEpsilon));
+            const int boxMax = static_cast<int>(std::floor(aabb.max[axis] + m_config.collisionEpsilon));
+
+            glm::ivec3 sliceMin = min;
+            glm::ivec3 sliceMax = max;
+            sliceMin[axis] = boxMin;
+            sliceMax[axis] = boxMax;
+            scanSlice(sliceMin, sliceMax);
+
+            int thickness = FIRST_SLICE_LAYERS;
+            for (int layer = (motion > 0.0f ? boxMax : boxMin) + direction; layer * direction <= last * direction;
+                 thickness *= 2) {
+                const float hitDist = motion > 0.0f
+                                          ? static_cast<float>(layer) - aabb.max[axis]
+                                          : static_cast<float>(layer + 1) - aabb.min[axis];
+                if (std::abs(hitDist) >= std::abs(closestHit)) break;
+
+                // Tranche prolongée jusqu'au bord de son chunk : la suivante commence dans le chunk d'après
+                const int end = direction > 0
+                                    ? std::min(chunkEdge(layer + thickness - 1), last)
+                                    : std::max(chunkEdge(layer - thickness + 1), last);
+                sliceMin[axis] = std::min(layer, end);
+                sliceMax[axis] = std::max(layer, end);
+                scanSlice(sliceMin, sliceMax);
+                layer = end + direction;
             }
         }
 
-        if (!hitFound) {
+        if (!result.hasCollision) {
             return motion;
         }
 
@@ -152,56 +235,81 @@ namespace voxelity {
         return closestHit - sign * m_config.collisionEpsilon;
     }
 
-    void PhysicsSystem::getBroadPhaseBlocks(const ash::BBox3 &aabb, ash::Vector<glm::ivec3> &blocks,
-                                            const World &world) {
-        blocks.clear();
-
-        const int minX = static_cast<int>(std::floor(aabb.min.x));
-        const int maxX = static_cast<int>(std::ceil(aabb.max.x));
-        const int minY = static_cast<int>(std::floor(aabb.min.y));
-        const int maxY = static_cast<int>(std::ceil(aabb.max.y));
-        const int minZ = static_cast<int>(std::floor(aabb.min.z));
-        const int maxZ = static_cast<int>(std::ceil(aabb.max.z));
-
-        for (int x = minX; x <= maxX; ++x) {
-            for (int y = minY; y <= maxY; ++y) {
-                for (int z = minZ; z <= maxZ; ++z) {
-                    const VoxelType voxel = world.getVoxel(x, y, z);
-                    if (doesVoxelHaveCollision(voxel)) {
-                        blocks.emplace_back(x, y, z);
+    void PhysicsSystem::scanRegion(const ash::BBox3 &aabb, const float motion, const int axis, const glm::ivec3 &min,
+                                   const glm::ivec3 &max, const VoxelType *region, const glm::ivec3 &regionMin,
+                                   const glm::ivec3 &regionMax, float &closestHit, CollisionResult &result) {
+        const size_t rowStride = static_cast<size_t>(regionMax.x - regionMin.x + 1);
+        const size_t layerStride = rowStride * static_cast<size_t>(regionMax.z - regionMin.z + 1);
+
+        for (int y = min.y; y <= max.y; ++y) {
+            for (int z = min.z; z <= max.z; ++z) {
+                const VoxelType *row = region + static_cast<size_t>(y - regionMin.y) * layerStride +
+                                       static_cast<size_t>(z - regionMin.z) * rowStride;
+                for (int x = min.x; x <= max.x; ++x) {
+                    const VoxelType blockType = row[x - regionMin.x];
+                    if (blockType == VoxelID::AIR || !doesVoxelHaveCollision(blockType)) continue;
+
+                    const glm::ivec3 blockPos(x, y, z);
+                    const ash::BBox3 blockBox = ash::BBox3::FromBlock(blockPos);
+
+                    float hitDist;
+                    if (motion > 0.0f) {
+                        hitDist = blockBox.min[axis] - aabb.max[axis];
+                    } else {
+                        hitDist = blockBox.max[axis] - aabb.min[axis];
+                    }
+
+                    if (std::abs(hitDist) >= std::abs(closestHit)) continue;
+
+                    const ash::BBox3 testBox = aabb.Translated(glm::vec3(
+                        axis == 0 ? hitDist : 0.0f,
+                        axis == 1 ? hitDist : 0.0f,
+                        axis == 2 ? hitDist : 0.0f
+                    ));
+
+                    if (testBox.Intersects(blockBox)) {
+                        closestHit = hitDist;
+
+                        result.hasCollision = true;
+                        result.closest.blockPos = blockPos;
+                        result.closest.axis = axis;
+                        result.closest.distance = std::abs(hitDist);
+                        result.closest.penetration = glm::vec3(0.0f);
+                        result.closest.penetration[axis] = hitDist;
+                        result.closest.blockType = blockType;
                     }
                 }
             }
         }
     }
 
-    void PhysicsSystem::applyFriction(Entity &entity, const float deltaTime, const World &world) const {
-        if (entity.onGround) {
+    void PhysicsSystem::applyFriction(PhysicsBody &body, const float deltaTime, VoxelAccessor &voxels) const {
+        if (body.onGround) {
             // Friction au sol (Minecraft style)
             float friction = m_config.groundFriction;
 
             if (m_config.useMaterialProperties) {
-                friction = getGroundFriction(entity, world);
+                friction = getGroundFriction(body, voxels);
             }
 
-            entity.velocity.x *= friction;
-            entity.velocity.z *= friction;
+            body.velocity.x *= friction;
+            body.velocity.z *= friction;
 
             // Arrêter les très petites vitesses
-            if (std::abs(entity.velocity.x) < 0.003f) entity.velocity.x = 0.0f;
-            if (std::abs(entity.velocity.z) < 0.003f) entity.velocity.z = 0.0f;
+            if (std::abs(body.velocity.x) < 0.003f) body.velocity.x = 0.0f;
+            if (std::abs(body.velocity.z) < 0.003f) body.velocity.z = 0.0f;
         } else {
             // Friction en l'air (horizontal)
-            entity.velocity.x *= m_config.horizontalAirDrag;
-            entity.velocity.z *= m_config.horizontalAirDrag;
+            body.velocity.x *= m_config.horizontalAirDrag;
+            body.velocity.z *= m_config.horizontalAirDrag;
         }
     }
 
-    float PhysicsSystem::getGroundFriction(const Entity &entity, const World &world) const {
+    float PhysicsSystem::getGroundFriction(const PhysicsBody &body, VoxelAccessor &voxels) const {
         // Vérifier le bloc juste sous les pieds
-        const glm::vec3 feetPos = entity.position - glm::vec3(0, entity.boundingBoxSize.y * 0.5f + 0.1f, 0);
+        const glm::vec3 feetPos = body.position - glm::vec3(0, body.size.y * 0.5f + 0.1f, 0);
         const glm::ivec3 blockPos = glm::floor(feetPos);
-        const VoxelType voxel = world.getVoxel(blockPos);
+        const VoxelType voxel = voxels.get(blockPos);
 
         if (doesVoxelHaveCollision(voxel)) {
             return getVoxelFriction(voxel);
@@ -209,4 +317,16 @@ namespace voxelity {
 
         return m_config.groundFriction;
     }
-}
\ No newline at end of file
+
+    void PhysicsSystem::findEntityPairs(const EntitySpatialHash &entities, ash::Vector<EntityPair> &pairs) {
+        pairs.clear();
+
+        entities.forEach([&](const EntitySpatialHash::Entry &a) {
+            entities.forEachNear(a.bounds, [&](const EntitySpatialHash::Entry &b) {
+                // Chaque paire est vue depuis ses deux entités : seul le plus petit indice la garde
+                if (a.entity.index < b.entity.index && a.bounds.Intersects(b.bounds))
+                    pairs.push_back({a.entity, b.entity});
+            });
+        });
+    }
+}
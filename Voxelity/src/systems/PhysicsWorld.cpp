@@ -0,0 +1,138 @@
+#include "Voxelity/systems/PhysicsWorld.h"
+
+#include <chrono>
+
+#include "Voxelity/voxelWorld/world/VoxelAccessor.h"
+#include "Voxelity/voxelWorld/world/World.h"
+
+namespace voxelity {
+    PhysicsWorld::PhysicsWorld(ash::Registry &registry)
+        : m_registry(registry), m_awake(registry, ash::MaskOf<Sleeping>()), m_sleeping(registry) {
+    }
+
+    uint32_t PhysicsWorld::addConfig(const PhysicsConfig &config) {
+        m_systems.emplace_back(config);
+        return static_cast<uint32_t>(m_systems.size() - 1);
+    }
+
+    void PhysicsWorld::removeBody(const ash::EntityId entity) {
+        m_sleepers.remove(entity);
+    }
+
+    bool PhysicsWorld::isSleeping(const ash::EntityId entity) const {
+        return m_registry.Has<Sleeping>(entity);
+    }
+
+    void PhysicsWorld::wake(const ash::EntityId entity) {
+        if (!m_registry.Has<RigidBody>(entity)) return;
+
+        if (isSleeping(entity)) {
+            m_sleepers.remove(entity);
+            m_registry.Remove<Sleeping>(entity);
+        }
+        m_registry.Get<RigidBody>(entity).restTicks = 0;
+    }
+
+    void PhysicsWorld::wakeRegion(const ash::BBox3i &box) {
+        if (m_sleepers.size() == 0) return;
+
+        queueSleepers(ash::BBox3(glm::vec3(box.min), glm::vec3(box.max + 1)), SUPPORT_MARGIN);
+        flushWakeQueue();
+    }
+
+    ash::BBox3 PhysicsWorld::getBounds(const ash::EntityId entity) const {
+        return m_registry.Get<Collider>(entity).getBounds(m_registry.Get<Transform>(entity).position);
+    }
+
+    void PhysicsWorld::sleep(const ash::EntityId entity) {
+        m_registry.Add<Sleeping>(entity);
+
+        // Figé jusqu'au réveil : plus rien à interpoler
+        m_registry.Get<Transform>(entity).saveState();
+        m_registry.Get<Motion>(entity).velocity = glm::vec3(0.0f);
+
+        m_sleepers.insert(entity, getBounds(entity));
+    }
+
+    void PhysicsWorld::queueSleepers(const ash::BBox3 &box, const float margin) {
+        m_sleepers.forEachNear(box.Expanded(margin), [&](const EntitySpatialHash::Entry &entry) {
+            if (entry.bounds.Expanded(margin).Intersects(box)) m_wakeQueue.push_back(entry.entity);
+        });
+    }
+
+    void PhysicsWorld::flushWakeQueue() {
+        for (const ash::EntityId entity: m_wakeQueue)
+            wake(entity);
+        m_wakeQueue.clear();
+    }
+
+    void PhysicsWorld::step(const float deltaTime, const World &world) {
+        const auto start = std::chrono::steady_clock::now();
+
+        // Un bloc = des corps du même archétype, souvent apparus ensemble : le cache de chunks
+        // de l'accesseur sert à tout le bloc
+        m_awake.ParallelEachChunk([&](const size_t count, const ash::EntityId *, Transform *transforms,
+                                      Motion *motions, const Collider *colliders, RigidBody *bodies) {
+            VoxelAccessor voxels(world);
+            thread_local ash::Vector<VoxelType> sweepVoxels; // Un tampon par thread, conservé d'un pas à l'autre
+
+            for (size_t i = 0; i < count; ++i) {
+                const PhysicsSystem &system = m_systems[bodies[i].config];
+                transforms[i].saveState();
+
+                PhysicsBody body;
+                body.position = transforms[i].position;
+                body.velocity = motions[i].velocity;
+                body.size = colliders[i].size;
+                body.useGravity = colliders[i].useGravity;
+                body.hasCollisions = colliders[i].hasCollisions;
+                body.onGround = motions[i].onGround;
+
+                system.step(body, deltaTime, voxels, sweepVoxels);
+
+                transforms[i].position = body.position;
+                motions[i].velocity = body.velocity;
+                motions[i].onGround = body.onGround;
+
+                const PhysicsConfig &config = system.getConfig();
+                const float sleepSpeedSq = config.sleepVelocity * config.sleepVelocity;
+                const bool resting = config.sleepTicks > 0 && glm::dot(body.velocity, body.velocity) < sleepSpeedSq;
+                bodies[i].restTicks = resting ? bodies[i].restTicks + 1 : 0;
+            }
+        });
+
+        // Un corps en mouvement réveille les endormis qu'il touche ; réveillés après le pas,
+        // ils ne sont avancés qu'au suivant
+        if (m_sleepers.size() > 0) {
+            m_awake.Each([this](ash::EntityId, const Transform &transform, const Motion &motion,
+                                const Collider &collider, const RigidBody &body) {
+                const float sleepVelocity = m_systems[body.config].getConfig().sleepVelocity;
+                if (glm::dot(motion.velocity, motion.velocity) >= sleepVelocity * sleepVelocity)
+                    queueSleepers(collider.getBounds(transform.position), CONTACT_MARGIN);
+            });
+            flushWakeQueue();
+        }
+
+        // Endormissement hors itération : ajouter Sleeping change l'archétype du corps
+        m_awake.Each([this](const ash::EntityId entity, const Transform &, const Motion &, const Collider &,
+                            const RigidBody &body) {
+            const uint32_t sleepTicks = m_systems[body.config].getConfig().sleepTicks;
+            if (sleepTicks > 0 && body.restTicks >= sleepTicks) m_sleepQueue.push_back(entity);
+        });
+        for (const ash::EntityId entity: m_sleepQueue)
+            sleep(entity);
+        m_sleepQueue.clear();
+
+        m_stats.awake = getAwakeCount();
+        m_stats.sleeping = getSleepingCount();
+        m_stats.bodies = m_stats.awake + m_stats.sleeping;
+        m_stats.stepMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void PhysicsWorld::clear() {
+        m_sleepers.clear();
+        m_wakeQueue.clear();
+        m_sleepQueue.clear();
+        m_stats = {};
+    }
+}
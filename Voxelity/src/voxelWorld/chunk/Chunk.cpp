@@ -1,9 +1,12 @@
 #include "Voxelity/voxelWorld/chunk/Chunk.h"
 
+#include <cstring>
+
 #include "Ashen/Core/Logger.h"
 
 namespace voxelity {
-    Chunk::Chunk(const ChunkCoord coord) : m_position(coord) {
+    Chunk::Chunk(const ChunkCoord coord)
+        : m_position(coord), m_storage(std::make_shared<VoxelArray>()) {
     }
 
     bool Chunk::isInBounds(const int x, const int y, const int z) {
@@ -15,7 +18,7 @@ namespace voxelity {
     VoxelType Chunk::get(const int x, const int y, const int z) const {
         if (!isInBounds(x, y, z)) return VoxelID::AIR;
         std::lock_guard lock(m_storageMutex);
-        return m_storage.get(x, y, z);
+        return m_storage->get(x, y, z);
     }
 
     VoxelType Chunk::get(const glm::ivec3 &pos) const {
@@ -25,9 +28,11 @@ namespace voxelity {
     void Chunk::set(const int x, const int y, const int z, const VoxelType voxel) {
         if (!isInBounds(x, y, z)) return; {
             std::lock_guard lock(m_storageMutex);
-            m_storage.set(x, y, z, voxel);
+            detachStorage();
+            m_storage->set(x, y, z, voxel);
+            resetFluidState(x, y, z);
         }
-        markDirty();
+        markModified();
     }
 
     void Chunk::set(const glm::ivec3 &pos, const VoxelType voxel) {
@@ -36,11 +41,158 @@ namespace voxelity {
 
     void Chunk::fill(const VoxelType ID) { {
             std::lock_guard lock(m_storageMutex);
-            m_storage.fill(ID);
+            m_storage = std::make_shared<VoxelArray>();
+            m_storage->fill(ID);
+            m_fluid.reset();
+        }
+        markModified();
+    }
+
+    void Chunk::assign(const VoxelArray &voxels, const FluidArray *fluid) { {
+            std::lock_guard lock(m_storageMutex);
+            m_storage = std::make_shared<VoxelArray>(voxels);
+            m_fluid = fluid ? std::make_shared<FluidArray>(*fluid) : nullptr;
         }
         markDirty();
     }
 
+    ChunkEditResult Chunk::setVoxels(const std::span<const LocalVoxelEdit> edits,
+                                     ash::Vector<LocalVoxelEdit> *applied) {
+        ChunkEditResult result; {
+            std::lock_guard lock(m_storageMutex);
+            for (const LocalVoxelEdit &edit: edits) {
+                const auto [x, y, z, type] = edit;
+                if (!isInBounds(x, y, z) || m_storage->get(x, y, z) == type) continue;
+
+                if (!result.changed()) detachStorage();
+                m_storage->set(x, y, z, type);
+                resetFluidState(x, y, z);
+                result.touch(x, y, z);
+                if (applied) applied->push_back(edit);
+            }
+        }
+
+        if (result.changed()) markModified();
+        return result;
+    }
+
+    ChunkSnapshot Chunk::snapshot() const {
+        std::lock_guard lock(m_storageMutex);
+        return {m_storage, m_fluid};
+    }
+
+    void Chunk::copyRegion(const glm::ivec3 &min, const glm::ivec3 &max,
+                           VoxelType *dst, const size_t rowStride, const size_t layerStride) const {
+        const size_t rowBytes = static_cast<size_t>(max.x - min.x + 1) * sizeof(VoxelType);
+
+        std::lock_guard lock(m_storageMutex);
+        for (int y = min.y; y <= max.y; ++y) {
+            VoxelType *layer = dst + static_cast<size_t>(y - min.y) * layerStride;
+            for (int z = min.z; z <= max.z; ++z) {
+                std::memcpy(layer + static_cast<size_t>(z - min.z) * rowStride,
+                            m_storage->getRow(y, z) + min.x, rowBytes);
+            }
+        }
+    }
+
+    ChunkEditResult Chunk::pasteRegion(const glm::ivec3 &min, const glm::ivec3 &max,
+                                       const VoxelType *src, const size_t rowStride, const size_t layerStride) {
+        const int rowLength = max.x - min.x + 1;
+        const size_t rowBytes = static_cast<size_t>(rowLength) * sizeof(VoxelType);
+
+        ChunkEditResult result; {
+            std::lock_guard lock(m_storageMutex);
+            for (int y = min.y; y <= max.y; ++y) {
+                const VoxelType *layer = src + static_cast<size_t>(y - min.y) * layerStride;
+                for (int z = min.z; z <= max.z; ++z) {
+                    const VoxelType *source = layer + static_cast<size_t>(z - min.z) * rowStride;
+                    if (std::memcmp(m_storage->getRow(y, z) + min.x, source, rowBytes) == 0) continue;
+
+                    if (!result.changed()) {
+                        detachStorage();
+                        detachFluid();
+                    }
+                    VoxelType *row = m_storage->getRow(y, z) + min.x;
+
+                    int changed = 0;
+                    for (int i = 0; i < rowLength; ++i)
+                        changed += row[i] != source[i];
+
+                    std::memcpy(row, source, rowBytes);
+                    if (m_fluid) m_fluid->clearRow(min.x, max.x, y, z);
+                    result.touchRow(min.x, max.x, y, z, changed);
+                }
+            }
+        }
+
+        if (result.changed()) markModified();
+        return result;
+    }
+
+    uint8_t Chunk::getLight(const int x, const int y, const int z) const {
+        if (!isInBounds(x, y, z)) return 0;
+        std::lock_guard lock(m_lightMutex);
+        return m_light.get(x, y, z);
+    }
+
+    uint8_t Chunk::getSkyLight(const int x, const int y, const int z) const {
+        if (!isInBounds(x, y, z)) return 0;
+        std::lock_guard lock(m_lightMutex);
+        return m_light.getSky(x, y, z);
+    }
+
+    uint8_t Chunk::getBlockLight(const int x, const int y, const int z) const {
+        if (!isInBounds(x, y, z)) return 0;
+        std::lock_guard lock(m_lightMutex);
+        return m_light.getBlock(x, y, z);
+    }
+
+    void Chunk::setSkyLight(const int x, const int y, const int z, const uint8_t level) {
+        if (!isInBounds(x, y, z)) return;
+        std::lock_guard lock(m_lightMutex);
+        m_light.setSky(x, y, z, level);
+    }
+
+    void Chunk::setBlockLight(const int x, const int y, const int z, const uint8_t level) {
+        if (!isInBounds(x, y, z)) return;
+        std::lock_guard lock(m_lightMutex);
+        m_light.setBlock(x, y, z, level);
+    }
+
+    uint8_t Chunk::getFluidState(const int x, const int y, const int z) const {
+        if (!isInBounds(x, y, z)) return 0;
+        std::lock_guard lock(m_storageMutex);
+        return m_fluid ? m_fluid->get(x, y, z) : 0;
+    }
+
+    void Chunk::setFluidState(const int x, const int y, const int z, const uint8_t state) {
+        if (!isInBounds(x, y, z)) return;
+        std::lock_guard lock(m_storageMutex);
+        if (!m_fluid) {
+            if (state == 0) return;
+            m_fluid = std::make_shared<FluidArray>();
+        }
+        detachFluid();
+        m_fluid->set(x, y, z, state);
+        m_modified = true;
+    }
+
+    void Chunk::detachStorage() {
+        if (m_storage.use_count() > 1)
+            m_storage = std::make_shared<VoxelArray>(*m_storage);
+    }
+
+    void Chunk::detachFluid() {
+        if (m_fluid && m_fluid.use_count() > 1)
+            m_fluid = std::make_shared<FluidArray>(*m_fluid);
+    }
+
+    void Chunk::resetFluidState(const int x, const int y, const int z) {
+        if (!m_fluid) return;
+        detachFluid();
+        m_fluid->set(x, y, z, 0);
+    }
+
     void Chunk::markDirty() {
         m_dirty = true;
         // Ne pas mettre m_hasMesh à false ici - le mesh sera remplacé lors de l'upload
@@ -50,23 +202,9 @@ namespace voxelity {
         return {m_position.x, m_position.y, m_position.z};
     }
 
-    void Chunk::uploadMesh(const ash::Vector<FaceInstance> &opaqueFaces,
-                           const ash::Vector<FaceInstance> &transparentFaces) {
-        m_opaqueMesh.uploadInstances(opaqueFaces);
-        m_transparentMesh.uploadInstances(transparentFaces);
+    void Chunk::markMeshUploaded(const ChunkVisibility &visibility) {
+        m_visibility = visibility;
         m_dirty = false;
         m_hasMesh = true;
     }
-
-    void Chunk::drawOpaque(const ash::ShaderProgram &shader) const {
-        if (!m_hasMesh) return;
-        shader.SetVec3("u_ChunkPos", glm::vec3(getPosition() * VoxelArray::SIZE));
-        m_opaqueMesh.draw();
-    }
-
-    void Chunk::drawTransparent(const ash::ShaderProgram &shader) const {
-        if (!m_hasMesh) return;
-        shader.SetVec3("u_ChunkPos", glm::vec3(getPosition() * VoxelArray::SIZE));
-        m_transparentMesh.draw();
-    }
 }
\ No newline at end of file
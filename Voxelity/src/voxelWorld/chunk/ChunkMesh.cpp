@@ -1,14 +1,17 @@
 #include "Voxelity/voxelWorld/chunk/ChunkMesh.h"
 
+#include <bit>
+
 #include "Ashen/Core/Logger.h"
 #include "Ashen/Graphics/Rendering/Renderer.h"
 
 namespace voxelity {
-    ChunkMesh::ChunkMesh() {
+    ChunkMesh::ChunkMesh(const size_t capacity) {
         m_vao = std::make_unique<ash::VertexArray>();
         m_instanceBuffer = std::make_shared<ash::VertexBuffer>(ash::BufferConfig::Dynamic());
 
         setupVertexAttributes();
+        if (capacity > 0) reserve(capacity);
     }
 
     void ChunkMesh::setupVertexAttributes() const {
@@ -26,16 +29,20 @@ namespace voxelity {
         m_instanceCount = instances.size();
         if (m_instanceCount == 0) return;
 
-        if (instances.size_bytes() > m_instanceBuffer->Size()) {
-            m_instanceBuffer->SetData(instances);
-        } else {
-            m_instanceBuffer->Update(instances);
-        }
+        if (m_instanceCount > m_capacity)
+            reserve(std::bit_ceil(m_instanceCount));
+        m_instanceBuffer->Update(instances);
+    }
+
+    void ChunkMesh::reserve(const size_t capacity) {
+        m_instanceBuffer->SetEmpty(capacity, sizeof(FaceInstance));
+        m_capacity = capacity;
     }
 
     void ChunkMesh::draw() const {
         if (IsEmpty()) return;
 
-        ash::Renderer::DrawInstanced(*m_vao, m_instanceCount);
+        // Six sommets par face, générés dans le shader
+        ash::Renderer::DrawArraysInstanced(*m_vao, 6, m_instanceCount);
     }
 }
\ No newline at end of file
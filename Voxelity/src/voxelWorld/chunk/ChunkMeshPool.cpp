@@ -0,0 +1,78 @@
+#include "Voxelity/voxelWorld/chunk/ChunkMeshPool.h"
+
+#include <bit>
+
+namespace voxelity {
+    ChunkMeshPool::ChunkMeshPool(const size_t maxIdleBytes)
+        : m_maxIdleBytes(maxIdleBytes) {
+    }
+
+    ChunkMeshPool::~ChunkMeshPool() = default;
+
+    size_t ChunkMeshPool::getBucket(const size_t capacity) {
+        return std::min<size_t>(std::bit_width(capacity) - 1, BUCKET_COUNT - 1);
+    }
+
+    ash::Own<ChunkMesh> ChunkMeshPool::acquire(const std::span<const FaceInstance> faces) {
+        if (faces.empty()) return nullptr;
+
+        const size_t capacity = std::bit_ceil(std::max(faces.size(), MIN_CAPACITY));
+        auto &bucket = m_buckets[getBucket(capacity)];
+
+        ash::Own<ChunkMesh> mesh;
+        if (!bucket.empty()) {
+            mesh = std::move(bucket.back());
+            bucket.pop_back();
+            m_stats.idleBytes -= mesh->getBufferSize();
+            ++m_stats.hits;
+        } else {
+            mesh = std::make_unique<ChunkMesh>(capacity);
+            m_stats.residentBytes += mesh->getBufferSize();
+            ++m_stats.misses;
+        }
+
+        mesh->uploadInstances(faces);
+        return mesh;
+    }
+
+    void ChunkMeshPool::release(ash::Own<ChunkMesh> mesh) {
+        if (!mesh) return;
+
+        m_pending.push_back({std::move(mesh), m_frame});
+        m_stats.pendingMeshes = m_pending.size();
+    }
+
+    void ChunkMeshPool::advanceFrame() {
+        ++m_frame;
+
+        while (!m_pending.empty() && m_pending.front().frame + FRAMES_IN_FLIGHT <= m_frame) {
+            ash::Own<ChunkMesh> mesh = std::move(m_pending.front().mesh);
+            m_pending.pop_front();
+
+            const size_t bytes = mesh->getBufferSize();
+            if (m_stats.idleBytes + bytes > m_maxIdleBytes) {
+                destroy(std::move(mesh));
+                continue;
+            }
+
+            m_stats.idleBytes += bytes;
+            m_buckets[getBucket(mesh->getCapacity())].push_back(std::move(mesh));
+        }
+
+        m_stats.pendingMeshes = m_pending.size();
+    }
+
+    void ChunkMeshPool::trim() {
+        for (auto &bucket: m_buckets) {
+            for (auto &mesh: bucket)
+                destroy(std::move(mesh));
+            bucket.clear();
+        }
+        m_stats.idleBytes = 0;
+    }
+
+    void ChunkMeshPool::destroy(ash::Own<ChunkMesh> mesh) {
+        m_stats.residentBytes -= mesh->getBufferSize();
+        mesh.reset();
+    }
+}
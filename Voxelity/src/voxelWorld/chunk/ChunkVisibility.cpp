@@ -0,0 +1,97 @@
+#include "Voxelity/voxelWorld/chunk/ChunkVisibility.h"
+
+#include <array>
+#include <bitset>
+
+#include "Ashen/Core/Types.h"
+
+namespace voxelity {
+    namespace {
+        constexpr int LAST = VoxelArray::SIZE - 1;
+        constexpr int STRIDE_Z = VoxelArray::SIZE;
+        constexpr int STRIDE_Y = VoxelArray::SIZE * VoxelArray::SIZE;
+
+        // Faces du chunk touchées par le voxel, bits CubicDirection
+        uint8_t getBorderFaces(const int x, const int y, const int z) {
+            uint8_t faces = 0;
+            if (z == LAST) faces |= 1 << 0; // ZP
+            if (z == 0) faces |= 1 << 1; // ZN
+            if (x == LAST) faces |= 1 << 2; // XP
+            if (x == 0) faces |= 1 << 3; // XN
+            if (y == LAST) faces |= 1 << 4; // YP
+            if (y == 0) faces |= 1 << 5; // YN
+            return faces;
+        }
+    }
+
+    void ChunkVisibility::setConnected(const int from, const int to) {
+        m_connections |= uint64_t{1} << (from * FACE_COUNT + to);
+        m_connections |= uint64_t{1} << (to * FACE_COUNT + from);
+    }
+
+    void ChunkVisibility::connectAll(const uint8_t faceMask) {
+        for (int from = 0; from < FACE_COUNT; ++from) {
+            if (!(faceMask >> from & 1)) continue;
+            for (int to = 0; to < FACE_COUNT; ++to) {
+                if (faceMask >> to & 1) setConnected(from, to);
+            }
+        }
+    }
+
+    ChunkVisibility ChunkVisibility::compute(const VoxelArray &voxels) {
+        std::array<bool, MAX_TYPE_ID + 1> open{};
+        for (int type = 0; type <= MAX_TYPE_ID; ++type)
+            open[type] = getRenderMode(static_cast<VoxelType>(type)) != RenderMode::OPAQUE;
+
+        const VoxelType *data = voxels.data();
+        ChunkVisibility result = none();
+
+        // Même disposition que VoxelArray : index = x + SIZE * (z + SIZE * y)
+        std::bitset<VoxelArray::VOLUME> visited;
+        ash::Vector<uint16_t> stack;
+
+        for (int y = 0; y < VoxelArray::SIZE; ++y) {
+            for (int z = 0; z < VoxelArray::SIZE; ++z) {
+                for (int x = 0; x < VoxelArray::SIZE; ++x) {
+                    // Une composante qui ne touche aucun bord ne relie rien : départs sur les bords seulement
+                    if (getBorderFaces(x, y, z) == 0) continue;
+
+                    const int start = x + STRIDE_Z * z + STRIDE_Y * y;
+                    if (visited[start] || !open[data[start]]) continue;
+
+                    uint8_t faces = 0;
+                    visited[start] = true;
+                    stack.push_back(static_cast<uint16_t>(start));
+
+                    while (!stack.empty()) {
+                        const int index = stack.back();
+                        stack.pop_back();
+
+                        const int vx = index & VoxelArray::MASK;
+                        const int vz = index >> VoxelArray::SHIFT & VoxelArray::MASK;
+                        const int vy = index >> 2 * VoxelArray::SHIFT;
+                        faces |= getBorderFaces(vx, vy, vz);
+
+                        const auto visit = [&](const int neighbor) {
+                            if (visited[neighbor] || !open[data[neighbor]]) return;
+                            visited[neighbor] = true;
+                            stack.push_back(static_cast<uint16_t>(neighbor));
+                        };
+
+                        if (vx > 0) visit(index - 1);
+                        if (vx < LAST) visit(index + 1);
+                        if (vz > 0) visit(index - STRIDE_Z);
+                        if (vz < LAST) visit(index + STRIDE_Z);
+                        if (vy > 0) visit(index - STRIDE_Y);
+                        if (vy < LAST) visit(index + STRIDE_Y);
+                    }
+
+                    result.connectAll(faces);
+                    if (result.m_connections == ALL_CONNECTED) return result;
+                }
+            }
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,61 @@
+#include "Voxelity/voxelWorld/generation/ColumnCache.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "Voxelity/voxelWorld/generation/ITerrainGenerator.h"
+
+namespace voxelity {
+    ColumnCache::ColumnCache(ITerrainGenerator &generator)
+        : m_generator(generator) {
+    }
+
+    ash::Ref<const ColumnData> ColumnCache::getOrBuild(const ColumnCoord &coord) { {
+            std::lock_guard lock(m_mutex);
+            const auto it = m_columns.find(coord);
+            if (it != m_columns.end())
+                return it->second;
+        }
+
+        // Calcul hors verrou : deux threads peuvent construire la même colonne,
+        // le premier inséré l'emporte
+        auto column = std::make_shared<ColumnData>();
+        column->coord = coord;
+        m_generator.buildColumn(*column);
+
+        std::lock_guard lock(m_mutex);
+        const auto [it, inserted] = m_columns.emplace(coord, std::move(column));
+        return it->second;
+    }
+
+    void ColumnCache::prune(const size_t maxEntries) {
+        std::lock_guard lock(m_mutex);
+        if (m_columns.size() <= maxEntries) return;
+
+        // Candidates triées de la plus lointaine à la plus proche : seules les excédentaires partent
+        ash::Vector<std::pair<int64_t, ColumnCoord> > candidates;
+        for (const auto &[coord, column]: m_columns) {
+            if (column.use_count() != 1) continue;
+            const int64_t dx = coord.x - center.x;
+            const int64_t dz = coord.z - center.z;
+            candidates.emplace_back(dx * dx + dz * dz, coord);
+        }
+
+        const size_t excess = std::min(m_columns.size() - maxEntries, candidates.size());
+        std::ranges::nth_element(candidates, candidates.begin() + excess, std::ranges::greater{},
+                                 &std::pair<int64_t, ColumnCoord>::first);
+
+        for (size_t i = 0; i < excess; ++i)
+            m_columns.erase(candidates[i].second);
+    }
+
+    void ColumnCache::clear() {
+        std::lock_guard lock(m_mutex);
+        m_columns.clear();
+    }
+
+    size_t ColumnCache::size() {
+        std::lock_guard lock(m_mutex);
+        return m_columns.size();
+    }
+}
@@ -1,31 +1,38 @@
 #include "Voxelity/voxelWorld/generation/FlatTerrainGenerator.h"
 
-#include <format>
-
-#include "Ashen/Core/Logger.h"
-
 namespace voxelity {
-    VoxelType FlatTerrainGenerator::generateVoxel(const glm::ivec3 &worldPos) {
-        if (worldPos.y < HEIGHT - 1) return VoxelID::DIRT;
-        if (worldPos.y == HEIGHT - 1) return VoxelID::GRASS;
-        return VoxelID::AIR;
+    void FlatTerrainGenerator::buildColumn(ColumnData &column) {
+        column.heightMap.fill(HEIGHT);
+        column.biomeMap.fill(0);
     }
 
-    void FlatTerrainGenerator::generateChunk(Chunk &voxelChunk) {
-        const glm::ivec3 chunkPos = voxelChunk.getPosition();
-        ash::Logger::Info() << std::format("chunkPos: {}, {}, {}", chunkPos.x, chunkPos.y, chunkPos.z);
+    bool FlatTerrainGenerator::isChunkEmpty(const ChunkCoord &coord, const ColumnData &) const {
+        return coord.y * VoxelArray::SIZE >= HEIGHT;
+    }
+
+    void FlatTerrainGenerator::generateDensity(GenerationContext &context) {
+        const glm::ivec3 origin = context.getWorldOrigin();
 
         for (int y = 0; y < VoxelArray::SIZE; ++y) {
-            const int worldY = chunkPos.y * VoxelArray::SIZE + y;
+            const int worldY = origin.y + y;
             for (int x = 0; x < VoxelArray::SIZE; ++x) {
-                const int worldX = chunkPos.x * VoxelArray::SIZE + x;
                 for (int z = 0; z < VoxelArray::SIZE; ++z) {
-                    const int worldZ = chunkPos.z * VoxelArray::SIZE + z;
-                    glm::ivec3 worldPos(worldX, worldY, worldZ);
-                    const VoxelType voxelID = generateVoxel(worldPos);
-                    voxelChunk.set({x, y, z}, voxelID);
+                    const int groundHeight = context.column.getHeight(x, z);
+                    context.voxels.set(x, y, z, worldY < groundHeight ? VoxelID::DIRT : VoxelID::AIR);
                 }
             }
         }
     }
-}
\ No newline at end of file
+
+    void FlatTerrainGenerator::applySurface(GenerationContext &context) {
+        const glm::ivec3 origin = context.getWorldOrigin();
+
+        for (int x = 0; x < VoxelArray::SIZE; ++x) {
+            for (int z = 0; z < VoxelArray::SIZE; ++z) {
+                const int surfaceLocalY = context.column.getHeight(x, z) - 1 - origin.y;
+                if (surfaceLocalY >= 0 && surfaceLocalY < VoxelArray::SIZE)
+                    context.voxels.set(x, surfaceLocalY, z, VoxelID::GRASS);
+            }
+        }
+    }
+}
@@ -0,0 +1,46 @@
+#include "Voxelity/voxelWorld/generation/ITerrainGenerator.h"
+
+namespace voxelity {
+    void ITerrainGenerator::runStage(const GenerationStage stage, GenerationContext &context) {
+        switch (stage) {
+            case GenerationStage::DENSITY: generateDensity(context);
+                break;
+            case GenerationStage::SURFACE: applySurface(context);
+                break;
+            case GenerationStage::CARVERS: applyCarvers(context);
+                break;
+            case GenerationStage::ORES: applyOres(context);
+                break;
+            case GenerationStage::FEATURES: placeFeatures(context);
+                break;
+            default: break;
+        }
+    }
+
+    void ITerrainGenerator::generateChunk(Chunk &voxelChunk) {
+        const glm::ivec3 chunkPos = voxelChunk.getPosition();
+
+        std::array<ColumnData, 9> columns;
+        for (int dz = -1; dz <= 1; ++dz) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                ColumnData &column = columns[(dx + 1) + (dz + 1) * 3];
+                column.coord = {chunkPos.x + dx, chunkPos.z + dz};
+                buildColumn(column);
+            }
+        }
+
+        VoxelArray voxels;
+        GenerationContext context{voxelChunk.getPosition(), voxels, columns[4]};
+        for (int i = 0; i < 9; ++i)
+            context.neighborColumns[i] = &columns[i];
+        for (int stage = 0; stage < GENERATION_STAGE_COUNT; ++stage)
+            runStage(static_cast<GenerationStage>(stage), context);
+
+        voxelChunk.assign(voxels);
+    }
+
+    void ITerrainGenerator::generateLodChunk(GenerationContext &context) {
+        runStage(GenerationStage::DENSITY, context);
+        runStage(GenerationStage::SURFACE, context);
+    }
+}
@@ -1,55 +1,81 @@
 #include "Voxelity/voxelWorld/generation/NaturalTerrainGenerator.h"
 
-#include <format>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
 
 namespace voxelity {
     // Optimisé : échelles ajustées pour moins de calculs
-    constexpr double CONTINENT_SCALE = 0.0008;
-    constexpr double ELEVATION_SCALE = 0.015;
-    constexpr double DETAIL_SCALE = 0.05;
     constexpr double CAVE_SCALE = 0.03;
     constexpr double ORE_SCALE = 0.1;
-    constexpr double TEMPERATURE_SCALE = 0.004;
-    constexpr double HUMIDITY_SCALE = 0.003;
-
-    constexpr int HEIGHT = 24;
-    constexpr int SEA_LEVEL = HEIGHT;
-    constexpr int BEACH_HEIGHT = SEA_LEVEL + 3;
-    constexpr int MOUNTAIN_HEIGHT = HEIGHT + 60;
 
     // Configuration des biomes
     const BiomeData biomeConfigs[] = {
-        {VoxelID::SAND, VoxelID::SAND, VoxelID::STONE, true, false, false, 0.0}, // BiomeType::OCEAN
-        {VoxelID::SAND, VoxelID::SAND, VoxelID::STONE, false, false, false, 0.0}, // BiomeType::BEACH
-        {VoxelID::GRASS, VoxelID::DIRT, VoxelID::STONE, false, true, true, 0.02}, // BiomeType::PLAINS
-        {VoxelID::GRASS, VoxelID::DIRT, VoxelID::STONE, false, true, true, 0.08}, // BiomeType::FOREST
-        {VoxelID::SAND, VoxelID::SAND, VoxelID::STONE, false, false, true, 0.001}, // BiomeType::DESERT
-        {VoxelID::STONE, VoxelID::STONE, VoxelID::STONE, false, false, true, 0.01}, // BiomeType::MOUNTAINS
-        {VoxelID::DIRT, VoxelID::DIRT, VoxelID::STONE, true, true, false, 0.03}, // BiomeType::SWAMP
-        {VoxelID::DIRT, VoxelID::DIRT, VoxelID::STONE, false, false, true, 0.005} // BiomeType::TUNDRA
+        {VoxelID::SAND, VoxelID::SAND, VoxelID::STONE, true, false, false, 0.0f}, // BiomeType::OCEAN
+        {VoxelID::SAND, VoxelID::SAND, VoxelID::STONE, false, false, false, 0.0f}, // BiomeType::BEACH
+        {VoxelID::GRASS, VoxelID::DIRT, VoxelID::STONE, false, true, true, 0.02f}, // BiomeType::PLAINS
+        {VoxelID::GRASS, VoxelID::DIRT, VoxelID::STONE, false, true, true, 0.08f}, // BiomeType::FOREST
+        {VoxelID::SAND, VoxelID::SAND, VoxelID::STONE, false, false, true, 0.001f}, // BiomeType::DESERT
+        {VoxelID::STONE, VoxelID::STONE, VoxelID::STONE, false, false, true, 0.01f}, // BiomeType::MOUNTAINS
+        {VoxelID::DIRT, VoxelID::DIRT, VoxelID::STONE, true, true, false, 0.03f}, // BiomeType::SWAMP
+        {VoxelID::DIRT, VoxelID::DIRT, VoxelID::STONE, false, false, true, 0.005f} // BiomeType::TUNDRA
     };
 
-    BiomeType NaturalTerrainGenerator::getBiome(const glm::ivec3 &worldPos, const double elevation) {
-        double temperature = noise.noise2(worldPos.x * TEMPERATURE_SCALE, worldPos.z * TEMPERATURE_SCALE);
-        double humidity = noise.noise2(worldPos.x * HUMIDITY_SCALE + 1000, worldPos.z * HUMIDITY_SCALE + 1000);
+    void NaturalTerrainGenerator::buildBiomeTable() {
+        constexpr float cellSize = 1.0f / BIOME_TABLE_SIZE;
+
+        for (int h = 0; h < BIOME_TABLE_SIZE; ++h) {
+            for (int t = 0; t < BIOME_TABLE_SIZE; ++t) {
+                const float temperature = (static_cast<float>(t) + 0.5f) * cellSize;
+                const float humidity = (static_cast<float>(h) + 0.5f) * cellSize;
+                const BiomeType biome = classifyClimate(temperature, humidity);
+
+#ifndef NDEBUG
+                // Une frontière qui traverserait une case serait déplacée par la table
+                const float lowT = t * cellSize + 1e-4f, highT = (t + 1) * cellSize - 1e-4f;
+                const float lowH = h * cellSize + 1e-4f, highH = (h + 1) * cellSize - 1e-4f;
+                if (classifyClimate(lowT, lowH) != biome || classifyClimate(highT, highH) != biome ||
+                    classifyClimate(lowT, highH) != biome || classifyClimate(highT, lowH) != biome)
+                    throw std::logic_error("biome threshold not aligned with the biome table");
+#endif
+
+                m_biomeTable[t + h * BIOME_TABLE_SIZE] = biome;
+            }
+        }
+    }
 
-        // Normaliser les valeurs entre 0 et 1
-        temperature = (temperature + 1.0) * 0.5;
-        humidity = (humidity + 1.0) * 0.5;
+    BiomeType NaturalTerrainGenerator::classifyClimate(const float temperature, const float humidity) {
+        if (temperature < 0.3f) return BiomeType::TUNDRA;
+        if (temperature > 0.7f && humidity < 0.3f) return BiomeType::DESERT;
+        if (humidity > 0.6f && temperature > 0.4f) return BiomeType::SWAMP;
+        if (humidity > 0.5f && temperature > 0.3f) return BiomeType::FOREST;
 
-        // Ajuster la température selon l'altitude
-        const double altitudeTemp = std::max(0.0, temperature - (elevation - SEA_LEVEL) * 0.01);
+        return BiomeType::PLAINS;
+    }
 
+    ClimateSample NaturalTerrainGenerator::sampleClimate(const int worldX, const int worldZ) {
+        const double temperature = noise.noise2(worldX * TEMPERATURE_SCALE, worldZ * TEMPERATURE_SCALE);
+        const double humidity = noise.noise2(worldX * HUMIDITY_SCALE + 1000, worldZ * HUMIDITY_SCALE + 1000);
+
+        // Normaliser les valeurs entre 0 et 1
+        return {
+            static_cast<float>(temperature + 1.0) * 0.5f,
+            static_cast<float>(humidity + 1.0) * 0.5f
+        };
+    }
+
+    BiomeType NaturalTerrainGenerator::getBiome(const ClimateSample &climate, const int elevation) const {
         if (elevation < SEA_LEVEL - 5) return BiomeType::OCEAN;
         if (elevation < BEACH_HEIGHT && elevation > SEA_LEVEL - 5) return BiomeType::BEACH;
         if (elevation > MOUNTAIN_HEIGHT - 20) return BiomeType::MOUNTAINS;
 
-        if (altitudeTemp < 0.3) return BiomeType::TUNDRA;
-        if (altitudeTemp > 0.7 && humidity < 0.3) return BiomeType::DESERT;
-        if (humidity > 0.6 && altitudeTemp > 0.4) return BiomeType::SWAMP;
-        if (humidity > 0.5 && altitudeTemp > 0.3) return BiomeType::FOREST;
+        // Ajuster la température selon l'altitude
+        const float altitudeTemp = std::max(
+            0.0f, climate.temperature - static_cast<float>(elevation - SEA_LEVEL) * BIOME_ALTITUDE_COOLING);
 
-        return BiomeType::PLAINS;
+        const int t = std::clamp(static_cast<int>(altitudeTemp * BIOME_TABLE_SIZE), 0, BIOME_TABLE_SIZE - 1);
+        const int h = std::clamp(static_cast<int>(climate.humidity * BIOME_TABLE_SIZE), 0, BIOME_TABLE_SIZE - 1);
+        return m_biomeTable[t + h * BIOME_TABLE_SIZE];
     }
 
     double NaturalTerrainGenerator::getCaveNoise(const glm::ivec3 &worldPos) {
@@ -76,193 +102,233 @@ namespace voxelity {
     bool NaturalTerrainGenerator::shouldGenerateTree(const glm::ivec3 &worldPos, const BiomeData &biome) {
         if (!biome.hasTrees) return false;
 
-        const double treeNoise = noise.noise2(worldPos.x * 0.1, worldPos.z * 0.1);
-        return (treeNoise + 1.0) * 0.5 < biome.treeChance;
+        const auto treeNoise = static_cast<float>(noise.noise2(worldPos.x * 0.1, worldPos.z * 0.1));
+        return (treeNoise + 1.0f) * 0.5f < biome.treeChance;
     }
 
-    void NaturalTerrainGenerator::generateTree(Chunk &voxelChunk, const glm::ivec3 &localPos,
-                                               const glm::ivec3 &chunkPos) {
-        // Générer un arbre simple (tronc + feuilles)
-        const int treeHeight = 4 + rand() % 3; // Hauteur entre 4 et 6
-        const glm::ivec3 worldPos = chunkPos * VoxelArray::SIZE + localPos;
-
-        // Tronc
-        for (int i = 0; i < treeHeight && localPos.y + i < VoxelArray::SIZE; i++) {
-            glm::ivec3 trunkPos = localPos + glm::ivec3(0, i, 0);
-            if (trunkPos.y >= 0 && trunkPos.y < VoxelArray::SIZE) {
-                voxelChunk.set(trunkPos, VoxelID::WOOD);
-            }
+    void NaturalTerrainGenerator::generateTree(VoxelArray &voxels, const glm::ivec3 &localPos, const int height) {
+        // Pied hors du chunk possible : seules les cellules qui y tombent sont écrites
+        const auto inside = [](const glm::ivec3 &pos) {
+            return pos.x >= 0 && pos.x < VoxelArray::SIZE &&
+                   pos.y >= 0 && pos.y < VoxelArray::SIZE &&
+                   pos.z >= 0 && pos.z < VoxelArray::SIZE;
+        };
+
+        // Tronc : remplace les feuilles d'un arbre voisin, quel que soit l'ordre de pose
+        for (int i = 0; i < height; i++) {
+            const glm::ivec3 trunkPos = localPos + glm::ivec3(0, i, 0);
+            if (!inside(trunkPos)) continue;
+
+            const VoxelType current = voxels.get(trunkPos.x, trunkPos.y, trunkPos.z);
+            if (current == VoxelID::AIR || current == VoxelID::LEAVES)
+                voxels.set(trunkPos.x, trunkPos.y, trunkPos.z, VoxelID::WOOD);
         }
 
         // Feuilles (couronne simple)
-        for (int dx = -2; dx <= 2; dx++) {
-            for (int dz = -2; dz <= 2; dz++) {
+        for (int dx = -TREE_RADIUS; dx <= TREE_RADIUS; dx++) {
+            for (int dz = -TREE_RADIUS; dz <= TREE_RADIUS; dz++) {
                 for (int dy = 0; dy < 3; dy++) {
-                    if (abs(dx) + abs(dz) + dy < 4) {
-                        // Forme de couronne
-                        glm::ivec3 leafPos = localPos + glm::ivec3(dx, treeHeight + dy - 1, dz);
-                        if (leafPos.x >= 0 && leafPos.x < VoxelArray::SIZE &&
-                            leafPos.y >= 0 && leafPos.y < VoxelArray::SIZE &&
-                            leafPos.z >= 0 && leafPos.z < VoxelArray::SIZE) {
-                            if (voxelChunk.get(leafPos) == VoxelID::AIR) {
-                                voxelChunk.set(leafPos, VoxelID::LEAVES);
-                            }
-                        }
-                    }
+                    if (abs(dx) + abs(dz) + dy >= 4) continue; // Forme de couronne
+
+                    const glm::ivec3 leafPos = localPos + glm::ivec3(dx, height + dy - 1, dz);
+                    if (inside(leafPos) && voxels.get(leafPos.x, leafPos.y, leafPos.z) == VoxelID::AIR)
+                        voxels.set(leafPos.x, leafPos.y, leafPos.z, VoxelID::LEAVES);
                 }
             }
         }
     }
 
-    VoxelType NaturalTerrainGenerator::generateVoxel(const glm::ivec3 &worldPos) {
-        // Bruit continental pour les grandes formes
-        const double continentNoise = noise.noise2(worldPos.x * CONTINENT_SCALE, worldPos.z * CONTINENT_SCALE);
-
-        // Bruit d'élévation principal
-        const double elevationNoise = noise.noise2(worldPos.x * ELEVATION_SCALE, worldPos.z * ELEVATION_SCALE);
-
-        // Bruit de détail pour les variations fines
-        const double detailNoise = noise.noise2(worldPos.x * DETAIL_SCALE, worldPos.z * DETAIL_SCALE);
-
-        // Combiner les bruits pour l'élévation finale
-        const double combinedElevation = continentNoise * 30.0 + elevationNoise * 20.0 + detailNoise * 8.0;
-        const int groundHeight = static_cast<int>(SEA_LEVEL + combinedElevation);
+    void NaturalTerrainGenerator::buildColumn(ColumnData &column) {
+        constexpr int gridSize = VoxelArray::SIZE / CLIMATE_GRID_STEP + 1;
+        constexpr float invStep = 1.0f / CLIMATE_GRID_STEP;
 
-        // Déterminer le biome
-        BiomeType biome = getBiome(worldPos, groundHeight);
-        const BiomeData &biomeData = biomeConfigs[static_cast<int>(biome)];
+        const int originX = column.coord.x * VoxelArray::SIZE;
+        const int originZ = column.coord.z * VoxelArray::SIZE;
 
-        // Gestion des cavernes
-        if (worldPos.y < groundHeight - 5 && worldPos.y > 10) {
-            const double caveValue = getCaveNoise(worldPos);
-            if (caveValue < 0.1) {
-                // Seuil pour créer des cavernes
-                return VoxelID::AIR;
+        // Le climat varie lentement : l'échantillonner sur une grille grossière puis interpoler
+        ClimateSample climateGrid[gridSize][gridSize];
+        for (int gx = 0; gx < gridSize; ++gx) {
+            for (int gz = 0; gz < gridSize; ++gz) {
+                climateGrid[gx][gz] = sampleClimate(originX + gx * CLIMATE_GRID_STEP,
+                                                    originZ + gz * CLIMATE_GRID_STEP);
             }
         }
 
-        // Gestion de l'eau
-        if (worldPos.y < SEA_LEVEL && worldPos.y >= groundHeight)
-            return VoxelID::WATER;
-
-        // Génération des couches de terrain
-        if (worldPos.y < groundHeight - 10) {
-            // Couche profonde avec minerais
-            const double depthFromSurface = groundHeight - worldPos.y;
-            if (biomeData.hasOres && depthFromSurface > 5) {
-                const VoxelType oreType = getOreType(worldPos, depthFromSurface);
-                if (oreType != VoxelID::STONE) return oreType;
+        // Calculer l'élévation et le biome une seule fois par colonne
+        for (int x = 0; x < VoxelArray::SIZE; ++x) {
+            const int worldX = originX + x;
+            const int gx = x / CLIMATE_GRID_STEP;
+            const float fx = static_cast<float>(x % CLIMATE_GRID_STEP) * invStep;
+
+            for (int z = 0; z < VoxelArray::SIZE; ++z) {
+                const int worldZ = originZ + z;
+                const int gz = z / CLIMATE_GRID_STEP;
+                const float fz = static_cast<float>(z % CLIMATE_GRID_STEP) * invStep;
+
+                const auto continentNoise = static_cast<float>(
+                    noise.noise2(worldX * CONTINENT_SCALE, worldZ * CONTINENT_SCALE));
+                const auto elevationNoise = static_cast<float>(
+                    noise.noise2(worldX * ELEVATION_SCALE, worldZ * ELEVATION_SCALE));
+                const auto detailNoise = static_cast<float>(
+                    noise.noise2(worldX * DETAIL_SCALE, worldZ * DETAIL_SCALE));
+
+                const float combinedElevation = continentNoise * 30.0f + elevationNoise * 20.0f + detailNoise * 8.0f;
+                const int groundHeight = static_cast<int>(static_cast<float>(SEA_LEVEL) + combinedElevation);
+
+                // Interpolation bilinéaire du climat
+                const ClimateSample &c00 = climateGrid[gx][gz];
+                const ClimateSample &c10 = climateGrid[gx + 1][gz];
+                const ClimateSample &c01 = climateGrid[gx][gz + 1];
+                const ClimateSample &c11 = climateGrid[gx + 1][gz + 1];
+                const ClimateSample climate{
+                    std::lerp(std::lerp(c00.temperature, c10.temperature, fx),
+                              std::lerp(c01.temperature, c11.temperature, fx), fz),
+                    std::lerp(std::lerp(c00.humidity, c10.humidity, fx),
+                              std::lerp(c01.humidity, c11.humidity, fx), fz)
+                };
+
+                const int index = ColumnData::index(x, z);
+                column.heightMap[index] = groundHeight;
+                column.biomeMap[index] = static_cast<uint8_t>(getBiome(climate, groundHeight));
             }
-            return biomeData.deepBlock;
         }
-        if (worldPos.y < groundHeight - 2)
-            return biomeData.subSurfaceBlock;
+    }
 
-        if (worldPos.y < groundHeight)
-            return biomeData.surfaceBlock;
+    StageDependency NaturalTerrainGenerator::getStageDependency(const GenerationStage stage) const {
+        // Les couronnes (TREE_RADIUS < VoxelArray::SIZE) ne débordent que sur les chunks adjacents,
+        // et ne lisent que la hauteur et le biome de leur colonne d'origine
+        if (stage == GenerationStage::FEATURES) return {1, GenerationStage::DENSITY};
+        return {};
+    }
 
-        return VoxelID::AIR;
+    bool NaturalTerrainGenerator::isChunkEmpty(const ChunkCoord &coord, const ColumnData &column) const {
+        // Ni sol ni eau au-dessus du point le plus haut de la colonne et du niveau de la mer
+        const int maxHeight = *std::ranges::max_element(column.heightMap);
+        return coord.y * VoxelArray::SIZE >= std::max(maxHeight, SEA_LEVEL);
     }
 
-    void NaturalTerrainGenerator::generateChunk(Chunk &voxelChunk) {
-        const glm::ivec3 chunkPos = voxelChunk.getPosition();
+    void NaturalTerrainGenerator::generateDensity(GenerationContext &context) {
+        const glm::ivec3 origin = context.getWorldOrigin();
 
-        // Optimisation : pré-calculer les hauteurs pour chaque colonne (X,Z)
-        int heightMap[VoxelArray::SIZE][VoxelArray::SIZE];
-        BiomeType biomeMap[VoxelArray::SIZE][VoxelArray::SIZE];
+        // Forme de base : bloc profond sous le sol, eau jusqu'au niveau de la mer
+        for (int y = 0; y < VoxelArray::SIZE; ++y) {
+            const int worldY = origin.y + y;
+            for (int x = 0; x < VoxelArray::SIZE; ++x) {
+                for (int z = 0; z < VoxelArray::SIZE; ++z) {
+                    const int groundHeight = context.column.getHeight(x, z);
 
-        for (int x = 0; x < VoxelArray::SIZE; ++x) {
-            const int worldX = chunkPos.x * VoxelArray::SIZE + x;
-            for (int z = 0; z < VoxelArray::SIZE; ++z) {
-                const int worldZ = chunkPos.z * VoxelArray::SIZE + z;
+                    VoxelType voxelID = VoxelID::AIR;
+                    if (worldY < groundHeight) {
+                        voxelID = biomeConfigs[context.column.getBiome(x, z)].deepBlock;
+                    } else if (worldY < SEA_LEVEL) {
+                        voxelID = VoxelID::WATER;
+                    }
 
-                // Calculer l'élévation une seule fois par colonne
-                const double continentNoise = noise.noise2(worldX * CONTINENT_SCALE, worldZ * CONTINENT_SCALE);
-                const double elevationNoise = noise.noise2(worldX * ELEVATION_SCALE, worldZ * ELEVATION_SCALE);
-                const double detailNoise = noise.noise2(worldX * DETAIL_SCALE, worldZ * DETAIL_SCALE);
+                    context.voxels.set(x, y, z, voxelID);
+                }
+            }
+        }
+    }
 
-                const double combinedElevation = continentNoise * 30.0 + elevationNoise * 20.0 + detailNoise * 8.0;
-                const int groundHeight = static_cast<int>(SEA_LEVEL + combinedElevation);
+    void NaturalTerrainGenerator::applySurface(GenerationContext &context) {
+        const glm::ivec3 origin = context.getWorldOrigin();
 
-                heightMap[x][z] = groundHeight;
-                biomeMap[x][z] = getBiome(glm::ivec3(worldX, groundHeight, worldZ), groundHeight);
+        for (int x = 0; x < VoxelArray::SIZE; ++x) {
+            for (int z = 0; z < VoxelArray::SIZE; ++z) {
+                const int groundHeight = context.column.getHeight(x, z);
+                const BiomeData &biomeData = biomeConfigs[context.column.getBiome(x, z)];
+
+                // Seules les 10 couches sous la surface sont concernées
+                const int minY = std::max(groundHeight - 10 - origin.y, 0);
+                const int maxY = std::min(groundHeight - origin.y, VoxelArray::SIZE);
+
+                for (int y = minY; y < maxY; ++y) {
+                    const int worldY = origin.y + y;
+                    context.voxels.set(x, y, z, worldY < groundHeight - 2
+                                                    ? biomeData.subSurfaceBlock
+                                                    : biomeData.surfaceBlock);
+                }
             }
         }
+    }
 
-        // Première passe : génération du terrain de base (optimisée)
-        for (int y = 0; y < VoxelArray::SIZE; ++y) {
-            const int worldY = chunkPos.y * VoxelArray::SIZE + y;
-            for (int x = 0; x < VoxelArray::SIZE; ++x) {
-                const int worldX = chunkPos.x * VoxelArray::SIZE + x;
-                for (int z = 0; z < VoxelArray::SIZE; ++z) {
-                    const int worldZ = chunkPos.z * VoxelArray::SIZE + z;
-                    const int groundHeight = heightMap[x][z];
-                    const BiomeType biome = biomeMap[x][z];
-                    const BiomeData &biomeData = biomeConfigs[static_cast<int>(biome)];
+    void NaturalTerrainGenerator::applyCarvers(GenerationContext &context) {
+        const glm::ivec3 origin = context.getWorldOrigin();
 
-                    VoxelType voxelID = VoxelID::AIR;
+        for (int x = 0; x < VoxelArray::SIZE; ++x) {
+            const int worldX = origin.x + x;
+            for (int z = 0; z < VoxelArray::SIZE; ++z) {
+                const int worldZ = origin.z + z;
+                const int groundHeight = context.column.getHeight(x, z);
 
-                    // Génération optimisée par hauteur
-                    if (worldY < groundHeight - 10) {
-                        // Cavernes
-                        if (worldY > 10) {
-                            glm::ivec3 worldPos(worldX, worldY, worldZ);
-                            const double caveValue = getCaveNoise(worldPos);
-                            if (caveValue < 0.1) {
-                                voxelID = VoxelID::AIR;
-                            } else {
-                                voxelID = biomeData.deepBlock;
-                            }
-                        } else {
-                            voxelID = biomeData.deepBlock;
-                        }
-                    } else if (worldY < groundHeight - 2) {
-                        voxelID = biomeData.subSurfaceBlock;
-                    } else if (worldY < groundHeight) {
-                        voxelID = biomeData.surfaceBlock;
-                    } else if (worldY < SEA_LEVEL) {
-                        voxelID = VoxelID::WATER;
-                    }
+                // Cavernes uniquement dans la couche profonde, au-dessus de y = 10
+                const int minY = std::max(11 - origin.y, 0);
+                const int maxY = std::min(groundHeight - 10 - origin.y, VoxelArray::SIZE);
 
-                    voxelChunk.set({x, y, z}, voxelID);
+                for (int y = minY; y < maxY; ++y) {
+                    const glm::ivec3 worldPos(worldX, origin.y + y, worldZ);
+                    if (getCaveNoise(worldPos) < 0.1)
+                        context.voxels.set(x, y, z, VoxelID::AIR);
                 }
             }
         }
+    }
+
+    void NaturalTerrainGenerator::applyOres(GenerationContext &context) {
+        const glm::ivec3 origin = context.getWorldOrigin();
 
-        // Deuxième passe : génération des structures (arbres) - optimisée
         for (int x = 0; x < VoxelArray::SIZE; ++x) {
+            const int worldX = origin.x + x;
             for (int z = 0; z < VoxelArray::SIZE; ++z) {
-                const int groundHeight = heightMap[x][z];
-                const int worldY = chunkPos.y * VoxelArray::SIZE;
-
-                // Vérifier si la surface est dans ce chunk
-                const int surfaceLocalY = groundHeight - worldY;
-                if (surfaceLocalY >= 0 && surfaceLocalY < VoxelArray::SIZE - 6) {
-                    const BiomeType biome = biomeMap[x][z];
-                    const BiomeData &biomeData = biomeConfigs[static_cast<int>(biome)];
-
-                    const int worldX = chunkPos.x * VoxelArray::SIZE + x;
-                    const int worldZ = chunkPos.z * VoxelArray::SIZE + z;
-                    glm::ivec3 worldPos(worldX, groundHeight, worldZ);
-
-                    // Vérifier si on doit générer un arbre
-                    if (shouldGenerateTree(worldPos, biomeData)) {
-                        // Vérifier l'espace disponible
-                        bool canPlaceTree = true;
-                        for (int checkY = 1; checkY <= 6 && canPlaceTree; checkY++) {
-                            if (surfaceLocalY + checkY >= VoxelArray::SIZE) {
-                                canPlaceTree = false;
-                            } else if (voxelChunk.get({x, surfaceLocalY + checkY, z}) != VoxelID::AIR) {
-                                canPlaceTree = false;
-                            }
-                        }
-
-                        if (canPlaceTree) {
-                            generateTree(voxelChunk, {x, surfaceLocalY + 1, z}, chunkPos);
-                        }
-                    }
+                const int worldZ = origin.z + z;
+                const int groundHeight = context.column.getHeight(x, z);
+                const BiomeData &biomeData = biomeConfigs[context.column.getBiome(x, z)];
+                if (!biomeData.hasOres) continue;
+
+                const int maxY = std::min(groundHeight - 10 - origin.y, VoxelArray::SIZE);
+                for (int y = 0; y < maxY; ++y) {
+                    // Ne pas remplir les cavernes
+                    if (context.voxels.get(x, y, z) == VoxelID::AIR) continue;
+
+                    const int worldY = origin.y + y;
+                    const double depthFromSurface = groundHeight - worldY;
+                    const VoxelType oreType = getOreType(glm::ivec3(worldX, worldY, worldZ), depthFromSurface);
+                    if (oreType != VoxelID::STONE)
+                        context.voxels.set(x, y, z, oreType);
                 }
             }
         }
     }
-}
\ No newline at end of file
+
+    void NaturalTerrainGenerator::placeFeatures(GenerationContext &context) {
+        const glm::ivec3 origin = context.getWorldOrigin();
+
+        // Les couronnes débordent de TREE_RADIUS : les pieds des colonnes voisines proches comptent aussi
+        for (int x = -TREE_RADIUS; x < VoxelArray::SIZE + TREE_RADIUS; ++x) {
+            for (int z = -TREE_RADIUS; z < VoxelArray::SIZE + TREE_RADIUS; ++z) {
+                const ColumnData *column = context.getColumnAt(x, z);
+                if (!column) continue;
+
+                // Coordonnées dans la colonne qui contient le pied
+                const int columnX = x & (VoxelArray::SIZE - 1);
+                const int columnZ = z & (VoxelArray::SIZE - 1);
+                const int groundHeight = column->getHeight(columnX, columnZ);
+
+                // Pas d'arbre sous l'eau ; rien à faire si l'arbre ne traverse pas ce chunk
+                if (groundHeight < SEA_LEVEL) continue;
+                if (groundHeight + TREE_MAX_HEIGHT + 1 < origin.y || groundHeight >= origin.y + VoxelArray::SIZE)
+                    continue;
+
+                const BiomeData &biomeData = biomeConfigs[column->getBiome(columnX, columnZ)];
+                const glm::ivec3 worldPos(origin.x + x, groundHeight, origin.z + z);
+                if (!shouldGenerateTree(worldPos, biomeData)) continue;
+
+                // Hauteur tirée de la position : la même pour tous les chunks que l'arbre traverse
+                const auto hash = ash::HashCoord3(worldPos.x, static_cast<int>(m_seed), worldPos.z);
+                const int height = TREE_MIN_HEIGHT + static_cast<int>(hash % (TREE_MAX_HEIGHT - TREE_MIN_HEIGHT + 1));
+
+                generateTree(context.voxels, {x, groundHeight - origin.y, z}, height);
+            }
+        }
+    }
+}
@@ -0,0 +1,77 @@
+#include "Voxelity/voxelWorld/lod/LodDownsampler.h"
+
+#include <array>
+
+namespace voxelity {
+    namespace {
+        // Vote à la majorité en une passe : le premier type à atteindre le meilleur score l'emporte
+        struct TypeVote {
+            std::array<uint16_t, MAX_TYPE_ID + 1> counts{};
+            VoxelType best = VoxelID::AIR;
+            uint16_t bestCount = 0;
+
+            void add(const VoxelType type) {
+                if (++counts[type] > bestCount) {
+                    best = type;
+                    bestCount = counts[type];
+                }
+            }
+        };
+    }
+
+    void LodDownsampler::downsample(const VoxelArray &src, const int scale, VoxelArray &dst,
+                                    const glm::ivec3 &dstOffset) {
+        const int cells = VoxelArray::SIZE / scale;
+        for (int y = 0; y < cells; ++y) {
+            for (int z = 0; z < cells; ++z) {
+                for (int x = 0; x < cells; ++x) {
+                    dst.set(dstOffset.x + x, dstOffset.y + y, dstOffset.z + z,
+                            mergeCell(src, glm::ivec3(x, y, z) * scale, scale));
+                }
+            }
+        }
+    }
+
+    VoxelType LodDownsampler::mergeCell(const VoxelArray &src, const glm::ivec3 &min, const int scale) {
+        if (scale == 1) return src.get(min.x, min.y, min.z);
+
+        const int volume = scale * scale * scale;
+        int opaqueCount = 0;
+        int transparentCount = 0;
+        int topOpaqueLayer = -1;
+
+        TypeVote transparent;
+        for (int y = 0; y < scale; ++y) {
+            for (int z = 0; z < scale; ++z) {
+                const VoxelType *row = src.getRow(min.y + y, min.z + z) + min.x;
+                for (int x = 0; x < scale; ++x) {
+                    const RenderMode mode = getRenderMode(row[x]);
+                    if (mode == RenderMode::OPAQUE) {
+                        ++opaqueCount;
+                        topOpaqueLayer = y;
+                    } else if (mode == RenderMode::TRANSPARENT) {
+                        ++transparentCount;
+                        transparent.add(row[x]);
+                    }
+                }
+            }
+        }
+
+        if (opaqueCount * 2 >= volume) {
+            // Type visible depuis le dessus : la couche opaque la plus haute
+            TypeVote top;
+            for (int z = 0; z < scale; ++z) {
+                const VoxelType *row = src.getRow(min.y + topOpaqueLayer, min.z + z) + min.x;
+                for (int x = 0; x < scale; ++x) {
+                    if (getRenderMode(row[x]) == RenderMode::OPAQUE) top.add(row[x]);
+                }
+            }
+            return top.best;
+        }
+
+        if (transparentCount > 0 && (opaqueCount + transparentCount) * 2 >= volume)
+            return transparent.best;
+
+        return VoxelID::AIR;
+    }
+}
@@ -0,0 +1,310 @@
+#include "Voxelity/voxelWorld/lod/LodManager.h"
+
+#include <algorithm>
+
+#include "Voxelity/voxelWorld/generation/ColumnCache.h"
+#include "Voxelity/voxelWorld/generation/ITerrainGenerator.h"
+#include "Voxelity/voxelWorld/lod/LodDownsampler.h"
+#include "Voxelity/voxelWorld/utils/DirectionUtils.h"
+#include "Voxelity/voxelWorld/world/ChunkManager.h"
+
+namespace voxelity {
+    namespace {
+        // Même règle que les chunks pleine résolution
+        bool isFaceVisible(const VoxelType voxel, const RenderMode mode, const VoxelType neighbor) {
+            if (neighbor == VoxelID::AIR) return true;
+
+            const RenderMode neighborMode = getRenderMode(neighbor);
+            if (mode == RenderMode::OPAQUE) return neighborMode == RenderMode::TRANSPARENT;
+            return neighborMode == RenderMode::TRANSPARENT && voxel != neighbor;
+        }
+    }
+
+    size_t LodMesh::getInstanceCount() const {
+        return (opaqueMesh ? opaqueMesh->getInstanceCount() : 0) +
+               (transparentMesh ? transparentMesh->getInstanceCount() : 0);
+    }
+
+    LodManager::LodManager(ChunkManager &chunkManager, ITerrainGenerator *generator, ColumnCache *columnCache)
+        : m_chunkManager(chunkManager), m_generator(generator), m_columnCache(columnCache) {
+        m_thread = std::thread(&LodManager::worker, this);
+    }
+
+    LodManager::~LodManager() {
+        shutdown();
+    }
+
+    void LodManager::shutdown() {
+        m_running = false;
+        m_buildCV.notify_all();
+        if (m_thread.joinable()) m_thread.join();
+    }
+
+    void LodManager::setLevelCount(const int levelCount) {
+        const int clamped = std::clamp(levelCount, 0, LOD_MAX_LEVEL);
+        if (clamped == m_levelCount) return;
+
+        clear();
+        m_levelCount = clamped;
+    }
+
+    void LodManager::update(const glm::ivec3 &playerChunk, const int renderDistance) {
+        if (!isEnabled()) return;
+
+        // Pleine résolution en deçà de renderDistance - 1 : ces chunks ont tous leurs voisins chargés
+        ash::Vector<LodNode> nodes;
+        LodSelector::select(playerChunk, renderDistance - 1, m_levelCount, nodes);
+        ash::FlatHashSet<LodNode> selection(nodes.begin(), nodes.end());
+
+        // Les noeuds sortants restent affichés jusqu'à ce que leurs remplaçants soient prêts
+        for (const auto &node: m_selection) {
+            if (!selection.contains(node) && (node.level == 0 || m_meshes.contains(node)))
+                m_retired.push_back(node);
+        }
+        m_selection = std::move(selection);
+        std::erase_if(m_retired, [this](const LodNode &node) { return m_selection.contains(node); });
+
+        m_visibleChunks.clear();
+        for (const auto &node: nodes) {
+            if (node.level == 0) m_visibleChunks.insert(node.origin);
+        }
+        for (const auto &node: m_retired) {
+            if (node.level == 0) m_visibleChunks.insert(node.origin);
+        }
+
+        // File reconstruite : priorités à jour et noeuds abandonnés oubliés
+        std::priority_queue<BuildRequest> queue;
+        for (const auto &node: nodes) {
+            if (node.level > 0 && !m_meshes.contains(node))
+                queue.push({node, LodSelector::distanceToNode(playerChunk, node)});
+        } {
+            std::lock_guard lock(m_buildQueueMutex);
+            m_buildQueue = std::move(queue);
+        }
+        m_buildCV.notify_all();
+    }
+
+    void LodManager::processCompleted() {
+        m_meshPool.advanceFrame(); {
+            std::lock_guard lock(m_completedMutex);
+            while (!m_completed.empty()) {
+                auto &[node, opaqueFaces, transparentFaces] = m_completed.front();
+
+                // Noeud sorti de la sélection pendant sa construction
+                if (m_selection.contains(node)) {
+                    eraseMesh(node);
+
+                    auto mesh = std::make_unique<LodMesh>();
+                    mesh->node = node;
+                    mesh->opaqueMesh = m_meshPool.acquire(opaqueFaces);
+                    mesh->transparentMesh = m_meshPool.acquire(transparentFaces);
+                    m_meshes[node] = std::move(mesh);
+                }
+
+                m_completed.pop();
+            }
+        }
+
+        // Les chunks pleine résolution arrivent aussi au fil de l'eau : vérifié tant que des noeuds attendent
+        std::erase_if(m_retired, [this](const LodNode &node) {
+            if (!isCovered(node)) return false;
+
+            if (node.level == 0) m_visibleChunks.erase(node.origin);
+            else eraseMesh(node);
+            return true;
+        });
+    }
+
+    bool LodManager::isChunkVisible(const ChunkCoord &coord) const {
+        return !isEnabled() || m_visibleChunks.contains(coord);
+    }
+
+    void LodManager::forEachMesh(const std::function<void(const LodMesh &)> &func) const {
+        for (const auto &[node, mesh]: m_meshes)
+            func(*mesh);
+    }
+
+    size_t LodManager::getInstanceCount() const {
+        size_t count = 0;
+        for (const auto &[node, mesh]: m_meshes)
+            count += mesh->getInstanceCount();
+        return count;
+    }
+
+    size_t LodManager::getPendingBuildCount() {
+        std::lock_guard lock(m_buildQueueMutex);
+        return m_buildQueue.size();
+    }
+
+    void LodManager::clear() { {
+            std::lock_guard lock(m_buildQueueMutex);
+            m_buildQueue = {};
+        } {
+            std::lock_guard lock(m_completedMutex);
+            m_completed = {};
+        }
+
+        m_selection.clear();
+        m_visibleChunks.clear();
+        for (auto &[node, mesh]: m_meshes) {
+            m_meshPool.release(std::move(mesh->opaqueMesh));
+            m_meshPool.release(std::move(mesh->transparentMesh));
+        }
+        m_meshes.clear();
+        m_retired.clear();
+    }
+
+    void LodManager::eraseMesh(const LodNode &node) {
+        const auto it = m_meshes.find(node);
+        if (it == m_meshes.end()) return;
+
+        m_meshPool.release(std::move(it->second->opaqueMesh));
+        m_meshPool.release(std::move(it->second->transparentMesh));
+        m_meshes.erase(node);
+    }
+
+    void LodManager::worker() {
+        while (m_running.load()) {
+            LodNode node; {
+                std::unique_lock lock(m_buildQueueMutex);
+                m_buildCV.wait(lock, [this] {
+                    return !m_buildQueue.empty() || !m_running;
+                });
+
+                if (!m_running) break;
+                if (m_buildQueue.empty()) continue;
+
+                node = m_buildQueue.top().node;
+                m_buildQueue.pop();
+            }
+
+            BuildResult result = buildNode(node);
+
+            std::lock_guard lock(m_completedMutex);
+            m_completed.push(std::move(result));
+        }
+    }
+
+    LodManager::BuildResult LodManager::buildNode(const LodNode &node) {
+        BuildResult result;
+        result.node = node;
+
+        VoxelArray cells;
+        sampleNode(node, cells);
+
+        const int scale = node.getScale();
+        const glm::ivec3 worldOrigin = glm::ivec3(node.origin.x, node.origin.y, node.origin.z) * VoxelArray::SIZE;
+        buildMesh(cells, [&](const int x, const int y, const int z) {
+            return sampleOutside(worldOrigin + glm::ivec3(x, y, z) * scale, scale);
+        }, result.opaqueFaces, result.transparentFaces);
+
+        return result;
+    }
+
+    void LodManager::sampleNode(const LodNode &node, VoxelArray &cells) {
+        const int size = node.getSize();
+        const int scale = node.getScale();
+        const int cellsPerChunk = VoxelArray::SIZE / scale;
+
+        VoxelArray voxels;
+        for (int cz = 0; cz < size; ++cz) {
+            for (int cx = 0; cx < size; ++cx) {
+                const auto column = m_columnCache->getOrBuild({node.origin.x + cx, node.origin.z + cz});
+                const int minHeight = *std::ranges::min_element(column->heightMap);
+
+                for (int cy = 0; cy < size && m_running; ++cy) {
+                    const ChunkCoord coord{node.origin.x + cx, node.origin.y + cy, node.origin.z + cz};
+                    const glm::ivec3 offset = glm::ivec3(cx, cy, cz) * cellsPerChunk;
+
+                    if (m_generator->isChunkEmpty(coord, *column)) continue;
+
+                    // Enfoui à plus d'un chunk sous le point le plus bas de la colonne :
+                    // seules d'éventuelles falaises le montrent, rempli de pierre sans générer
+                    if ((coord.y + 2) * VoxelArray::SIZE <= minHeight) {
+                        for (int y = 0; y < cellsPerChunk; ++y) {
+                            for (int z = 0; z < cellsPerChunk; ++z) {
+                                VoxelType *row = cells.getRow(offset.y + y, offset.z + z) + offset.x;
+                                std::fill_n(row, cellsPerChunk, VoxelID::STONE);
+                            }
+                        }
+                        continue;
+                    }
+
+                    GenerationContext context{coord, voxels, *column};
+                    m_generator->generateLodChunk(context);
+                    LodDownsampler::downsample(voxels, scale, cells, offset);
+                }
+            }
+        }
+    }
+
+    VoxelType LodManager::sampleOutside(const glm::ivec3 &cellMin, const int scale) {
+        const int worldX = cellMin.x + scale / 2;
+        const int worldZ = cellMin.z + scale / 2;
+        const auto column = m_columnCache->getOrBuild({worldX >> VoxelArray::SHIFT, worldZ >> VoxelArray::SHIFT});
+        const int groundHeight = column->getHeight(worldX & VoxelArray::MASK, worldZ & VoxelArray::MASK);
+
+        return cellMin.y + 3 * scale <= groundHeight ? VoxelID::STONE : VoxelID::AIR;
+    }
+
+    bool LodManager::isCovered(const LodNode &node) const {
+        const int size = node.getSize();
+        for (int y = 0; y < size; ++y) {
+            for (int z = 0; z < size; ++z) {
+                for (int x = 0; x < size; ++x) {
+                    const ChunkCoord coord{node.origin.x + x, node.origin.y + y, node.origin.z + z};
+
+                    // Hors de portée, aucun noeud ne le remplacera
+                    for (int level = 0; level <= m_levelCount; ++level) {
+                        const LodNode candidate = LodNode::containing(coord, static_cast<uint8_t>(level));
+                        if (!m_selection.contains(candidate)) continue;
+
+                        if (!isReady(candidate)) return false;
+                        break;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    bool LodManager::isReady(const LodNode &node) const {
+        if (node.level > 0) return m_meshes.contains(node);
+
+        const Chunk *chunk = m_chunkManager.getChunk(node.origin);
+        return chunk && chunk->hasMesh();
+    }
+
+    void LodManager::buildMesh(const VoxelArray &cells,
+                               const std::function<VoxelType(int, int, int)> &neighbors,
+                               ash::Vector<FaceInstance> &opaqueFaces,
+                               ash::Vector<FaceInstance> &transparentFaces) {
+        for (int y = 0; y < VoxelArray::SIZE; ++y) {
+            for (int z = 0; z < VoxelArray::SIZE; ++z) {
+                for (int x = 0; x < VoxelArray::SIZE; ++x) {
+                    const VoxelType voxel = cells.get(x, y, z);
+                    if (voxel == VoxelID::AIR) continue;
+
+                    const RenderMode mode = getRenderMode(voxel);
+                    for (uint8_t faceID = 0; faceID < 6; ++faceID) {
+                        const glm::ivec3 offset = DirectionUtils::getOffset(DirectionUtils::fromIndex(faceID));
+                        const int nx = x + offset.x, ny = y + offset.y, nz = z + offset.z;
+                        const bool inside = nx >= 0 && ny >= 0 && nz >= 0 &&
+                                            nx < VoxelArray::SIZE && ny < VoxelArray::SIZE && nz < VoxelArray::SIZE;
+
+                        // Pas de parois d'eau entre deux noeuds : la surface seule suffit au loin
+                        if (!inside && mode == RenderMode::TRANSPARENT) continue;
+
+                        const VoxelType neighbor = inside ? cells.get(nx, ny, nz) : neighbors(nx, ny, nz);
+                        if (!isFaceVisible(voxel, mode, neighbor)) continue;
+
+                        // Pas de lumière calculée au loin : plein ciel
+                        const FaceInstance face{glm::ivec3(x, y, z), faceID, voxel};
+                        if (mode == RenderMode::TRANSPARENT) transparentFaces.push_back(face);
+                        else opaqueFaces.push_back(face);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#include "Voxelity/voxelWorld/lod/LodSelector.h"
+
+#include <algorithm>
+
+namespace voxelity {
+    bool LodNode::contains(const ChunkCoord &coord) const {
+        const int size = getSize();
+        return coord.x >= origin.x && coord.x < origin.x + size &&
+               coord.y >= origin.y && coord.y < origin.y + size &&
+               coord.z >= origin.z && coord.z < origin.z + size;
+    }
+
+    LodNode LodNode::containing(const ChunkCoord &coord, const uint8_t level) {
+        // Décalage arithmétique : arrondi vers -infini pour les coordonnées négatives
+        return {{coord.x >> level << level, coord.y >> level << level, coord.z >> level << level}, level};
+    }
+
+    int LodSelector::distanceToNode(const glm::ivec3 &center, const LodNode &node) {
+        const glm::ivec3 min(node.origin.x, node.origin.y, node.origin.z);
+        const glm::ivec3 max = min + glm::ivec3(node.getSize() - 1);
+        const glm::ivec3 delta = glm::max(glm::max(min - center, center - max), glm::ivec3(0));
+        return std::max({delta.x, delta.y, delta.z});
+    }
+
+    int LodSelector::getMaxDistance(const int detailRadius, const int levelCount) {
+        return (std::clamp(levelCount, 0, LOD_MAX_LEVEL) + 1) * std::max(detailRadius, 1);
+    }
+
+    void LodSelector::select(const glm::ivec3 &center, const int detailRadius, const int levelCount,
+                             ash::Vector<LodNode> &out) {
+        const int radius = std::max(detailRadius, 1);
+        const auto rootLevel = static_cast<uint8_t>(std::clamp(levelCount, 0, LOD_MAX_LEVEL));
+        const int maxDistance = getMaxDistance(radius, rootLevel);
+
+        // Racines : grille du niveau le plus grossier recouvrant le cube de rayon maxDistance
+        const LodNode minRoot = LodNode::containing(ChunkCoord(center - glm::ivec3(maxDistance)), rootLevel);
+        const LodNode maxRoot = LodNode::containing(ChunkCoord(center + glm::ivec3(maxDistance)), rootLevel);
+        const int step = 1 << rootLevel;
+
+        for (int y = minRoot.origin.y; y <= maxRoot.origin.y; y += step) {
+            for (int z = minRoot.origin.z; z <= maxRoot.origin.z; z += step) {
+                for (int x = minRoot.origin.x; x <= maxRoot.origin.x; x += step) {
+                    const LodNode root{{x, y, z}, rootLevel};
+                    if (distanceToNode(center, root) < maxDistance)
+                        selectNode(center, root, radius, out);
+                }
+            }
+        }
+    }
+
+    void LodSelector::selectNode(const glm::ivec3 &center, const LodNode &node, const int detailRadius,
+                                 ash::Vector<LodNode> &out) {
+        if (node.level == 0 || distanceToNode(center, node) >= node.level * detailRadius) {
+            out.push_back(node);
+            return;
+        }
+
+        const int half = node.getSize() / 2;
+        const auto childLevel = static_cast<uint8_t>(node.level - 1);
+        for (int i = 0; i < 8; ++i) {
+            const ChunkCoord childOrigin{
+                node.origin.x + (i & 1) * half,
+                node.origin.y + (i >> 1 & 1) * half,
+                node.origin.z + (i >> 2 & 1) * half
+            };
+            selectNode(center, {childOrigin, childLevel}, detailRadius, out);
+        }
+    }
+}
@@ -0,0 +1,65 @@
+#include "Voxelity/voxelWorld/render/ChunkDrawOrder.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace voxelity {
+    void ChunkDrawOrder::clear() {
+        m_x.clear();
+        m_y.clear();
+        m_z.clear();
+        m_order.clear();
+    }
+
+    void ChunkDrawOrder::add(const ChunkCoord &coord) {
+        m_x.push_back(coord.x);
+        m_y.push_back(coord.y);
+        m_z.push_back(coord.z);
+    }
+
+    void ChunkDrawOrder::sortFrontToBack(const ChunkCoord &center) {
+        constexpr size_t BUCKETS = MAX_KEY + 1;
+        const size_t count = size();
+
+        // Clés calculées à part : boucle sans dépendance, vectorisable. Pointeurs locaux, sinon
+        // l'écriture d'octets peut aliaser les membres des vecteurs aux yeux du compilateur
+        m_keys.resize(count);
+        const int32_t *xs = m_x.data();
+        const int32_t *ys = m_y.data();
+        const int32_t *zs = m_z.data();
+        uint8_t *keys = m_keys.data();
+        for (size_t i = 0; i < count; ++i) {
+            const int dx = std::abs(xs[i] - center.x);
+            const int dy = std::abs(ys[i] - center.y);
+            const int dz = std::abs(zs[i] - center.z);
+            keys[i] = static_cast<uint8_t>(std::min(std::max(dx, std::max(dy, dz)), static_cast<int>(MAX_KEY)));
+        }
+
+        // Quatre histogrammes entrelacés : deux clés voisines souvent égales ne s'attendent pas
+        m_counts.assign(4 * BUCKETS, 0);
+        uint32_t *counts = m_counts.data();
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            ++counts[keys[i]];
+            ++counts[BUCKETS + keys[i + 1]];
+            ++counts[2 * BUCKETS + keys[i + 2]];
+            ++counts[3 * BUCKETS + keys[i + 3]];
+        }
+        for (; i < count; ++i)
+            ++counts[keys[i]];
+
+        // Début de chaque anneau dans le résultat
+        uint32_t offset = 0;
+        for (size_t key = 0; key < BUCKETS; ++key) {
+            const uint32_t size = counts[key] + counts[BUCKETS + key] + counts[2 * BUCKETS + key] +
+                                  counts[3 * BUCKETS + key];
+            counts[key] = offset;
+            offset += size;
+        }
+
+        m_order.resize(count);
+        uint32_t *order = m_order.data();
+        for (size_t j = 0; j < count; ++j)
+            order[counts[keys[j]]++] = static_cast<uint32_t>(j);
+    }
+}
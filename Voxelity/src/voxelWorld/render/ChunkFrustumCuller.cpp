@@ -0,0 +1,63 @@
+#include "Voxelity/voxelWorld/render/ChunkFrustumCuller.h"
+
+#include <algorithm>
+
+namespace voxelity {
+    void ChunkFrustumCuller::cull(const ash::Frustum &frustum, const std::span<const ChunkCoord> coords,
+                                  const float chunkSize, ash::Vector<uint8_t> &visible) {
+        m_batch.Clear();
+        m_batchIndices.clear();
+        m_groupCount = 0;
+        visible.assign(coords.size(), 0);
+        if (coords.empty()) return;
+
+        constexpr int groupSize = 1 << GROUP_SHIFT;
+        const float size = chunkSize * VoxelArray::SIZE;
+
+        // Étendue des groupes, pour indexer la grille
+        ChunkCoord low = coords[0];
+        ChunkCoord high = coords[0];
+        for (const ChunkCoord &coord: coords) {
+            low = {std::min(low.x, coord.x), std::min(low.y, coord.y), std::min(low.z, coord.z)};
+            high = {std::max(high.x, coord.x), std::max(high.y, coord.y), std::max(high.z, coord.z)};
+        }
+        low = {low.x >> GROUP_SHIFT, low.y >> GROUP_SHIFT, low.z >> GROUP_SHIFT};
+        const glm::ivec3 extent(
+            (high.x >> GROUP_SHIFT) - low.x + 1,
+            (high.y >> GROUP_SHIFT) - low.y + 1,
+            (high.z >> GROUP_SHIFT) - low.z + 1
+        );
+        m_groups.assign(static_cast<size_t>(extent.x) * extent.y * extent.z, UNCLASSIFIED);
+
+        for (size_t i = 0; i < coords.size(); ++i) {
+            const ChunkCoord &coord = coords[i];
+            const glm::ivec3 group(coord.x >> GROUP_SHIFT, coord.y >> GROUP_SHIFT, coord.z >> GROUP_SHIFT);
+            const size_t index = (static_cast<size_t>(group.y - low.y) * extent.z + (group.z - low.z)) * extent.x
+                                 + (group.x - low.x);
+
+            uint8_t &cell = m_groups[index];
+            if (cell == UNCLASSIFIED) {
+                const ash::Vec3 min = ash::Vec3(group) * (size * groupSize);
+                cell = static_cast<uint8_t>(frustum.ClassifyAABB(min, min + ash::Vec3(size * groupSize)));
+                ++m_groupCount;
+            }
+
+            switch (static_cast<ash::Frustum::Intersection>(cell)) {
+                case ash::Frustum::Intersection::Inside: visible[i] = 1;
+                    break;
+                case ash::Frustum::Intersection::Intersects: {
+                    const ash::Vec3 min = ash::Vec3(coord.x, coord.y, coord.z) * size;
+                    m_batch.Add(min, min + ash::Vec3(size));
+                    m_batchIndices.push_back(static_cast<uint32_t>(i));
+                    break;
+                }
+                default: break;
+            }
+        }
+
+        m_batchResults.resize(m_batch.Count());
+        frustum.IntersectsAABBs(m_batch, m_batchResults);
+        for (size_t j = 0; j < m_batchIndices.size(); ++j)
+            visible[m_batchIndices[j]] = m_batchResults[j];
+    }
+}
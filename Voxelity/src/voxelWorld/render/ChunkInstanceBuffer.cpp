@@ -0,0 +1,184 @@
+#include "Voxelity/voxelWorld/render/ChunkInstanceBuffer.h"
+
+#include <bit>
+
+#include "Ashen/Core/Logger.h"
+#include "Ashen/Graphics/Rendering/Renderer.h"
+
+namespace voxelity {
+    // Deux triangles par face, générés à partir de gl_VertexID
+    constexpr uint32_t FACE_VERTEX_COUNT = 6;
+
+    ChunkInstanceBuffer::ChunkInstanceBuffer(const uint32_t initialCapacity)
+        : m_arena(initialCapacity) {
+    }
+
+    void ChunkInstanceBuffer::createBuffers() {
+        m_instances = ash::VertexBuffer::CreateEmpty(m_arena.getCapacity(), sizeof(FaceInstance));
+
+        // divisor 1 : l'attribut d'instance tient compte du baseInstance des commandes
+        const ash::VertexBufferLayout layout({
+            ash::VertexAttributeDescription::UInt(0, 0, 1)
+        });
+        m_vao = ash::VertexArray::CreateWithBuffer(m_instances, layout);
+
+        for (Batch &batch: m_batches) {
+            if (!batch.commands) batch.commands = ash::IndirectBuffer::Create();
+            if (!batch.origins) batch.origins = std::make_shared<ash::ShaderStorageBuffer>(ash::BufferConfig::Stream());
+        }
+    }
+
+    void ChunkInstanceBuffer::upload(const ChunkCoord &coord, const std::span<const FaceInstance> opaqueFaces,
+                                     const std::span<const FaceInstance> transparentFaces) {
+        if (!m_instances) createBuffers();
+
+        if (opaqueFaces.empty() && transparentFaces.empty()) {
+            release(coord);
+            return;
+        }
+
+        // Remaillage d'un chunk déjà présent : l'ensemble des chunks ne change pas
+        const auto [it, inserted] = m_entries.emplace(coord);
+        Entry &entry = it->second;
+        if (inserted) {
+            ++m_revision;
+        } else {
+            m_arena.free(entry.opaque);
+            m_arena.free(entry.transparent);
+            entry = {};
+        }
+
+        entry.opaque = allocate(opaqueFaces);
+        entry.transparent = allocate(transparentFaces);
+        entry.transparentFaces.assign(transparentFaces.begin(), transparentFaces.end());
+    }
+
+    void ChunkInstanceBuffer::release(const ChunkCoord &coord) {
+        const auto it = m_entries.find(coord);
+        if (it == m_entries.end()) return;
+
+        m_arena.free(it->second.opaque);
+        m_arena.free(it->second.transparent);
+        m_entries.erase(coord);
+        ++m_revision;
+    }
+
+    void ChunkInstanceBuffer::clear() {
+        ++m_revision;
+        m_entries.clear();
+        m_arena.clear();
+    }
+
+    InstanceArena::Handle ChunkInstanceBuffer::allocate(const std::span<const FaceInstance> faces) {
+        const auto count = static_cast<uint32_t>(faces.size());
+        if (count == 0) return InstanceArena::INVALID_HANDLE;
+
+        InstanceArena::Handle handle = m_arena.allocate(count);
+        if (handle == InstanceArena::INVALID_HANDLE) {
+            // Assez de place au total : le compactage suffit, sinon la capacité double
+            uint32_t capacity = m_arena.getCapacity();
+            if (m_arena.getFreeCount() < count)
+                capacity = std::bit_ceil(std::max(m_arena.getUsedCount() + count, capacity * 2));
+
+            relocate(capacity);
+            handle = m_arena.allocate(count);
+        }
+
+        const InstanceArena::Range range = m_arena.get(handle);
+        m_instances->Update(faces, range.offset * sizeof(FaceInstance));
+        return handle;
+    }
+
+    void ChunkInstanceBuffer::relocate(const uint32_t capacity) {
+        m_arena.grow(capacity);
+        m_arena.compact(m_moves);
+
+        // Copie vers un buffer neuf : les plages source et destination peuvent se chevaucher
+        const ash::Ref<ash::VertexBuffer> previous = m_instances;
+        createBuffers();
+        for (const auto &[from, to, count]: m_moves) {
+            m_instances->CopyFrom(*previous, from * sizeof(FaceInstance), to * sizeof(FaceInstance),
+                                  count * sizeof(FaceInstance));
+        }
+
+        ++m_compactionCount;
+        ash::Logger::Info() << "Chunk instance buffer compacted: " << m_arena.getUsedCount() << " / "
+                << m_arena.getCapacity() << " faces, " << m_moves.size() << " copies";
+    }
+
+    bool ChunkInstanceBuffer::contains(const ChunkCoord &coord) const {
+        return m_entries.find(coord) != m_entries.end();
+    }
+
+    bool ChunkInstanceBuffer::hasTransparentFaces(const ChunkCoord &coord) const {
+        const auto it = m_entries.find(coord);
+        return it != m_entries.end() && !it->second.transparentFaces.empty();
+    }
+
+    void ChunkInstanceBuffer::sortTransparent(const std::span<const Chunk *const> chunks, const glm::vec3 &camera,
+                                              const float chunkSpacing, TransparentSortStats &stats) {
+        constexpr float HALF_CHUNK = VoxelArray::SIZE * 0.5f;
+
+        size_t sortedFaces = 0;
+        for (auto chunk = chunks.rbegin(); chunk != chunks.rend(); ++chunk) {
+            const glm::ivec3 position = (*chunk)->getPosition();
+            const auto it = m_entries.find(ChunkCoord(position));
+            if (it == m_entries.end() || it->second.transparentFaces.empty()) continue;
+
+            Entry &entry = it->second;
+            const glm::vec3 cameraLocal = camera - TransparentSorter::getChunkOrigin(position, chunkSpacing);
+            const float distance = glm::length(cameraLocal - HALF_CHUNK);
+            if (entry.sorted && !TransparentSorter::needsResort(entry.sortedFrom, cameraLocal, distance)) continue;
+
+            // Budget épuisé : les chunks restants, plus lointains, attendent la frame suivante
+            if (sortedFaces + entry.transparentFaces.size() > MAX_SORTED_FACES_PER_FRAME && sortedFaces > 0)
+                break;
+
+            m_sorter.sortFaces(entry.transparentFaces, cameraLocal);
+            entry.sortedFrom = cameraLocal;
+            entry.sorted = true;
+
+            const InstanceArena::Range range = m_arena.get(entry.transparent);
+            m_instances->Update(std::span<const FaceInstance>(entry.transparentFaces),
+                                range.offset * sizeof(FaceInstance));
+
+            sortedFaces += entry.transparentFaces.size();
+            ++stats.resortedChunks;
+        }
+
+        stats.resortedFaces += sortedFaces;
+    }
+
+    void ChunkInstanceBuffer::draw(const std::span<const Chunk *const> chunks, const bool transparent) {
+        if (!m_instances || m_entries.empty()) return;
+
+        Batch &batch = m_batches[transparent ? 1 : 0];
+        batch.commandData.clear();
+        batch.originData.clear();
+
+        uint32_t instanceCount = 0;
+        for (const Chunk *chunk: chunks) {
+            const glm::ivec3 position = chunk->getPosition();
+            const auto it = m_entries.find(ChunkCoord(position));
+            if (it == m_entries.end()) continue;
+
+            const InstanceArena::Range range = m_arena.get(transparent ? it->second.transparent : it->second.opaque);
+            if (range.count == 0) continue;
+
+            batch.commandData.push_back({FACE_VERTEX_COUNT, range.count, 0, range.offset});
+            batch.originData.emplace_back(glm::vec3(position * VoxelArray::SIZE), 1.0f);
+            instanceCount += range.count;
+        }
+        if (batch.commandData.empty()) return;
+
+        batch.commands->SetCommands(batch.commandData);
+        const std::span<const glm::vec4> origins(batch.originData);
+        if (origins.size_bytes() > batch.origins->Size())
+            batch.origins->SetData(origins);
+        else
+            batch.origins->Update(origins);
+        batch.origins->BindBase(CHUNK_ORIGIN_BINDING);
+
+        ash::Renderer::MultiDrawIndirect(*m_vao, *batch.commands, FACE_VERTEX_COUNT, instanceCount);
+    }
+}
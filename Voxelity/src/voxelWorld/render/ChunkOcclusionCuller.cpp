@@ -0,0 +1,45 @@
+#include "Voxelity/voxelWorld/render/ChunkOcclusionCuller.h"
+
+#include "Voxelity/voxelWorld/utils/DirectionUtils.h"
+
+namespace voxelity {
+    bool ChunkOcclusionCuller::update(const ChunkCoord &start, const VisibilityLookup &lookup) {
+        m_visible.clear();
+        m_queue.clear();
+
+        const ChunkVisibility *startVisibility = lookup(start);
+        if (!startVisibility) return false;
+
+        m_visible.insert(start);
+        m_queue.push_back({start, startVisibility, -1, 0});
+
+        // File FIFO sur un vecteur : les chunks sont visités par distance croissante
+        for (size_t head = 0; head < m_queue.size(); ++head) {
+            const Step step = m_queue[head];
+
+            for (int face = 0; face < ChunkVisibility::FACE_COUNT; ++face) {
+                const auto direction = static_cast<CubicDirection>(face);
+                const int opposite = static_cast<int>(DirectionUtils::getOpposite(direction));
+
+                // Le regard ne fait jamais demi-tour
+                if (step.directions >> opposite & 1) continue;
+                if (step.entryFace >= 0 && !step.visibility->isConnected(step.entryFace, face)) continue;
+
+                const glm::ivec3 offset = DirectionUtils::getOffset(direction);
+                const ChunkCoord neighbor{step.coord.x + offset.x, step.coord.y + offset.y, step.coord.z + offset.z};
+                if (m_visible.contains(neighbor)) continue;
+
+                const ChunkVisibility *neighborVisibility = lookup(neighbor);
+                if (!neighborVisibility) continue;
+
+                m_visible.insert(neighbor);
+                m_queue.push_back({
+                    neighbor, neighborVisibility, static_cast<int8_t>(opposite),
+                    static_cast<uint8_t>(step.directions | 1 << face)
+                });
+            }
+        }
+
+        return true;
+    }
+}
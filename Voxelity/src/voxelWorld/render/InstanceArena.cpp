@@ -0,0 +1,158 @@
+#include "Voxelity/voxelWorld/render/InstanceArena.h"
+
+#include <algorithm>
+
+namespace voxelity {
+    InstanceArena::InstanceArena(const uint32_t capacity) {
+        grow(capacity);
+    }
+
+    InstanceArena::Handle InstanceArena::allocate(const uint32_t count) {
+        if (count == 0) return INVALID_HANDLE;
+
+        // Plus petit bloc suffisant : limite le morcellement des grands blocs
+        size_t best = m_freeBlocks.size();
+        for (size_t i = 0; i < m_freeBlocks.size(); ++i) {
+            const uint32_t size = m_freeBlocks[i].count;
+            if (size < count) continue;
+            if (best == m_freeBlocks.size() || size < m_freeBlocks[best].count) {
+                best = i;
+                if (size == count) break;
+            }
+        }
+        if (best == m_freeBlocks.size()) return INVALID_HANDLE;
+
+        Range &block = m_freeBlocks[best];
+        const Range range{block.offset, count};
+        if (block.count == count) {
+            m_freeBlocks.erase(m_freeBlocks.begin() + static_cast<std::ptrdiff_t>(best));
+        } else {
+            block.offset += count;
+            block.count -= count;
+        }
+
+        Handle handle;
+        if (!m_freeSlots.empty()) {
+            handle = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        } else {
+            handle = static_cast<Handle>(m_slots.size());
+            m_slots.emplace_back();
+        }
+
+        m_slots[handle] = {range, true};
+        m_used += count;
+        return handle;
+    }
+
+    void InstanceArena::free(const Handle handle) {
+        if (!isValid(handle)) return;
+
+        Slot &slot = m_slots[handle];
+        insertFreeBlock(slot.range);
+        m_used -= slot.range.count;
+        slot = {};
+        m_freeSlots.push_back(handle);
+    }
+
+    bool InstanceArena::isValid(const Handle handle) const {
+        return handle < m_slots.size() && m_slots[handle].used;
+    }
+
+    InstanceArena::Range InstanceArena::get(const Handle handle) const {
+        return isValid(handle) ? m_slots[handle].range : Range{};
+    }
+
+    void InstanceArena::grow(const uint32_t capacity) {
+        if (capacity <= m_capacity) return;
+
+        insertFreeBlock({m_capacity, capacity - m_capacity});
+        m_capacity = capacity;
+    }
+
+    void InstanceArena::compact(ash::Vector<Move> &moves) {
+        moves.clear();
+
+        ash::Vector<Handle> order;
+        order.reserve(getAllocationCount());
+        for (Handle handle = 0; handle < m_slots.size(); ++handle) {
+            if (m_slots[handle].used) order.push_back(handle);
+        }
+        std::ranges::sort(order, [this](const Handle a, const Handle b) {
+            return m_slots[a].range.offset < m_slots[b].range.offset;
+        });
+
+        uint32_t cursor = 0;
+        for (const Handle handle: order) {
+            Range &range = m_slots[handle].range;
+
+            // Allocations voisines avant et après : une seule copie
+            if (!moves.empty()) {
+                Move &last = moves.back();
+                if (last.from + last.count == range.offset && last.to + last.count == cursor) {
+                    last.count += range.count;
+                    range.offset = cursor;
+                    cursor += range.count;
+                    continue;
+                }
+            }
+
+            moves.push_back({range.offset, cursor, range.count});
+            range.offset = cursor;
+            cursor += range.count;
+        }
+
+        m_freeBlocks.clear();
+        if (cursor < m_capacity)
+            m_freeBlocks.push_back({cursor, m_capacity - cursor});
+    }
+
+    void InstanceArena::clear() {
+        m_slots.clear();
+        m_freeSlots.clear();
+        m_freeBlocks.clear();
+        m_used = 0;
+        if (m_capacity > 0)
+            m_freeBlocks.push_back({0, m_capacity});
+    }
+
+    uint32_t InstanceArena::getLargestFreeBlock() const {
+        uint32_t largest = 0;
+        for (const Range &block: m_freeBlocks)
+            largest = std::max(largest, block.count);
+        return largest;
+    }
+
+    float InstanceArena::getFragmentation() const {
+        const uint32_t free = getFreeCount();
+        if (free == 0) return 0.0f;
+        return 1.0f - static_cast<float>(getLargestFreeBlock()) / static_cast<float>(free);
+    }
+
+    void InstanceArena::insertFreeBlock(const Range range) {
+        if (range.count == 0) return;
+
+        auto next = std::ranges::lower_bound(m_freeBlocks, range.offset, {}, &Range::offset);
+
+        // Fusion avec le bloc précédent puis le suivant s'ils sont contigus
+        if (next != m_freeBlocks.begin()) {
+            Range &previous = *std::prev(next);
+            if (previous.offset + previous.count == range.offset) {
+                previous.count += range.count;
+                if (next != m_freeBlocks.end() && previous.offset + previous.count == next->offset) {
+                    previous.count += next->count;
+                    m_freeBlocks.erase(next);
+                }
+                return;
+            }
+        }
+
+        if (next != m_freeBlocks.end() && range.offset + range.count == next->offset) {
+            next->offset = range.offset;
+            next->count += range.count;
+            return;
+        }
+
+        m_freeBlocks.insert(next, range);
+    }
+}
@@ -0,0 +1,60 @@
+#include "Voxelity/voxelWorld/render/TransparentSorter.h"
+
+#include <algorithm>
+
+#include "Voxelity/voxelWorld/utils/DirectionUtils.h"
+
+namespace voxelity {
+    bool TransparentSorter::needsResort(const glm::vec3 &sortedFrom, const glm::vec3 &camera, const float distance) {
+        const glm::vec3 delta = camera - sortedFrom;
+        const float threshold = RESORT_DISTANCE + RESORT_RATIO * distance;
+        return glm::dot(delta, delta) > threshold * threshold;
+    }
+
+    glm::vec3 TransparentSorter::getFaceCenter(const FaceInstance &face) {
+        const glm::vec3 normal(DirectionUtils::getOffset(DirectionUtils::fromIndex(face.faceID)));
+        return glm::vec3(face.x, face.y, face.z) + 0.5f + normal * 0.5f;
+    }
+
+    void TransparentSorter::sortFaces(const std::span<FaceInstance> faces, const glm::vec3 &cameraLocal) {
+        m_faceKeys.clear();
+        m_faceKeys.reserve(faces.size());
+        for (const FaceInstance &face: faces) {
+            const glm::vec3 delta = getFaceCenter(face) - cameraLocal;
+            m_faceKeys.push_back({glm::dot(delta, delta), face.data});
+        }
+
+        // Tri stable : deux faces à la même distance gardent leur ordre d'un tri à l'autre
+        std::ranges::stable_sort(m_faceKeys, std::ranges::greater{}, &FaceKey::distance);
+
+        for (size_t i = 0; i < faces.size(); ++i)
+            faces[i].data = m_faceKeys[i].data;
+    }
+
+    glm::vec3 TransparentSorter::getChunkOrigin(const glm::ivec3 &position, const float chunkSpacing) {
+        return glm::vec3(position * VoxelArray::SIZE) * chunkSpacing;
+    }
+
+    void TransparentSorter::sortChunks(ash::Vector<const Chunk *> &chunks, const glm::vec3 &camera,
+                                       const float chunkSpacing) {
+        constexpr float HALF_CHUNK = VoxelArray::SIZE * 0.5f;
+
+        m_chunkKeys.clear();
+        m_chunkKeys.reserve(chunks.size());
+        for (const Chunk *chunk: chunks) {
+            const glm::ivec3 position = chunk->getPosition();
+            const glm::vec3 delta = getChunkOrigin(position, chunkSpacing) + HALF_CHUNK - camera;
+            m_chunkKeys.push_back({glm::dot(delta, delta), position, chunk});
+        }
+
+        std::ranges::sort(m_chunkKeys, [](const ChunkKey &a, const ChunkKey &b) {
+            if (a.distance != b.distance) return a.distance > b.distance;
+            if (a.position.x != b.position.x) return a.position.x < b.position.x;
+            if (a.position.y != b.position.y) return a.position.y < b.position.y;
+            return a.position.z < b.position.z;
+        });
+
+        for (size_t i = 0; i < chunks.size(); ++i)
+            chunks[i] = m_chunkKeys[i].chunk;
+    }
+}
@@ -1,6 +1,12 @@
 #include "Voxelity/voxelWorld/render/WorldRenderer.h"
+
+#include <chrono>
+
 #include "Ashen/GraphicsAPI/RenderCommand.h"
 
+#include "Voxelity/voxelWorld/lod/LodManager.h"
+#include "Voxelity/voxelWorld/render/ChunkInstanceBuffer.h"
+
 namespace voxelity {
     WorldRenderer::WorldRenderer(World &world, ash::Camera &camera, ash::ShaderProgram &shader)
         : m_world(world), m_camera(camera), m_shader(shader) {
@@ -64,6 +70,8 @@ namespace voxelity {
 
     void WorldRenderer::render() {
         setupMatrices();
+        collectVisibleChunks();
+        sortTransparentChunks();
         bindCommonResources();
         renderOpaquePass();
         renderTransparentPass();
@@ -75,6 +83,104 @@ namespace voxelity {
         m_viewProjection = proj * view;
     }
 
+    void WorldRenderer::collectVisibleChunks() {
+        const auto start = std::chrono::steady_clock::now();
+
+        m_drawList.clear();
+        m_candidates.clear();
+        m_candidateCoords.clear();
+        m_cullingStats = {};
+
+        const ChunkCoord cameraChunk = World::toChunkCoord(glm::ivec3(glm::floor(m_camera.GetPosition())));
+        const bool occlusion = m_occlusionCulling && m_occlusionCuller.update(
+                                   cameraChunk, [this](const ChunkCoord &coord) -> const ChunkVisibility * {
+                                       const Chunk *chunk = m_world.getChunk(coord);
+                                       return chunk ? &chunk->getVisibility() : nullptr;
+                                   });
+
+        updateDrawOrder(cameraChunk);
+
+        // Les chunks remplacés par un noeud LOD ne sont pas dessinés
+        const LodManager &lod = m_world.getLodManager();
+        for (const uint32_t index: m_drawOrder.getOrder()) {
+            const ChunkCoord coord = m_drawOrder.getCoord(index);
+            if (!lod.isChunkVisible(coord)) continue;
+
+            if (occlusion && !m_occlusionCuller.isVisible(coord)) {
+                ++m_cullingStats.occlusionCulledChunks;
+                continue;
+            }
+
+            m_candidates.push_back(m_orderedChunks[index]);
+            m_candidateCoords.push_back(coord);
+        }
+
+        if (m_frustumCulling) {
+            m_frustumCuller.cull(m_camera.GetViewFrustum(), m_candidateCoords, m_chunkSpacing, m_inFrustum);
+            m_cullingStats.frustumGroups = m_frustumCuller.getGroupCount();
+            m_cullingStats.frustumTestedChunks = m_frustumCuller.getBatchSize();
+            for (size_t i = 0; i < m_candidates.size(); ++i) {
+                if (m_inFrustum[i]) m_drawList.push_back(m_candidates[i]);
+            }
+        } else {
+            m_drawList = m_candidates;
+        }
+
+        m_cullingStats.drawnChunks = m_drawList.size();
+        m_cullingStats.frustumCulledChunks = m_candidates.size() - m_drawList.size();
+        m_cullingStats.cullingMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+    }
+
+    void WorldRenderer::updateDrawOrder(const ChunkCoord &cameraChunk) {
+        const uint64_t revision = m_world.getInstanceBuffer().getRevision();
+        if (m_orderValid && cameraChunk == m_orderCenter && revision == m_orderRevision) {
+            m_cullingStats.orderReused = true;
+            return;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+
+        // Seuls les chunks présents dans le buffer : leur sortie incrémente la révision, un
+        // pointeur de la liste ne survit donc pas au déchargement de son chunk
+        const ChunkInstanceBuffer &instanceBuffer = m_world.getInstanceBuffer();
+        m_orderedChunks.clear();
+        m_drawOrder.clear();
+        m_world.forEachChunk([&](const ChunkCoord &coord, const Chunk *chunk) {
+            if (!chunk || !instanceBuffer.contains(coord)) return;
+            m_orderedChunks.push_back(chunk);
+            m_drawOrder.add(coord);
+        });
+
+        m_drawOrder.sortFrontToBack(cameraChunk);
+        m_cullingStats.orderMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+
+        m_orderCenter = cameraChunk;
+        m_orderRevision = revision;
+        m_orderValid = true;
+    }
+
+    void WorldRenderer::sortTransparentChunks() {
+        const auto start = std::chrono::steady_clock::now();
+
+        ChunkInstanceBuffer &instanceBuffer = m_world.getInstanceBuffer();
+        m_transparentSortStats = {};
+        m_transparentList.clear();
+        for (const Chunk *chunk: m_drawList) {
+            if (instanceBuffer.hasTransparentFaces(ChunkCoord(chunk->getPosition())))
+                m_transparentList.push_back(chunk);
+        }
+
+        const glm::vec3 camera = m_camera.GetPosition();
+        m_transparentSorter.sortChunks(m_transparentList, camera, m_chunkSpacing);
+        instanceBuffer.sortTransparent(m_transparentList, camera, m_chunkSpacing, m_transparentSortStats);
+
+        m_transparentSortStats.chunks = m_transparentList.size();
+        m_transparentSortStats.sortMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+    }
+
     void WorldRenderer::bindCommonResources() const {
         m_shader.Bind();
         m_shader.SetMat4("u_ViewProjection", m_viewProjection);
@@ -93,9 +199,8 @@ namespace voxelity {
         ash::RenderCommand::SetDepthWrite(true);
         ash::RenderCommand::EnableBlending(false);
 
-        m_world.forEachChunk([&](const ChunkCoord &, const Chunk *chunk) {
-            if (chunk && chunk->hasMesh()) chunk->drawOpaque(m_shader);
-        });
+        renderChunks(m_drawList, false);
+        renderLodMeshes(false);
     }
 
     void WorldRenderer::renderTransparentPass() const {
@@ -103,11 +208,39 @@ namespace voxelity {
         ash::RenderCommand::SetBlendFunc(ash::BlendFactor::SrcAlpha, ash::BlendFactor::OneMinusSrcAlpha);
         ash::RenderCommand::SetDepthWrite(false);
 
-        m_world.forEachChunk([&](const ChunkCoord &, const Chunk *chunk) {
-            if (chunk && chunk->hasMesh()) chunk->drawTransparent(m_shader);
-        });
+        renderChunks(m_transparentList, true);
+        renderLodMeshes(true);
 
         ash::RenderCommand::SetDepthWrite(true);
         ash::RenderCommand::EnableBlending(false);
     }
-}
\ No newline at end of file
+
+    void WorldRenderer::renderChunks(const std::span<const Chunk *const> chunks, const bool transparent) const {
+        m_shader.SetBool("u_MultiDraw", true);
+        m_world.getInstanceBuffer().draw(chunks, transparent);
+        m_shader.SetBool("u_MultiDraw", false);
+    }
+
+    void WorldRenderer::renderLodMeshes(const bool transparent) const {
+        const LodManager &lod = m_world.getLodManager();
+        if (lod.getMeshCount() == 0) return;
+
+        const ash::Frustum &frustum = m_camera.GetViewFrustum();
+        lod.forEachMesh([&](const LodMesh &mesh) {
+            const ChunkMesh *chunkMesh = transparent ? mesh.transparentMesh.get() : mesh.opaqueMesh.get();
+            if (!chunkMesh) return;
+
+            const ChunkCoord &origin = mesh.node.origin;
+            const glm::vec3 chunkPos(origin.x, origin.y, origin.z);
+            const glm::vec3 min = chunkPos * static_cast<float>(VoxelArray::SIZE);
+            const glm::vec3 max = min + static_cast<float>(VoxelArray::SIZE * mesh.node.getSize());
+            if (m_frustumCulling && !frustum.IntersectsAABB(min, max)) return;
+
+            m_shader.SetVec3("u_ChunkPos", chunkPos * static_cast<float>(VoxelArray::SIZE));
+            m_shader.SetFloat("u_VoxelScale", static_cast<float>(mesh.node.getScale()));
+            chunkMesh->draw();
+        });
+
+        m_shader.SetFloat("u_VoxelScale", 1.0f);
+    }
+}
@@ -0,0 +1,103 @@
+#include "Voxelity/voxelWorld/storage/ChunkCodec.h"
+
+#include <cstring>
+
+namespace voxelity {
+    static_assert(sizeof(VoxelType) == 1, "ChunkCodec encode les voxels sur un octet");
+
+    ash::Vector<uint8_t> ChunkCodec::encode(const ChunkCoord &coord, const VoxelArray &voxels,
+                                            const FluidArray *fluid) {
+        ash::Vector<uint8_t> out;
+        out.reserve(256);
+
+        out.push_back(VERSION);
+        out.push_back(fluid ? FLAG_FLUID : 0);
+
+        const int32_t position[3] = {coord.x, coord.y, coord.z};
+        out.resize(HEADER_SIZE);
+        std::memcpy(out.data() + 2, position, sizeof(position));
+
+        appendRuns(out, voxels.data(), VoxelArray::VOLUME);
+        if (fluid)
+            appendRuns(out, fluid->data(), FluidArray::BYTE_SIZE);
+
+        const uint32_t checksum = computeChecksum(out);
+        std::memcpy(out.data() + CHECKSUM_OFFSET, &checksum, sizeof(checksum));
+        return out;
+    }
+
+    bool ChunkCodec::decode(const std::span<const uint8_t> bytes, ChunkCoord &coord, ChunkData &out) {
+        if (bytes.size() < HEADER_SIZE || bytes[0] != VERSION) return false;
+
+        uint32_t checksum;
+        std::memcpy(&checksum, bytes.data() + CHECKSUM_OFFSET, sizeof(checksum));
+        if (checksum != computeChecksum(bytes)) return false;
+
+        int32_t position[3];
+        std::memcpy(position, bytes.data() + 2, sizeof(position));
+        coord = {position[0], position[1], position[2]};
+
+        const uint8_t flags = bytes[1];
+        size_t cursor = HEADER_SIZE;
+
+        if (!readRuns(bytes, cursor, out.voxels.data(), VoxelArray::VOLUME)) return false;
+
+        out.fluid.reset();
+        if (flags & FLAG_FLUID) {
+            out.fluid = std::make_unique<FluidArray>();
+            if (!readRuns(bytes, cursor, out.fluid->data(), FluidArray::BYTE_SIZE)) return false;
+        }
+
+        return cursor == bytes.size();
+    }
+
+    uint32_t ChunkCodec::computeChecksum(const std::span<const uint8_t> bytes) {
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < bytes.size(); ++i) {
+            if (i - CHECKSUM_OFFSET < sizeof(uint32_t)) continue; // La somme elle-même
+            hash = (hash ^ bytes[i]) * 16777619u;
+        }
+        return hash;
+    }
+
+    void ChunkCodec::appendRuns(ash::Vector<uint8_t> &out, const uint8_t *values, const size_t count) {
+        size_t i = 0;
+        while (i < count) {
+            const uint8_t value = values[i];
+            size_t run = 1;
+            while (i + run < count && values[i + run] == value) ++run;
+
+            // Longueur en varint (7 bits par octet)
+            size_t length = run;
+            while (length >= 0x80) {
+                out.push_back(static_cast<uint8_t>(length | 0x80));
+                length >>= 7;
+            }
+            out.push_back(static_cast<uint8_t>(length));
+            out.push_back(value);
+
+            i += run;
+        }
+    }
+
+    bool ChunkCodec::readRuns(const std::span<const uint8_t> bytes, size_t &cursor, uint8_t *values,
+                              const size_t count) {
+        size_t i = 0;
+        while (i < count) {
+            size_t run = 0;
+            int shift = 0;
+            while (true) {
+                if (cursor >= bytes.size() || shift > 28) return false;
+                const uint8_t byte = bytes[cursor++];
+                run |= static_cast<size_t>(byte & 0x7F) << shift;
+                if (!(byte & 0x80)) break;
+                shift += 7;
+            }
+
+            if (cursor >= bytes.size() || run == 0 || run > count - i) return false;
+            std::memset(values + i, bytes[cursor++], run);
+            i += run;
+        }
+        return true;
+    }
+}
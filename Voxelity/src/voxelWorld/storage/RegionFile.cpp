@@ -0,0 +1,294 @@
+#include "Voxelity/voxelWorld/storage/RegionFile.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace voxelity {
+    RegionFile::RegionFile(const std::filesystem::path &path, const bool create)
+        : m_path(path) {
+#ifdef _WIN32
+        m_fd = _wopen(path.c_str(), _O_RDWR | _O_BINARY | (create ? _O_CREAT : 0), _S_IREAD | _S_IWRITE);
+#else
+        m_fd = ::open(path.c_str(), O_RDWR | (create ? O_CREAT : 0), 0644);
+#endif
+        if (m_fd < 0)
+            throw std::runtime_error("RegionFile: cannot open " + path.string());
+
+        try {
+            readHeader();
+        } catch (...) {
+#ifdef _WIN32
+            _close(m_fd);
+#else
+            ::close(m_fd);
+#endif
+            throw;
+        }
+    }
+
+    RegionFile::~RegionFile() {
+#ifdef _WIN32
+        _close(m_fd);
+#else
+        ::close(m_fd);
+#endif
+    }
+
+    bool RegionFile::read(const glm::ivec3 &localCoord, ash::Vector<uint8_t> &out) const {
+        std::shared_lock lock(m_mutex);
+
+        const Entry &entry = m_entries[toIndex(localCoord)];
+        if (entry.sector == 0) return false;
+
+        out.resize(entry.length);
+        return readAt(static_cast<uint64_t>(entry.sector) * SECTOR_SIZE, out.data(), entry.length);
+    }
+
+    void RegionFile::write(const glm::ivec3 &localCoord, const std::span<const uint8_t> data) {
+        const ChunkWrite chunk{localCoord, data};
+        write(std::span(&chunk, 1));
+    }
+
+    void RegionFile::write(const std::span<const ChunkWrite> chunks) {
+        for (const ChunkWrite &chunk: chunks) {
+            if (chunk.data.empty())
+                throw std::invalid_argument("RegionFile: empty chunk data");
+        }
+
+        std::unique_lock lock(m_mutex);
+
+        ash::Vector<Entry> written;
+        written.reserve(chunks.size());
+        const auto discard = [&] {
+            for (const Entry &entry: written) markSectors(entry, false);
+        };
+
+        // Nouveaux secteurs, complétés par des zéros : le fichier reste aligné.
+        // Un secteur réutilisé contient encore l'encodage complet d'un autre chunk : la table ne doit
+        // le désigner qu'une fois les nouvelles données sur le support, sinon une coupure laisserait
+        // un chunk valide au mauvais endroit. Seuls les secteurs ajoutés en fin de fichier s'en passent
+        bool replacing = false;
+        bool reusing = false;
+        ash::Vector<uint8_t> buffer;
+        for (const ChunkWrite &chunk: chunks) {
+            const auto length = static_cast<uint32_t>(chunk.data.size());
+            const uint32_t count = getSectorCount(length);
+            const auto fileSectors = static_cast<uint32_t>(m_usedSectors.size());
+            const uint32_t sector = allocateSectors(count);
+            written.push_back({sector, length});
+
+            buffer.assign(static_cast<size_t>(count) * SECTOR_SIZE, 0);
+            std::memcpy(buffer.data(), chunk.data.data(), chunk.data.size());
+            if (!writeAt(static_cast<uint64_t>(sector) * SECTOR_SIZE, buffer.data(), buffer.size())) {
+                discard();
+                throw std::runtime_error("RegionFile: write failed in " + m_path.string());
+            }
+            replacing |= m_entries[toIndex(chunk.localCoord)].sector != 0;
+            reusing |= sector < fileSectors;
+        }
+
+        // Une version existante, elle, ne doit être abandonnée qu'une fois la nouvelle sur le support
+        if (replacing || reusing) {
+            try {
+                syncLocked();
+            } catch (...) {
+                discard();
+                throw;
+            }
+        }
+
+        // Bascule des entrées une fois les données écrites
+        ash::Vector<Entry> previous;
+        previous.reserve(chunks.size());
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            const int index = toIndex(chunks[i].localCoord);
+            previous.push_back(m_entries[index]);
+            m_entries[index] = written[i];
+            if (writeEntry(index)) continue;
+
+            // Retour aux anciennes entrées. La table sur le support peut déjà désigner les nouveaux
+            // secteurs des chunks basculés : ils ne sont libérés que si elle a pu être restaurée
+            bool restored = true;
+            for (size_t j = previous.size(); j-- > 0;) {
+                const int switched = toIndex(chunks[j].localCoord);
+                m_entries[switched] = previous[j];
+                restored &= writeEntry(switched);
+            }
+            for (size_t j = restored ? 0 : previous.size(); j < written.size(); ++j)
+                markSectors(written[j], false);
+            throw std::runtime_error("RegionFile: header update failed in " + m_path.string());
+        }
+
+        // Les anciens secteurs ne sont réutilisables qu'une fois la table sur le support
+        if (replacing) syncLocked();
+        for (const Entry &entry: previous)
+            markSectors(entry, false);
+    }
+
+    bool RegionFile::contains(const glm::ivec3 &localCoord) const {
+        std::shared_lock lock(m_mutex);
+        return m_entries[toIndex(localCoord)].sector != 0;
+    }
+
+    void RegionFile::sync() const {
+        std::unique_lock lock(m_mutex);
+        syncLocked();
+    }
+
+    void RegionFile::readHeader() {
+#ifdef _WIN32
+        const uint64_t fileSize = static_cast<uint64_t>(_lseeki64(m_fd, 0, SEEK_END));
+#else
+        const uint64_t fileSize = static_cast<uint64_t>(::lseek(m_fd, 0, SEEK_END));
+#endif
+
+        if (fileSize < HEADER_SIZE) {
+            writeHeader();
+            return;
+        }
+
+        uint32_t header[2];
+        if (!readAt(0, header, sizeof(header)) || !readAt(sizeof(header), m_entries.data(), sizeof(m_entries)))
+            throw std::runtime_error("RegionFile: cannot read header of " + m_path.string());
+        if (header[0] != MAGIC || header[1] != VERSION)
+            throw std::runtime_error("RegionFile: invalid header in " + m_path.string());
+
+        const auto fileSectors = static_cast<uint32_t>((fileSize + SECTOR_SIZE - 1) / SECTOR_SIZE);
+        m_usedSectors.assign(std::max(fileSectors, HEADER_SECTORS), false);
+        std::fill_n(m_usedSectors.begin(), HEADER_SECTORS, true);
+
+        // Entrées hors du fichier (écriture interrompue) : chunk considéré comme absent
+        for (auto &entry: m_entries) {
+            if (entry.sector == 0) continue;
+
+            const uint64_t end = static_cast<uint64_t>(entry.sector) + getSectorCount(entry.length);
+            if (entry.sector < HEADER_SECTORS || entry.length == 0 || end > fileSectors) {
+                entry = {};
+                continue;
+            }
+            markSectors(entry, true);
+        }
+    }
+
+    void RegionFile::writeHeader() {
+        m_entries.fill({});
+        m_usedSectors.assign(HEADER_SECTORS, true);
+
+        ash::Vector<uint8_t> header(static_cast<size_t>(HEADER_SECTORS) * SECTOR_SIZE, 0);
+        const uint32_t prefix[2] = {MAGIC, VERSION};
+        std::memcpy(header.data(), prefix, sizeof(prefix));
+
+        if (!writeAt(0, header.data(), header.size()))
+            throw std::runtime_error("RegionFile: cannot write header of " + m_path.string());
+    }
+
+    uint32_t RegionFile::allocateSectors(const uint32_t count) {
+        // Premier intervalle libre suffisant, sinon ajout en fin de fichier
+        uint32_t start = HEADER_SECTORS;
+        uint32_t run = 0;
+        for (uint32_t sector = HEADER_SECTORS; sector < m_usedSectors.size(); ++sector) {
+            if (m_usedSectors[sector]) {
+                run = 0;
+                start = sector + 1;
+                continue;
+            }
+            if (++run == count) break;
+        }
+
+        if (run < count) {
+            start = static_cast<uint32_t>(m_usedSectors.size()) - run;
+            m_usedSectors.resize(start + count, false);
+        }
+
+        std::fill_n(m_usedSectors.begin() + start, count, true);
+        return start;
+    }
+
+    void RegionFile::markSectors(const Entry &entry, const bool used) {
+        if (entry.sector == 0) return;
+
+        const uint32_t end = std::min<uint32_t>(entry.sector + getSectorCount(entry.length),
+                                                static_cast<uint32_t>(m_usedSectors.size()));
+        for (uint32_t sector = entry.sector; sector < end; ++sector)
+            m_usedSectors[sector] = used;
+    }
+
+    bool RegionFile::writeEntry(const int index) const {
+        const uint64_t offset = 2 * sizeof(uint32_t) + static_cast<uint64_t>(index) * sizeof(Entry);
+        return writeAt(offset, &m_entries[index], sizeof(Entry));
+    }
+
+    void RegionFile::syncLocked() const {
+#ifdef _WIN32
+        const int result = _commit(m_fd);
+#else
+        const int result = ::fsync(m_fd);
+#endif
+        if (result != 0)
+            throw std::runtime_error("RegionFile: sync failed for " + m_path.string());
+    }
+
+    uint32_t RegionFile::getSectorCount(const uint32_t length) {
+        return static_cast<uint32_t>((length + SECTOR_SIZE - 1) / SECTOR_SIZE);
+    }
+
+    int RegionFile::toIndex(const glm::ivec3 &localCoord) {
+        if (localCoord.x < 0 || localCoord.x >= SIZE || localCoord.y < 0 || localCoord.y >= SIZE ||
+            localCoord.z < 0 || localCoord.z >= SIZE)
+            throw std::out_of_range("RegionFile: chunk outside region");
+
+        return localCoord.x + SIZE * (localCoord.z + SIZE * localCoord.y);
+    }
+
+    bool RegionFile::readAt(const uint64_t offset, void *buffer, const size_t size) const {
+#ifdef _WIN32
+        OVERLAPPED overlapped{};
+        overlapped.Offset = static_cast<DWORD>(offset);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        DWORD bytesRead = 0;
+        const auto handle = reinterpret_cast<HANDLE>(_get_osfhandle(m_fd));
+        return ReadFile(handle, buffer, static_cast<DWORD>(size), &bytesRead, &overlapped) && bytesRead == size;
+#else
+        auto *bytes = static_cast<uint8_t *>(buffer);
+        size_t done = 0;
+        while (done < size) {
+            const ssize_t result = ::pread(m_fd, bytes + done, size - done, static_cast<off_t>(offset + done));
+            if (result <= 0) return false;
+            done += static_cast<size_t>(result);
+        }
+        return true;
+#endif
+    }
+
+    bool RegionFile::writeAt(const uint64_t offset, const void *buffer, const size_t size) const {
+#ifdef _WIN32
+        OVERLAPPED overlapped{};
+        overlapped.Offset = static_cast<DWORD>(offset);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        DWORD bytesWritten = 0;
+        const auto handle = reinterpret_cast<HANDLE>(_get_osfhandle(m_fd));
+        return WriteFile(handle, buffer, static_cast<DWORD>(size), &bytesWritten, &overlapped) && bytesWritten == size;
+#else
+        const auto *bytes = static_cast<const uint8_t *>(buffer);
+        size_t done = 0;
+        while (done < size) {
+            const ssize_t result = ::pwrite(m_fd, bytes + done, size - done, static_cast<off_t>(offset + done));
+            if (result <= 0) return false;
+            done += static_cast<size_t>(result);
+        }
+        return true;
+#endif
+    }
+}
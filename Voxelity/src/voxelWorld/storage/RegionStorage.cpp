@@ -0,0 +1,194 @@
+#include "Voxelity/voxelWorld/storage/RegionStorage.h"
+
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "Ashen/Core/Logger.h"
+
+#include "Voxelity/voxelWorld/storage/ChunkCodec.h"
+#include "Voxelity/voxelWorld/storage/RegionFile.h"
+
+namespace voxelity {
+    namespace {
+        // Rend le renommage durable ; sous Windows, MoveFileEx l'écrit déjà dans le journal NTFS
+        void syncDirectory(const std::filesystem::path &directory) {
+#ifndef _WIN32
+            const int fd = ::open(directory.c_str(), O_RDONLY);
+            if (fd < 0 || ::fsync(fd) != 0)
+                ash::Logger::Warn() << "RegionStorage: cannot sync " << directory.string();
+            if (fd >= 0) ::close(fd);
+#else
+            (void) directory;
+#endif
+        }
+    }
+
+    RegionStorage::RegionStorage(std::filesystem::path directory, const size_t maxOpenRegions)
+        : m_directory(std::move(directory)), m_maxOpenRegions(maxOpenRegions) {
+        std::error_code error;
+        std::filesystem::create_directories(m_directory, error);
+        if (error)
+            ash::Logger::Error() << "RegionStorage: cannot create " << m_directory.string() << ": " << error.message();
+    }
+
+    RegionStorage::~RegionStorage() = default;
+
+    bool RegionStorage::loadChunk(const ChunkCoord &coord, ChunkData &out) {
+        const ash::Ref<RegionFile> region = getRegion(toRegionCoord(coord), false);
+        if (!region) return false;
+
+        ash::Vector<uint8_t> bytes;
+        if (!region->read(toLocalCoord(coord), bytes)) return false;
+
+        ChunkCoord stored{0, 0, 0};
+        if (!ChunkCodec::decode(bytes, stored, out)) {
+            ash::Logger::Warn() << "RegionStorage: corrupted chunk (" << coord.x << ", " << coord.y << ", "
+                    << coord.z << "), regenerating";
+            return false;
+        }
+
+        // Secteurs d'un autre chunk désignés par la table (écriture interrompue)
+        if (stored != coord) {
+            ash::Logger::Warn() << "RegionStorage: chunk (" << coord.x << ", " << coord.y << ", " << coord.z
+                    << ") holds the data of (" << stored.x << ", " << stored.y << ", " << stored.z
+                    << "), regenerating";
+            return false;
+        }
+        return true;
+    }
+
+    bool RegionStorage::writeChunks(const std::span<const EncodedChunk> chunks, const bool rewrite,
+                                    const std::function<bool(const ChunkCoord &)> &filter) {
+        if (chunks.empty()) return true;
+
+        std::lock_guard writeLock(m_writeMutex);
+
+        ash::Vector<const EncodedChunk *> accepted;
+        for (const auto &chunk: chunks) {
+            if (!filter || filter(chunk.coord)) accepted.push_back(&chunk);
+        }
+        if (accepted.empty()) return true;
+
+        const ChunkCoord regionCoord = toRegionCoord(accepted.front()->coord);
+        if (rewrite)
+            return rewriteRegion(regionCoord, accepted);
+
+        const ash::Ref<RegionFile> region = getRegion(regionCoord, true);
+        if (!region) return false;
+
+        ash::Vector<RegionFile::ChunkWrite> writes;
+        writes.reserve(accepted.size());
+        for (const EncodedChunk *chunk: accepted)
+            writes.push_back({toLocalCoord(chunk->coord), chunk->bytes});
+
+        try {
+            region->write(writes);
+        } catch (const std::exception &e) {
+            ash::Logger::Error() << e.what();
+            return false;
+        }
+        return true;
+    }
+
+    ChunkCoord RegionStorage::toRegionCoord(const ChunkCoord &coord) {
+        return {coord.x >> RegionFile::SHIFT, coord.y >> RegionFile::SHIFT, coord.z >> RegionFile::SHIFT};
+    }
+
+    ash::Ref<RegionFile> RegionStorage::getRegion(const ChunkCoord &regionCoord, const bool create) {
+        std::lock_guard lock(m_mutex);
+
+        const auto it = m_regions.find(regionCoord);
+        if (it != m_regions.end())
+            return it->second;
+
+        const std::filesystem::path path = getRegionPath(regionCoord);
+        if (!create && !std::filesystem::exists(path))
+            return nullptr;
+
+        // Fermer les régions inutilisées avant d'en ouvrir une nouvelle
+        if (m_regions.size() >= m_maxOpenRegions) {
+            std::erase_if(m_regions, [](const auto &entry) {
+                return entry.second.use_count() == 1;
+            });
+        }
+
+        try {
+            auto region = std::make_shared<RegionFile>(path, create);
+            m_regions.emplace(regionCoord, region);
+            return region;
+        } catch (const std::exception &e) {
+            ash::Logger::Error() << e.what();
+            return nullptr;
+        }
+    }
+
+    bool RegionStorage::rewriteRegion(const ChunkCoord &regionCoord,
+                                      const std::span<const EncodedChunk *const> chunks) {
+        const std::filesystem::path path = getRegionPath(regionCoord);
+        std::filesystem::path temporary = path;
+        temporary += ".tmp";
+
+        try {
+            std::filesystem::remove(temporary);
+            ash::Ref<RegionFile> current = getRegion(regionCoord, false);
+            {
+                RegionFile output(temporary, true);
+
+                // Nouvelles versions, puis chunks inchangés recopiés depuis la région actuelle
+                std::array<bool, RegionFile::CHUNK_COUNT> replaced{};
+                for (const EncodedChunk *chunk: chunks) {
+                    const glm::ivec3 local = toLocalCoord(chunk->coord);
+                    output.write(local, chunk->bytes);
+                    replaced[local.x + RegionFile::SIZE * (local.z + RegionFile::SIZE * local.y)] = true;
+                }
+
+                if (current) {
+                    ash::Vector<uint8_t> bytes;
+                    for (int y = 0; y < RegionFile::SIZE; ++y) {
+                        for (int z = 0; z < RegionFile::SIZE; ++z) {
+                            for (int x = 0; x < RegionFile::SIZE; ++x) {
+                                if (replaced[x + RegionFile::SIZE * (z + RegionFile::SIZE * y)]) continue;
+                                if (current->read({x, y, z}, bytes))
+                                    output.write({x, y, z}, bytes);
+                            }
+                        }
+                    }
+                }
+
+                output.sync();
+            }
+
+            // Windows refuse de remplacer un fichier ouvert : la région est retirée du cache et
+            // fermée avant le renommage. m_mutex reste pris pour qu'aucune lecture ne la rouvre,
+            // les lectures déjà lancées ne font que la terminer
+            std::lock_guard lock(m_mutex);
+            m_regions.erase(regionCoord);
+            while (current && current.use_count() > 1)
+                std::this_thread::yield();
+            current.reset();
+
+            std::filesystem::rename(temporary, path);
+        } catch (const std::exception &e) {
+            ash::Logger::Error() << "RegionStorage: save of " << path.string() << " failed: " << e.what();
+            std::error_code error;
+            std::filesystem::remove(temporary, error);
+            return false;
+        }
+
+        syncDirectory(m_directory);
+        return true;
+    }
+
+    glm::ivec3 RegionStorage::toLocalCoord(const ChunkCoord &coord) {
+        return {coord.x & RegionFile::MASK, coord.y & RegionFile::MASK, coord.z & RegionFile::MASK};
+    }
+
+    std::filesystem::path RegionStorage::getRegionPath(const ChunkCoord &regionCoord) const {
+        return m_directory / ("r." + std::to_string(regionCoord.x) + "." + std::to_string(regionCoord.y) + "." +
+                              std::to_string(regionCoord.z) + ".vxr");
+    }
+}
@@ -0,0 +1,99 @@
+#include "Voxelity/voxelWorld/tick/BlockBehavior.h"
+
+namespace voxelity {
+    namespace {
+        constexpr uint32_t FALLING_BLOCK_DELAY = 2;
+
+        bool canFallInto(const VoxelType voxel) {
+            return isVoxelAir(voxel) || isVoxelLiquid(voxel);
+        }
+
+        // Sable, gravier : tombent dès que le support disparaît
+        BlockBehavior makeFallingBlockBehavior() {
+            BlockBehavior behavior;
+            behavior.onNeighborUpdate = [](TickContext &context, const glm::ivec3 &pos, VoxelType) {
+                context.scheduleTick(pos, FALLING_BLOCK_DELAY);
+            };
+            behavior.onScheduledTick = [](TickContext &context, const glm::ivec3 &pos, const VoxelType voxel) {
+                if (!canFallInto(context.getVoxel(pos + glm::ivec3(0, -1, 0)))) return;
+
+                context.setVoxel(pos, VoxelID::AIR);
+                context.spawnFallingBlock(pos, voxel);
+            };
+            return behavior;
+        }
+
+        // Herbe : disparaît sous un bloc opaque, s'étend sur la terre voisine éclairée
+        BlockBehavior makeGrassBehavior() {
+            BlockBehavior behavior;
+            behavior.onRandomTick = [](TickContext &context, const glm::ivec3 &pos, VoxelType) {
+                if (isVoxelOpaque(context.getVoxel(pos + glm::ivec3(0, 1, 0)))) {
+                    context.setVoxel(pos, VoxelID::DIRT);
+                    return;
+                }
+
+                ash::FastRandom &random = context.getRandom();
+                const glm::ivec3 target = pos + glm::ivec3(
+                                              static_cast<int>(random.NextBelow(3)) - 1,
+                                              static_cast<int>(random.NextBelow(3)) - 1,
+                                              static_cast<int>(random.NextBelow(3)) - 1);
+
+                if (context.getVoxel(target) == VoxelID::DIRT &&
+                    isVoxelAir(context.getVoxel(target + glm::ivec3(0, 1, 0))))
+                    context.setVoxel(target, VoxelID::GRASS);
+            };
+            return behavior;
+        }
+    }
+
+    TickContext::TickContext(const World &world, const uint64_t currentTick, const uint64_t seed)
+        : m_voxels(world), m_currentTick(currentTick), m_random(seed) {
+    }
+
+    void TickContext::setVoxel(const glm::ivec3 &pos, const VoxelType type) {
+        edits.push_back({pos, type});
+    }
+
+    void TickContext::scheduleTick(const glm::ivec3 &pos, const uint32_t delay) {
+        scheduledTicks.push_back({pos, delay});
+    }
+
+    void TickContext::spawnFallingBlock(const glm::ivec3 &pos, const VoxelType type) {
+        fallingBlocks.push_back({pos, type});
+    }
+
+    BlockBehaviorRegistry *BlockBehaviorRegistry::instance = nullptr;
+
+    BlockBehaviorRegistry::BlockBehaviorRegistry() {
+        resetToDefaults();
+    }
+
+    BlockBehaviorRegistry &BlockBehaviorRegistry::getInstance() {
+        if (instance == nullptr) {
+            instance = new BlockBehaviorRegistry();
+        }
+        return *instance;
+    }
+
+    const BlockBehavior &BlockBehaviorRegistry::getBehavior(const VoxelType voxelID) const noexcept {
+        return registry[voxelID];
+    }
+
+    void BlockBehaviorRegistry::setBehavior(const VoxelType voxelID, const BlockBehavior &behavior) noexcept {
+        registry[voxelID] = behavior;
+    }
+
+    void BlockBehaviorRegistry::resetToDefaults() noexcept {
+        for (auto &behavior: registry) {
+            behavior = BlockBehavior{};
+        }
+
+        registry[VoxelID::SAND] = makeFallingBlockBehavior();
+        registry[VoxelID::GRAVEL] = makeFallingBlockBehavior();
+        registry[VoxelID::GRASS] = makeGrassBehavior();
+    }
+
+    const BlockBehavior &getBlockBehavior(const VoxelType voxelID) noexcept {
+        return BlockBehaviorRegistry::getInstance().getBehavior(voxelID);
+    }
+}
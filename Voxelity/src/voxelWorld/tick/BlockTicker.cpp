@@ -0,0 +1,195 @@
+#include "Voxelity/voxelWorld/tick/BlockTicker.h"
+
+#include "Ashen/Core/JobSystem.h"
+
+#include "Voxelity/voxelWorld/tick/BlockBehavior.h"
+#include "Voxelity/voxelWorld/world/World.h"
+
+namespace voxelity {
+    namespace {
+        constexpr int PARITY_GROUPS = 8;
+
+        int getParityGroup(const ChunkCoord &coord) {
+            return (coord.x & 1) | (coord.y & 1) << 1 | (coord.z & 1) << 2;
+        }
+    }
+
+    BlockTicker::BlockTicker(World &world)
+        : m_world(world) {
+    }
+
+    void BlockTicker::scheduleTick(const glm::ivec3 &worldPos, const uint32_t delay) {
+        ChunkTickQueue &queue = m_queues[World::toChunkCoord(worldPos)];
+
+        const uint16_t index = toIndex(World::toLocalCoord(worldPos));
+        if (!queue.scheduledSet.insert(index).second) return;
+
+        queue.scheduled.push({m_currentTick + std::max<uint32_t>(delay, 1), m_order++, index});
+    }
+
+    void BlockTicker::notifyNeighbors(const glm::ivec3 &worldPos) {
+        static const glm::ivec3 OFFSETS[7] = {
+            {0, 0, 0}, {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}
+        };
+
+        for (const auto &offset: OFFSETS) {
+            const glm::ivec3 pos = worldPos + offset;
+            if (getBlockBehavior(m_world.getVoxel(pos)).onNeighborUpdate)
+                queueNeighborUpdate(pos);
+        }
+    }
+
+    void BlockTicker::notifyRegion(const ash::BBox3i &box) {
+        const ash::BBox3i region{box.min - 1, box.max + 1};
+        const size_t volume = World::getRegionVolume(region);
+        if (volume == 0) return;
+
+        m_regionBuffer.resize(volume);
+        m_world.copyRegion(region, m_regionBuffer);
+
+        // Même disposition que copyRegion : X contigu, puis Z, puis Y
+        const glm::ivec3 size = region.max - region.min + 1;
+        size_t index = 0;
+        for (int y = 0; y < size.y; ++y) {
+            for (int z = 0; z < size.z; ++z) {
+                for (int x = 0; x < size.x; ++x, ++index) {
+                    if (getBlockBehavior(m_regionBuffer[index]).onNeighborUpdate)
+                        queueNeighborUpdate(region.min + glm::ivec3(x, y, z));
+                }
+            }
+        }
+    }
+
+    void BlockTicker::queueNeighborUpdate(const glm::ivec3 &worldPos) {
+        ChunkTickQueue &queue = m_queues[World::toChunkCoord(worldPos)];
+        const uint16_t index = toIndex(World::toLocalCoord(worldPos));
+        if (queue.neighborSet.insert(index).second)
+            queue.neighborUpdates.push_back(index);
+    }
+
+    void BlockTicker::tick() {
+        ++m_currentTick;
+
+        // Chunks à traiter : tous les chunks chargés (ticks aléatoires) répartis par parité
+        std::array<ash::Vector<ChunkCoord>, PARITY_GROUPS> groups;
+        m_world.forEachChunk([&](const ChunkCoord &coord, Chunk *) {
+            groups[getParityGroup(coord)].push_back(coord);
+        });
+
+        // Files des chunks déchargés
+        ash::Vector<ChunkCoord> orphans;
+        for (const auto &[coord, queue]: m_queues) {
+            if (!m_world.getChunk(coord)) orphans.push_back(coord);
+        }
+        for (const auto &coord: orphans)
+            m_queues.erase(coord);
+
+        for (const auto &group: groups) {
+            if (group.empty()) continue;
+
+            // Pointeurs repris à chaque groupe : l'application des résultats peut réallouer la table
+            ash::Vector<ChunkTickQueue *> queues(group.size(), nullptr);
+            for (size_t i = 0; i < group.size(); ++i) {
+                const auto it = m_queues.find(group[i]);
+                if (it != m_queues.end()) queues[i] = &it->second;
+            }
+
+            ash::Vector<TickContext> contexts;
+            contexts.reserve(group.size());
+            for (const auto &coord: group)
+                contexts.emplace_back(m_world, m_currentTick, ash::HashCoord3(coord.x, coord.y, coord.z) ^ m_currentTick);
+
+            ash::JobSystem::Get().ParallelFor(group.size(), [&](const size_t i) {
+                processChunk(group[i], queues[i], contexts[i]);
+            }, 4);
+
+            applyResults(contexts);
+        }
+    }
+
+    size_t BlockTicker::getPendingTickCount() const {
+        size_t count = 0;
+        for (const auto &[coord, queue]: m_queues)
+            count += queue.scheduled.size() + queue.neighborUpdates.size();
+        return count;
+    }
+
+    void BlockTicker::clear() {
+        m_queues.clear();
+    }
+
+    void BlockTicker::processChunk(const ChunkCoord &coord, ChunkTickQueue *queue, TickContext &context) const {
+        const Chunk *chunk = m_world.getChunk(coord);
+        if (!chunk) return;
+
+        const glm::ivec3 origin = World::toWorldPos({coord.x, coord.y, coord.z});
+
+        if (queue) {
+            // Notifications de voisinage
+            const ash::Vector<uint16_t> neighborUpdates = std::move(queue->neighborUpdates);
+            queue->neighborUpdates.clear();
+            queue->neighborSet.clear();
+
+            for (const uint16_t index: neighborUpdates) {
+                const glm::ivec3 local = toLocalPos(index);
+                const VoxelType voxel = chunk->get(local);
+                if (const auto &handler = getBlockBehavior(voxel).onNeighborUpdate)
+                    handler(context, origin + local, voxel);
+            }
+
+            // Ticks programmés arrivés à échéance
+            while (!queue->scheduled.empty() && queue->scheduled.top().tick <= m_currentTick) {
+                const uint16_t index = queue->scheduled.top().index;
+                queue->scheduled.pop();
+                queue->scheduledSet.erase(index);
+
+                const glm::ivec3 local = toLocalPos(index);
+                const VoxelType voxel = chunk->get(local);
+                if (const auto &handler = getBlockBehavior(voxel).onScheduledTick)
+                    handler(context, origin + local, voxel);
+            }
+        }
+
+        // Ticks aléatoires
+        ash::FastRandom &random = context.getRandom();
+        for (int i = 0; i < m_randomTickSpeed; ++i) {
+            const auto index = static_cast<uint16_t>(random.NextBelow(VoxelArray::VOLUME));
+            const glm::ivec3 local = toLocalPos(index);
+            const VoxelType voxel = chunk->get(local);
+            if (const auto &handler = getBlockBehavior(voxel).onRandomTick)
+                handler(context, origin + local, voxel);
+        }
+    }
+
+    void BlockTicker::applyResults(ash::Vector<TickContext> &contexts) {
+        ash::Vector<VoxelEdit> edits;
+        for (auto &context: contexts)
+            edits.insert(edits.end(), context.edits.begin(), context.edits.end());
+
+        // Une seule passe d'écriture : un remesh par chunk touché
+        if (!edits.empty())
+            m_world.setVoxels(edits);
+
+        for (auto &context: contexts) {
+            for (const auto &[position, delay]: context.scheduledTicks)
+                scheduleTick(position, delay);
+
+            if (m_fallingBlockSpawner) {
+                for (const auto &[position, type]: context.fallingBlocks)
+                    m_fallingBlockSpawner(position, type);
+            }
+        }
+    }
+
+    uint16_t BlockTicker::toIndex(const glm::ivec3 &localPos) {
+        return static_cast<uint16_t>(localPos.x + VoxelArray::SIZE * (localPos.z + VoxelArray::SIZE * localPos.y));
+    }
+
+    glm::ivec3 BlockTicker::toLocalPos(const uint16_t index) {
+        return {
+            index & VoxelArray::MASK,
+            index >> (2 * VoxelArray::SHIFT),
+            index >> VoxelArray::SHIFT & VoxelArray::MASK
+        };
+    }
+}
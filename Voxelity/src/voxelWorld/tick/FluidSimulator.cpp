@@ -0,0 +1,233 @@
+#include "Voxelity/voxelWorld/tick/FluidSimulator.h"
+
+#include <algorithm>
+
+#include "Ashen/Core/JobSystem.h"
+
+#include "Voxelity/voxelWorld/world/VoxelAccessor.h"
+#include "Voxelity/voxelWorld/world/World.h"
+
+namespace voxelity {
+    namespace {
+        const glm::ivec3 UP{0, 1, 0};
+        const glm::ivec3 DOWN{0, -1, 0};
+
+        const glm::ivec3 HORIZONTAL[4] = {{1, 0, 0}, {-1, 0, 0}, {0, 0, 1}, {0, 0, -1}};
+
+        const glm::ivec3 SELF_AND_NEIGHBORS[7] = {
+            {0, 0, 0}, {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}
+        };
+
+        uint16_t toIndex(const glm::ivec3 &localPos) {
+            return static_cast<uint16_t>(localPos.x + VoxelArray::SIZE * (localPos.z + VoxelArray::SIZE * localPos.y));
+        }
+
+        glm::ivec3 toLocalPos(const uint16_t index) {
+            return {
+                index & VoxelArray::MASK,
+                index >> (2 * VoxelArray::SHIFT),
+                index >> VoxelArray::SHIFT & VoxelArray::MASK
+            };
+        }
+    }
+
+    FluidSimulator::FluidSimulator(World &world)
+        : m_world(world) {
+        m_channels.push_back({{VoxelID::WATER, 7, 5, true}, {}});
+        m_channels.push_back({{VoxelID::LAVA, 3, 30, false}, {}});
+    }
+
+    void FluidSimulator::activate(const glm::ivec3 &worldPos) {
+        // Le type de liquide qui pourrait arriver ici n'est pas connu : tous les canaux sont prévenus
+        for (auto &channel: m_channels) {
+            for (const auto &offset: SELF_AND_NEIGHBORS)
+                activateCell(channel, worldPos + offset);
+        }
+    }
+
+    void FluidSimulator::activateBox(const ash::BBox3i &box) {
+        const glm::ivec3 min = box.min - 1;
+        const glm::ivec3 max = box.max + 1;
+        const ash::IVec3 minChunk = World::toChunkCoord(min);
+        const ash::IVec3 maxChunk = World::toChunkCoord(max);
+
+        for (int cy = minChunk.y; cy <= maxChunk.y; ++cy) {
+            for (int cz = minChunk.z; cz <= maxChunk.z; ++cz) {
+                for (int cx = minChunk.x; cx <= maxChunk.x; ++cx) {
+                    const Chunk *chunk = m_world.getChunk(cx, cy, cz);
+                    if (!chunk) continue;
+
+                    const ash::IVec3 origin = World::toWorldPos({cx, cy, cz});
+                    const ash::IVec3 localMin = glm::max(min - origin, ash::IVec3(0));
+                    const ash::IVec3 localMax = glm::min(max - origin, ash::IVec3(VoxelArray::SIZE - 1));
+
+                    // Seuls les liquides sont activés : ils s'étendent d'eux-mêmes vers les cellules libres
+                    for (int y = localMin.y; y <= localMax.y; ++y) {
+                        for (int z = localMin.z; z <= localMax.z; ++z) {
+                            for (int x = localMin.x; x <= localMax.x; ++x) {
+                                if (FluidChannel *channel = findChannel(chunk->get(x, y, z)))
+                                    activateCell(*channel, origin + glm::ivec3(x, y, z));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void FluidSimulator::tick() {
+        ++m_currentTick;
+        m_lastChangeCount = 0;
+
+        for (auto &channel: m_channels) {
+            if (m_currentTick % channel.properties.tickInterval == 0)
+                step(channel);
+        }
+    }
+
+    size_t FluidSimulator::getActiveCellCount() const {
+        size_t count = 0;
+        for (const auto &channel: m_channels) {
+            for (const auto &[coord, cells]: channel.active)
+                count += cells.size();
+        }
+        return count;
+    }
+
+    void FluidSimulator::clear() {
+        for (auto &channel: m_channels)
+            channel.active.clear();
+    }
+
+    void FluidSimulator::step(FluidChannel &channel) {
+        // Les activations produites par ce pas alimentent le suivant
+        ash::FlatHashMap<ChunkCoord, ash::FlatHashSet<uint16_t> > active;
+        std::swap(active, channel.active);
+
+        struct ChunkJob {
+            ChunkCoord coord;
+            const ash::FlatHashSet<uint16_t> *cells;
+        };
+
+        // Cellules des chunks déchargés abandonnées
+        ash::Vector<ChunkJob> jobs;
+        for (const auto &[coord, cells]: active) {
+            if (m_world.getChunk(coord)) jobs.push_back({coord, &cells});
+        }
+        if (jobs.empty()) return;
+
+        // Évaluation parallèle : lecture seule du monde, le thread principal attend
+        ash::Vector<StepOutput> outputs(jobs.size());
+        ash::JobSystem::Get().ParallelFor(jobs.size(), [&](const size_t i) {
+            VoxelAccessor voxels(m_world);
+            const glm::ivec3 origin = World::toWorldPos({jobs[i].coord.x, jobs[i].coord.y, jobs[i].coord.z});
+            for (const uint16_t index: *jobs[i].cells)
+                evaluateCell(channel.properties, voxels, origin + toLocalPos(index), outputs[i]);
+        });
+
+        // Toutes les modifications du pas en un seul lot : un remesh et une notification par chunk
+        // touché ; les cellules à réévaluer sont déjà dans les activations du pas
+        ash::Vector<VoxelEdit> edits;
+        for (const auto &output: outputs) {
+            for (const auto &[position, type, state]: output.changes)
+                edits.push_back({position, type});
+        }
+
+        m_world.applySimulationEdits(edits);
+
+        // États d'écoulement après les voxels : setVoxels les remet à zéro
+        for (const auto &output: outputs) {
+            for (const auto &[position, type, state]: output.changes) {
+                if (type != channel.properties.type) continue;
+                if (Chunk *chunk = m_world.getChunk(World::toChunkCoord(position))) {
+                    const ash::IVec3 local = World::toLocalCoord(position);
+                    chunk->setFluidState(local.x, local.y, local.z, state);
+                }
+            }
+
+            for (const auto &position: output.activations)
+                activateCell(channel, position);
+
+            m_lastChangeCount += output.changes.size();
+        }
+    }
+
+    void FluidSimulator::evaluateCell(const FluidProperties &properties, VoxelAccessor &voxels,
+                                      const glm::ivec3 &pos, StepOutput &output) const {
+        const VoxelType fluid = properties.type;
+        const FluidCell cell = readCell(voxels, pos);
+        if (cell.type != fluid && !canFlowInto(cell.type)) return;
+
+        const FluidCell below = readCell(voxels, pos + DOWN);
+        const bool canFall = canFlowInto(below.type);
+
+        // Nouvel état calculé uniquement à partir de l'état précédent des voisins
+        FluidCell next = cell;
+        if (cell.type != fluid || cell.state != 0) {
+            int sources = 0;
+            int best = properties.maxSpread + 1;
+            for (const auto &offset: HORIZONTAL) {
+                const FluidCell neighbor = readCell(voxels, pos + offset);
+                if (neighbor.type != fluid) continue;
+                if (neighbor.state == 0) ++sources;
+
+                // Un liquide qui peut tomber ne s'étale pas
+                if (canFlowInto(readCell(voxels, pos + offset + DOWN).type)) continue;
+                best = std::min(best, FluidArray::getLevel(neighbor.state) + 1);
+            }
+
+            if (properties.renewable && sources >= 2 && !canFall && (below.type != fluid || below.state == 0))
+                next = {fluid, 0};
+            else if (readCell(voxels, pos + UP).type == fluid)
+                next = {fluid, FluidArray::FALLING};
+            else if (best <= properties.maxSpread)
+                next = {fluid, static_cast<uint8_t>(best)};
+            else if (cell.type == fluid)
+                next = {VoxelID::AIR, 0};
+        }
+
+        if (next.type != cell.type || next.state != cell.state) {
+            output.changes.push_back({pos, next.type, next.state});
+            for (const auto &offset: SELF_AND_NEIGHBORS)
+                output.activations.push_back(pos + offset);
+            return;
+        }
+
+        if (next.type != fluid) return;
+
+        // Cellule stable : réveille les cellules libres vers lesquelles elle peut s'écouler
+        if (canFall) {
+            output.activations.push_back(pos + DOWN);
+        } else if (FluidArray::getLevel(next.state) < properties.maxSpread) {
+            for (const auto &offset: HORIZONTAL) {
+                if (canFlowInto(readCell(voxels, pos + offset).type))
+                    output.activations.push_back(pos + offset);
+            }
+        }
+    }
+
+    void FluidSimulator::activateCell(FluidChannel &channel, const glm::ivec3 &worldPos) {
+        channel.active[World::toChunkCoord(worldPos)].insert(toIndex(World::toLocalCoord(worldPos)));
+    }
+
+    FluidSimulator::FluidChannel *FluidSimulator::findChannel(const VoxelType type) {
+        for (auto &channel: m_channels) {
+            if (channel.properties.type == type) return &channel;
+        }
+        return nullptr;
+    }
+
+    FluidSimulator::FluidCell FluidSimulator::readCell(VoxelAccessor &voxels, const glm::ivec3 &worldPos) {
+        const Chunk *chunk = voxels.getChunk(World::toChunkCoord(worldPos));
+
+        // Chunk non chargé : considéré comme plein, le liquide ne s'écoule pas vers l'inconnu
+        if (!chunk) return {VoxelID::BEDROCK, 0};
+
+        const ash::IVec3 local = World::toLocalCoord(worldPos);
+        return {chunk->get(local), chunk->getFluidState(local.x, local.y, local.z)};
+    }
+
+    bool FluidSimulator::canFlowInto(const VoxelType type) {
+        return !isVoxelLiquid(type) && !doesVoxelHaveCollision(type);
+    }
+}
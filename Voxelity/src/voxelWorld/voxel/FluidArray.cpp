@@ -0,0 +1,37 @@
+#include "Voxelity/voxelWorld/voxel/FluidArray.h"
+
+#include <stdexcept>
+
+namespace voxelity {
+    FluidArray::FluidArray() : states{} {
+    }
+
+    uint8_t FluidArray::get(const int x, const int y, const int z) const {
+        const int i = index(x, y, z);
+        return states[i >> 1] >> ((i & 1) << 2) & 0x0F;
+    }
+
+    void FluidArray::set(const int x, const int y, const int z, const uint8_t state) {
+        const int i = index(x, y, z);
+        const int shift = (i & 1) << 2;
+        uint8_t &packed = states[i >> 1];
+        packed = static_cast<uint8_t>((packed & ~(0x0F << shift)) | (state & 0x0F) << shift);
+    }
+
+    void FluidArray::clearRow(const int minX, const int maxX, const int y, const int z) {
+        for (int x = minX; x <= maxX; ++x)
+            set(x, y, z, 0);
+    }
+
+    void FluidArray::clear() {
+        states.fill(0);
+    }
+
+    int FluidArray::index(const int x, const int y, const int z) {
+#ifndef NDEBUG
+        if (x < 0 || x >= VoxelArray::SIZE || y < 0 || y >= VoxelArray::SIZE || z < 0 || z >= VoxelArray::SIZE)
+            throw std::out_of_range("fluid position out of bounds");
+#endif
+        return x + VoxelArray::SIZE * (z + VoxelArray::SIZE * y);
+    }
+}
@@ -0,0 +1,42 @@
+#include "Voxelity/voxelWorld/voxel/LightArray.h"
+
+#include <stdexcept>
+
+namespace voxelity {
+    LightArray::LightArray() : levels{} {
+    }
+
+    uint8_t LightArray::get(const int x, const int y, const int z) const {
+        return levels[index(x, y, z)];
+    }
+
+    uint8_t LightArray::getSky(const int x, const int y, const int z) const {
+        return unpackSky(levels[index(x, y, z)]);
+    }
+
+    uint8_t LightArray::getBlock(const int x, const int y, const int z) const {
+        return unpackBlock(levels[index(x, y, z)]);
+    }
+
+    void LightArray::setSky(const int x, const int y, const int z, const uint8_t level) {
+        uint8_t &light = levels[index(x, y, z)];
+        light = pack(level & 0x0F, unpackBlock(light));
+    }
+
+    void LightArray::setBlock(const int x, const int y, const int z, const uint8_t level) {
+        uint8_t &light = levels[index(x, y, z)];
+        light = pack(unpackSky(light), level & 0x0F);
+    }
+
+    void LightArray::clear() {
+        levels.fill(0);
+    }
+
+    int LightArray::index(const int x, const int y, const int z) {
+#ifndef NDEBUG
+        if (x < 0 || x >= VoxelArray::SIZE || y < 0 || y >= VoxelArray::SIZE || z < 0 || z >= VoxelArray::SIZE)
+            throw std::out_of_range("light position out of bounds");
+#endif
+        return x + VoxelArray::SIZE * (z + VoxelArray::SIZE * y);
+    }
+}
@@ -19,6 +19,14 @@ namespace voxelity {
         voxels.fill(ID);
     }
 
+    const VoxelType *VoxelArray::getRow(const int y, const int z) const {
+        return &voxels[index(0, y, z)];
+    }
+
+    VoxelType *VoxelArray::getRow(const int y, const int z) {
+        return &voxels[index(0, y, z)];
+    }
+
     int VoxelArray::index(const int x, const int y, const int z) {
 #ifndef NDEBUG
         if (x < 0 || x >= SIZE || y < 0 || y >= SIZE || z < 0 || z >= SIZE)
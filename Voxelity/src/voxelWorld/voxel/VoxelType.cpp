@@ -1,5 +1,7 @@
 #include "Voxelity/voxelWorld/voxel/VoxelType.h"
 
+#include <algorithm>
+
 namespace voxelity {
     VoxelDefinition::VoxelDefinition(const std::string_view displayName,
                                      const ash::Color &color,
@@ -70,6 +72,12 @@ namespace voxelity {
         }
     }
 
+    void VoxelTypeRegistry::setLightEmission(const VoxelType voxelID, const uint8_t level) noexcept {
+        if (isValidVoxelID(voxelID)) {
+            registry[voxelID].lightEmission = std::min<uint8_t>(level, 15);
+        }
+    }
+
     void VoxelTypeRegistry::resetToDefaults() noexcept {
         for (auto &def: registry) {
             def = VoxelDefinition{};
@@ -108,6 +116,7 @@ namespace voxelity {
             "Lava", ash::Color::fromHex("#CF4A0F80"), RenderMode::TRANSPARENT, false
         };
         registry[VoxelID::LAVA].friction = 0.2f;
+        registry[VoxelID::LAVA].lightEmission = 15;
 
         registry[VoxelID::GLASS] = VoxelDefinition{
             "Glass", ash::Color::fromHex("#FFFFFF40"), RenderMode::TRANSPARENT, true
@@ -231,6 +240,14 @@ namespace voxelity {
         return !isVoxelAir(voxelID) && !isVoxelLiquid(voxelID);
     }
 
+    uint8_t getVoxelLightEmission(const VoxelType voxelID) noexcept {
+        return getVoxelTypeDefinition(voxelID).lightEmission;
+    }
+
+    bool doesVoxelBlockLight(const VoxelType voxelID) noexcept {
+        return isVoxelOpaque(voxelID);
+    }
+
     bool shouldRenderVoxelFace(const VoxelType currentVoxel, const VoxelType neighborVoxel) noexcept {
         if (currentVoxel == VoxelID::AIR) return false;
         if (neighborVoxel == VoxelID::AIR) return true;
@@ -1,16 +1,30 @@
 #include "Voxelity/voxelWorld/world/ChunkManager.h"
 
+#include <optional>
 #include <ranges>
 
 #include "Ashen/Core/Logger.h"
 
 #include "Voxelity/voxelWorld/generation/ITerrainGenerator.h"
+#include "Voxelity/voxelWorld/generation/ColumnCache.h"
+#include "Voxelity/voxelWorld/lod/LodManager.h"
+#include "Voxelity/voxelWorld/render/ChunkInstanceBuffer.h"
+#include "Voxelity/voxelWorld/storage/ChunkCodec.h"
+#include "Voxelity/voxelWorld/storage/RegionStorage.h"
+#include "Voxelity/voxelWorld/world/LightEngine.h"
 #include "Voxelity/voxelWorld/world/World.h"
 #include "Voxelity/voxelWorld/utils/DirectionUtils.h"
 
 namespace voxelity {
     ChunkManager::ChunkManager(ash::Own<ITerrainGenerator> generator, const int threadCount)
         : m_generator(std::move(generator)) {
+        if (m_generator)
+            m_columnCache = std::make_unique<ColumnCache>(*m_generator);
+
+        m_lightEngine = std::make_unique<LightEngine>(*this);
+        m_lodManager = std::make_unique<LodManager>(*this, m_generator.get(), m_columnCache.get());
+        m_instanceBuffer = std::make_unique<ChunkInstanceBuffer>();
+
         // Lancer les threads de génération
         for (int i = 0; i < threadCount; ++i) {
             m_generationThreads.emplace_back(&ChunkManager::generationWorker, this);
@@ -25,6 +39,12 @@ namespace voxelity {
     void ChunkManager::shutdown() {
         m_running = false;
 
+        if (m_lightEngine)
+            m_lightEngine->shutdown();
+
+        if (m_lodManager)
+            m_lodManager->shutdown();
+
         m_generationCV.notify_all();
         m_meshCV.notify_all();
 
@@ -34,27 +54,131 @@ namespace voxelity {
         for (auto &thread: m_meshThreads) {
             if (thread.joinable()) thread.join();
         }
+
+        // Plus aucun worker : les modifications restantes sont écrites ici
+        if (m_storage)
+            saveAll();
     }
 
     Chunk *ChunkManager::getChunk(const ChunkCoord &coord) {
+        std::shared_lock lock(m_chunksMutex);
         const auto it = m_chunks.find(coord);
         return it != m_chunks.end() ? it->second.get() : nullptr;
     }
 
-    Chunk *ChunkManager::getOrCreateChunk(const ChunkCoord &coord) {
+    ash::Ref<Chunk> ChunkManager::acquireChunk(const ChunkCoord &coord) const {
+        std::shared_lock lock(m_chunksMutex);
         const auto it = m_chunks.find(coord);
-        if (it != m_chunks.end())
-            return it->second.get();
+        return it != m_chunks.end() ? it->second : nullptr;
+    }
 
-        auto newChunk = std::make_unique<Chunk>(coord);
+    Chunk *ChunkManager::getEditableChunk(const ChunkCoord &coord) {
+        if (Chunk *chunk = getChunk(coord))
+            return chunk;
+
+        // Chunk en génération ou relu plus tard depuis le disque : rien à modifier pour l'instant.
+        // Sans générateur ni stockage, rien ne peut être en file : inutile de la consulter
+        if (m_generator || m_storage)
+            return nullptr;
+
+        auto newChunk = std::make_shared<Chunk>(coord);
         Chunk *ptr = newChunk.get();
+        std::unique_lock lock(m_chunksMutex);
         m_chunks.emplace(coord, std::move(newChunk));
         return ptr;
     }
 
     void ChunkManager::unloadChunk(const ChunkCoord &coord) {
-        m_chunks.erase(coord);
+        // Détruit ici, ou par le dernier worker qui le tient encore
+        ash::Ref<Chunk> chunk; {
+            std::unique_lock lock(m_chunksMutex);
+            const auto it = m_chunks.find(coord);
+            if (it != m_chunks.end()) {
+                chunk = std::move(it->second);
+                m_chunks.erase(coord);
+            }
+        }
         m_chunksInQueue.erase(coord);
+        m_instanceBuffer->release(coord);
+
+        if (!m_storage || !chunk || !chunk->isModified()) return;
+
+        // Écriture confiée aux workers ; une sauvegarde plus ancienne du même chunk devient périmée
+        {
+            std::lock_guard lock(m_pendingSavesMutex);
+            addPendingSave(coord, *chunk);
+        }
+
+        std::lock_guard lock(m_generationQueueMutex);
+        m_saveQueue.push({{coord}, false, nullptr});
+        m_generationCV.notify_one();
+    }
+
+    void ChunkManager::setStorage(ash::Own<RegionStorage> storage) {
+        m_storage = std::move(storage);
+    }
+
+    bool ChunkManager::requestSave() {
+        if (!m_storage || m_saveInProgress) return false;
+
+        const auto progress = ash::MakeRef<SaveProgress>();
+        progress->start = std::chrono::steady_clock::now();
+
+        // Seule partie sur le thread principal : un instantané par chunk modifié, sans copie
+        ash::HashMap<ChunkCoord, ash::Vector<ChunkCoord> > regions; {
+            std::lock_guard lock(m_pendingSavesMutex);
+            for (auto &[coord, chunk]: m_chunks) {
+                if (!chunk->isModified()) continue;
+
+                addPendingSave(coord, *chunk);
+                regions[RegionStorage::toRegionCoord(coord)].push_back(coord);
+            }
+        }
+
+        progress->pauseMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - progress->start).count();
+
+        if (regions.empty()) {
+            finishSave(*progress);
+            return true;
+        }
+
+        m_saveInProgress = true;
+        progress->remainingJobs = regions.size(); {
+            std::lock_guard lock(m_generationQueueMutex);
+            for (auto &[region, coords]: regions)
+                m_saveQueue.push({std::move(coords), true, progress});
+        }
+        m_generationCV.notify_all();
+        return true;
+    }
+
+    WorldSaveStats ChunkManager::getLastSaveStats() {
+        std::lock_guard lock(m_saveStatsMutex);
+        return m_lastSaveStats;
+    }
+
+    void ChunkManager::saveAll() {
+        if (!m_storage) return;
+
+        // Même chemin que requestSave, exécuté sur le thread appelant,
+        // avec en plus les sauvegardes de déchargement pas encore écrites
+        ash::HashMap<ChunkCoord, ash::Vector<ChunkCoord> > regions; {
+            std::lock_guard lock(m_pendingSavesMutex);
+            for (auto &[coord, chunk]: m_chunks) {
+                if (chunk->isModified()) addPendingSave(coord, *chunk);
+            }
+            for (const auto &coord: m_pendingSaves | std::views::keys)
+                regions[RegionStorage::toRegionCoord(coord)].push_back(coord);
+        }
+
+        for (auto &[region, coords]: regions)
+            runSave({std::move(coords), true, nullptr});
+    }
+
+    size_t ChunkManager::getPendingSaveCount() {
+        std::lock_guard lock(m_pendingSavesMutex);
+        return m_pendingSaves.size();
     }
 
     void ChunkManager::updateLoadedChunks(const glm::vec3 &playerPos, const int renderDistance) {
@@ -65,7 +189,7 @@ namespace voxelity {
             m_lastRenderDistance = renderDistance;
 
             ash::Vector<ChunkCoord> requiredChunks = getChunksInRadius(playerChunk, renderDistance);
-            const std::unordered_set<ChunkCoord> requiredSet(requiredChunks.begin(), requiredChunks.end());
+            const ash::FlatHashSet<ChunkCoord> requiredSet(requiredChunks.begin(), requiredChunks.end());
 
             // Ajouter nouveaux chunks à générer
             for (const auto &coord: requiredChunks) {
@@ -87,6 +211,15 @@ namespace voxelity {
 
             for (const auto &coord: toUnload)
                 unloadChunk(coord);
+
+            m_lodManager->update(playerChunk, renderDistance);
+
+            // Garder les colonnes de la zone chargée (anneau des colonnes voisines compris),
+            // oublier d'abord les plus lointaines
+            if (m_columnCache) {
+                const size_t diameter = 2 * renderDistance + 3;
+                m_columnCache->prune({playerChunk.x, playerChunk.z}, diameter * diameter);
+            }
         }
     }
 
@@ -97,17 +230,16 @@ namespace voxelity {
             while (!m_completedGeneration.empty()) {
                 auto &data = m_completedGeneration.front();
 
-                Chunk *chunk = getOrCreateChunk(data.coord);
-                if (chunk && data.voxelData) {
-                    // Copier les données générées dans le chunk
-                    for (int x = 0; x < VoxelArray::SIZE; ++x) {
-                        for (int y = 0; y < VoxelArray::SIZE; ++y) {
-                            for (int z = 0; z < VoxelArray::SIZE; ++z) {
-                                chunk->set(x, y, z, data.voxelData->get(x, y, z));
-                            }
-                        }
-                    }
+                // Un chunk déjà présent fait foi : il n'est jamais remplacé par les données chargées
+                if (data.voxelData && !m_chunks.contains(data.coord)) {
+                    auto chunk = std::make_shared<Chunk>(data.coord);
+                    chunk->assign(*data.voxelData, data.fluidData.get());
 
+                    // Un chunk généré n'existe pas encore sur disque
+                    chunk->setModified(!data.fromStorage && m_storage);
+
+                    std::unique_lock chunksLock(m_chunksMutex);
+                    m_chunks.emplace(data.coord, std::move(chunk));
                     newlyGeneratedChunks.push_back(data.coord);
                 }
 
@@ -115,58 +247,66 @@ namespace voxelity {
             }
         }
 
-        if (!newlyGeneratedChunks.empty()) {
-            // ash::Logger::info() << "Processed " << newlyGeneratedChunks.size() << " generated chunks";
-
-            // Après avoir ajouté les nouveaux chunks, vérifier tous les chunks qui peuvent maintenant être meshés
-            // (y compris ceux qui ont été générés précédemment mais n'avaient pas tous leurs voisins)
-            for (const auto &coord: newlyGeneratedChunks) {
-                // Calculer la priorité basée sur la distance au dernier chunk du joueur
-                const int dx = coord.x - m_lastPlayerChunk.x;
-                const int dy = coord.y - m_lastPlayerChunk.y;
-                const int dz = coord.z - m_lastPlayerChunk.z;
-                const int priority = dx * dx + dy * dy + dz * dz;
-
-                // Essayer de mesher le chunk nouvellement généré
-                markChunkForMeshRebuild(coord, priority);
-
-                // Essayer de mesher les 6 voisins qui pourraient maintenant avoir tous leurs voisins
-                const std::array<ChunkCoord, 6> neighbors = {
-                    {
-                        {coord.x + 1, coord.y, coord.z},
-                        {coord.x - 1, coord.y, coord.z},
-                        {coord.x, coord.y + 1, coord.z},
-                        {coord.x, coord.y - 1, coord.z},
-                        {coord.x, coord.y, coord.z + 1},
-                        {coord.x, coord.y, coord.z - 1}
-                    }
-                };
-
-                for (const auto &neighbor: neighbors) {
-                    if (const Chunk *neighborChunk = getChunk(neighbor)) {
-                        if (neighborChunk->isDirty()) {
-                            // Calculer la priorité pour le voisin
-                            const int ndx = neighbor.x - m_lastPlayerChunk.x;
-                            const int ndy = neighbor.y - m_lastPlayerChunk.y;
-                            const int ndz = neighbor.z - m_lastPlayerChunk.z;
-                            const int neighborPriority = ndx * ndx + ndy * ndy + ndz * ndz;
-
-                            markChunkForMeshRebuild(neighbor, neighborPriority);
-                        }
-                    }
-                }
+        // Le mesh attend le premier éclairage du chunk (voir processLighting)
+        for (const auto &coord: newlyGeneratedChunks)
+            m_lightEngine->enqueueChunk(coord);
+    }
+
+    void ChunkManager::processLighting() {
+        const auto [litChunks, relitChunks] = m_lightEngine->takeResults();
+
+        for (const auto &coord: litChunks)
+            requestMeshWithNeighbors(coord);
+
+        for (const auto &coord: relitChunks) {
+            if (getChunk(coord))
+                markChunkForMeshRebuild(coord, getChunkPriority(coord));
+        }
+    }
+
+    void ChunkManager::requestMeshWithNeighbors(const ChunkCoord &coord) {
+        if (!getChunk(coord)) return;
+
+        // Essayer de mesher le chunk nouvellement éclairé
+        markChunkForMeshRebuild(coord, getChunkPriority(coord));
+
+        // Essayer de mesher les 6 voisins qui pourraient maintenant avoir tous leurs voisins
+        const std::array<ChunkCoord, 6> neighbors = {
+            {
+                {coord.x + 1, coord.y, coord.z},
+                {coord.x - 1, coord.y, coord.z},
+                {coord.x, coord.y + 1, coord.z},
+                {coord.x, coord.y - 1, coord.z},
+                {coord.x, coord.y, coord.z + 1},
+                {coord.x, coord.y, coord.z - 1}
+            }
+        };
+
+        for (const auto &neighbor: neighbors) {
+            if (const Chunk *neighborChunk = getChunk(neighbor)) {
+                if (neighborChunk->isDirty())
+                    markChunkForMeshRebuild(neighbor, getChunkPriority(neighbor));
             }
         }
     }
 
+    int ChunkManager::getChunkPriority(const ChunkCoord &coord) const {
+        // Priorité basée sur la distance au dernier chunk du joueur
+        const int dx = coord.x - m_lastPlayerChunk.x;
+        const int dy = coord.y - m_lastPlayerChunk.y;
+        const int dz = coord.z - m_lastPlayerChunk.z;
+        return dx * dx + dy * dy + dz * dz;
+    }
+
     void ChunkManager::processCompletedMeshes() {
         std::lock_guard lock(m_completedMeshesMutex);
 
         int processedCount = 0;
         while (!m_completedMeshes.empty()) {
-            auto &[coord, opaqueFaces, transparentFaces] = m_completedMeshes.front();
+            auto &[coord, opaqueFaces, transparentFaces, visibility] = m_completedMeshes.front();
             if (Chunk *chunk = getChunk(coord)) {
-                chunk->uploadMesh(opaqueFaces, transparentFaces);
+                m_instanceBuffer->upload(coord, opaqueFaces, transparentFaces);
+                chunk->markMeshUploaded(visibility);
                 processedCount++;
             }
 
@@ -176,6 +316,8 @@ namespace voxelity {
         if (processedCount > 0) {
             // ash::Logger::info() << "Uploaded " << processedCount << " chunk meshes";
         }
+
+        m_lodManager->processCompleted();
     }
 
     void ChunkManager::markChunkForMeshRebuild(const ChunkCoord &coord, const int priority) {
@@ -210,7 +352,14 @@ namespace voxelity {
     }
 
     void ChunkManager::clear() {
-        m_chunks.clear(); {
+        m_lightEngine->clear();
+        m_lodManager->clear(); {
+            std::unique_lock lock(m_chunksMutex);
+            m_chunks.clear();
+        } {
+            std::lock_guard protoLock(m_protoChunksMutex);
+            m_protoChunks.clear();
+
             std::lock_guard lock(m_generationQueueMutex);
             while (!m_generationQueue.empty()) m_generationQueue.pop();
         } {
@@ -219,11 +368,15 @@ namespace voxelity {
         }
 
         m_chunksInQueue.clear();
+        m_instanceBuffer->clear();
+
+        if (m_columnCache)
+            m_columnCache->clear();
     }
 
     size_t ChunkManager::getPendingLoadCount() {
-        std::lock_guard lock(m_generationQueueMutex);
-        return m_generationQueue.size();
+        std::lock_guard lock(m_protoChunksMutex);
+        return m_protoChunks.size();
     }
 
     size_t ChunkManager::getPendingMeshCount() {
@@ -233,37 +386,45 @@ namespace voxelity {
 
     void ChunkManager::queueChunkLoad(const ChunkCoord &coord, const int priority) {
         if (m_chunksInQueue.contains(coord)) return;
-
-        std::lock_guard lock(m_generationQueueMutex);
-        m_generationQueue.push({coord, priority});
         m_chunksInQueue.insert(coord);
-        m_generationCV.notify_one();
+
+        std::lock_guard lock(m_protoChunksMutex);
+        auto proto = std::make_shared<ProtoChunk>();
+        proto->priority = priority;
+        scheduleStage(coord, *m_protoChunks.insert_or_assign(coord, std::move(proto)).first->second);
     }
 
     void ChunkManager::generationWorker() {
         // ash::Logger::info("ChunkManager::generationWorker");
         while (m_running.load()) {
-            ChunkLoadRequest request; {
+            ChunkLoadRequest request;
+            std::optional<SaveJob> save; {
                 std::unique_lock lock(m_generationQueueMutex);
                 m_generationCV.wait(lock, [this] {
-                    return !m_generationQueue.empty() || !m_running;
+                    return !m_generationQueue.empty() || !m_saveQueue.empty() || !m_running;
                 });
 
                 if (!m_running) break;
-                if (m_generationQueue.empty()) continue;
 
-                request = m_generationQueue.top();
-                m_generationQueue.pop();
+                // Les sauvegardes passent avant la génération : elles libèrent de la mémoire
+                if (!m_saveQueue.empty()) {
+                    save = std::move(m_saveQueue.front());
+                    m_saveQueue.pop();
+                } else if (!m_generationQueue.empty()) {
+                    request = m_generationQueue.top();
+                    m_generationQueue.pop();
+                } else {
+                    continue;
+                }
             }
 
-            // Générer les données (hors mutex)
-            auto voxelData = generateChunkData(request.coord);
-
-            // Ajouter aux résultats
-            {
-                std::lock_guard lock(m_completedGenerationMutex);
-                m_completedGeneration.push({request.coord, std::move(voxelData)});
+            if (save) {
+                runSave(*save);
+                continue;
             }
+
+            // Exécuter l'étape (hors mutex)
+            runGenerationStage(request);
         }
     }
 
@@ -295,33 +456,258 @@ namespace voxelity {
         }
     }
 
-    std::unique_ptr<VoxelArray> ChunkManager::generateChunkData(const ChunkCoord &coord) const {
-        auto voxelData = std::make_unique<VoxelArray>();
+    void ChunkManager::runGenerationStage(const ChunkLoadRequest &request) {
+        ash::Ref<ProtoChunk> proto; {
+            std::lock_guard lock(m_protoChunksMutex);
+            const auto it = m_protoChunks.find(request.coord);
+            if (it == m_protoChunks.end()) return; // Annulé (clear)
+            proto = it->second;
+        }
 
-        if (m_generator) {
-            Chunk tempChunk(coord);
-            m_generator->generateChunk(tempChunk);
+        // Chunk déjà sauvegardé : lu depuis le disque, sans passer par les étapes de génération
+        if (request.stage == GenerationStage::DENSITY && m_storage) {
+            GeneratedChunkData stored{request.coord, std::make_unique<VoxelArray>(), nullptr, true};
+            if (loadStoredChunk(stored)) {
+                std::lock_guard lock(m_protoChunksMutex);
+                const auto it = m_protoChunks.find(request.coord);
+                if (it == m_protoChunks.end() || it->second != proto) return;
+                {
+                    std::lock_guard completedLock(m_completedGenerationMutex);
+                    m_completedGeneration.push(std::move(stored));
+                }
+                m_protoChunks.erase(it);
+                wakeWaitingNeighbors(request.coord);
+                return;
+            }
+        }
 
-            // Copier les données
-            for (int x = 0; x < VoxelArray::SIZE; ++x) {
-                for (int y = 0; y < VoxelArray::SIZE; ++y) {
-                    for (int z = 0; z < VoxelArray::SIZE; ++z) {
-                        voxelData->set(x, y, z, tempChunk.get(x, y, z));
-                    }
+        // Une seule tâche par chunk est en vol : le proto n'est touché que par ce thread
+        if (request.stage == GenerationStage::DENSITY) {
+            proto->voxels = std::make_unique<VoxelArray>();
+            if (m_columnCache)
+                proto->column = m_columnCache->getOrBuild({request.coord.x, request.coord.z});
+        }
+
+        if (m_generator && proto->column) {
+            GenerationContext context{request.coord, *proto->voxels, *proto->column};
+
+            // Les structures nées à côté débordent sur ce chunk : colonnes des voisins
+            std::array<ash::Ref<const ColumnData>, 9> columns;
+            if (m_generator->getStageDependency(request.stage).radius > 0) {
+                gatherNeighborColumns(request.coord, columns);
+                for (int i = 0; i < 9; ++i)
+                    context.neighborColumns[i] = columns[i].get();
+            }
+
+            m_generator->runStage(request.stage, context);
+        }
+
+        std::lock_guard lock(m_protoChunksMutex);
+        const auto it = m_protoChunks.find(request.coord);
+        if (it == m_protoChunks.end() || it->second != proto) return;
+
+        proto->nextStage = nextStage(request.stage);
+
+        if (proto->nextStage == GenerationStage::COUNT) {
+            {
+                std::lock_guard completedLock(m_completedGenerationMutex);
+                m_completedGeneration.push({request.coord, std::move(proto->voxels), nullptr, false});
+            }
+            m_protoChunks.erase(it);
+        } else {
+            scheduleStage(request.coord, *proto);
+        }
+
+        wakeWaitingNeighbors(request.coord);
+    }
+
+    bool ChunkManager::loadStoredChunk(GeneratedChunkData &data) {
+        // Une version plus récente que le disque peut encore attendre son écriture
+        ChunkSnapshot pending; {
+            std::lock_guard lock(m_pendingSavesMutex);
+            const auto it = m_pendingSaves.find(data.coord);
+            if (it != m_pendingSaves.end()) pending = it->second.snapshot;
+        }
+
+        if (pending.voxels) {
+            *data.voxelData = *pending.voxels;
+            data.fluidData = pending.fluid ? std::make_unique<FluidArray>(*pending.fluid) : nullptr;
+            data.fromStorage = false; // Le disque n'est pas encore à jour
+            return true;
+        }
+
+        ChunkData stored;
+        if (!m_storage->loadChunk(data.coord, stored)) return false;
+
+        *data.voxelData = stored.voxels;
+        data.fluidData = std::move(stored.fluid);
+        return true;
+    }
+
+    void ChunkManager::runSave(const SaveJob &job) {
+        ash::Vector<EncodedChunk> encoded;
+        ash::HashMap<ChunkCoord, uint64_t> sequences;
+
+        // Versions à écrire, encodées hors verrou
+        ash::Vector<std::pair<ChunkCoord, ChunkSnapshot> > snapshots; {
+            std::lock_guard lock(m_pendingSavesMutex);
+            for (const auto &coord: job.chunks) {
+                const auto it = m_pendingSaves.find(coord);
+                if (it == m_pendingSaves.end()) continue;
+
+                snapshots.emplace_back(coord, it->second.snapshot);
+                sequences[coord] = it->second.sequence;
+            }
+        }
+
+        size_t byteCount = 0;
+        encoded.reserve(snapshots.size());
+        for (const auto &[coord, snapshot]: snapshots) {
+            encoded.push_back({coord, ChunkCodec::encode(coord, *snapshot.voxels, snapshot.fluid.get())});
+            byteCount += encoded.back().bytes.size();
+        }
+
+        // Un instantané plus récent a pu être pris depuis : il sera écrit par sa propre tâche
+        const auto isCurrent = [&](const ChunkCoord &coord) {
+            std::lock_guard lock(m_pendingSavesMutex);
+            const auto it = m_pendingSaves.find(coord);
+            return it != m_pendingSaves.end() && it->second.sequence == sequences[coord];
+        };
+
+        if (m_storage->writeChunks(encoded, job.rewrite, isCurrent)) {
+            std::lock_guard lock(m_pendingSavesMutex);
+            for (const auto &[coord, sequence]: sequences) {
+                const auto it = m_pendingSaves.find(coord);
+                if (it != m_pendingSaves.end() && it->second.sequence == sequence)
+                    m_pendingSaves.erase(it);
+            }
+        } else {
+            // Échec : la version reste en attente et le chunk chargé sera ressauvegardé
+            for (const auto &coord: job.chunks) {
+                if (Chunk *chunk = getChunk(coord)) chunk->setModified(true);
+            }
+            byteCount = 0;
+        }
+
+        if (job.progress) {
+            job.progress->chunkCount += snapshots.size();
+            job.progress->byteCount += byteCount;
+            if (job.progress->remainingJobs.fetch_sub(1) == 1)
+                finishSave(*job.progress);
+        }
+    }
+
+    void ChunkManager::addPendingSave(const ChunkCoord &coord, Chunk &chunk) {
+        // Drapeau remis à zéro avant l'instantané : une modification concurrente le relève
+        chunk.setModified(false);
+        m_pendingSaves[coord] = {chunk.snapshot(), ++m_saveSequence};
+    }
+
+    void ChunkManager::finishSave(const SaveProgress &progress) {
+        WorldSaveStats stats;
+        stats.chunkCount = progress.chunkCount;
+        stats.byteCount = progress.byteCount;
+        stats.pauseMs = progress.pauseMs;
+        stats.durationMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - progress.start).count();
+
+        if (stats.chunkCount > 0) {
+            const double megabytesPerSecond = stats.durationMs > 0.0
+                                                  ? static_cast<double>(stats.byteCount) / 1048576.0 /
+                                                    (stats.durationMs / 1000.0)
+                                                  : 0.0;
+            ash::Logger::Info() << "World saved: " << stats.chunkCount << " chunks, " << stats.byteCount / 1024
+                    << " KiB in " << stats.durationMs << " ms (" << megabytesPerSecond
+                    << " MiB/s), main thread pause " << stats.pauseMs << " ms";
+        }
+
+        {
+            std::lock_guard lock(m_saveStatsMutex);
+            m_lastSaveStats = stats;
+        }
+        m_saveInProgress = false;
+    }
+
+    bool ChunkManager::areStageDependenciesMet(const ChunkCoord &coord, const GenerationStage stage) const {
+        if (!m_generator) return true;
+        const StageDependency dependency = m_generator->getStageDependency(stage);
+        if (dependency.radius <= 0) return true;
+
+        // Les voisins absents du pipeline (non demandés ou déjà terminés) ne bloquent pas
+        for (int dx = -dependency.radius; dx <= dependency.radius; ++dx) {
+            for (int dz = -dependency.radius; dz <= dependency.radius; ++dz) {
+                if (dx == 0 && dz == 0) continue;
+
+                const auto it = m_protoChunks.find({coord.x + dx, coord.y, coord.z + dz});
+                if (it != m_protoChunks.end() && it->second->nextStage <= dependency.requiredStage)
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    void ChunkManager::scheduleStage(const ChunkCoord &coord, ProtoChunk &proto) {
+        if (!areStageDependenciesMet(coord, proto.nextStage)) {
+            proto.waiting = true;
+            return;
+        }
+
+        proto.waiting = false;
+
+        std::lock_guard lock(m_generationQueueMutex);
+        m_generationQueue.push({coord, proto.priority, proto.nextStage});
+        m_generationCV.notify_one();
+    }
+
+    void ChunkManager::wakeWaitingNeighbors(const ChunkCoord &coord) {
+        int radius = 0;
+        for (int stage = 0; stage < GENERATION_STAGE_COUNT && m_generator; ++stage)
+            radius = std::max(radius, m_generator->getStageDependency(static_cast<GenerationStage>(stage)).radius);
+
+        for (int dx = -radius; dx <= radius; ++dx) {
+            for (int dz = -radius; dz <= radius; ++dz) {
+                if (dx == 0 && dz == 0) continue;
+
+                const ChunkCoord neighbor{coord.x + dx, coord.y, coord.z + dz};
+                const auto it = m_protoChunks.find(neighbor);
+                if (it != m_protoChunks.end() && it->second->waiting)
+                    scheduleStage(neighbor, *it->second);
+            }
+        }
+    }
+
+    void ChunkManager::gatherNeighborColumns(const ChunkCoord &coord,
+                                             std::array<ash::Ref<const ColumnData>, 9> &columns) {
+        {
+            std::lock_guard lock(m_protoChunksMutex);
+            for (int dz = -1; dz <= 1; ++dz) {
+                for (int dx = -1; dx <= 1; ++dx) {
+                    // Colonne posée par l'étape DENSITY du voisin, publiée sous ce verrou avec nextStage.
+                    // Un voisin demandé après la mise en file de cette étape n'en a pas encore
+                    const auto it = m_protoChunks.find({coord.x + dx, coord.y, coord.z + dz});
+                    if (it != m_protoChunks.end() && it->second->nextStage > GenerationStage::DENSITY)
+                        columns[(dx + 1) + (dz + 1) * 3] = it->second->column;
                 }
             }
         }
 
-        return voxelData;
+        // Voisins hors du pipeline (terminés, lus sur disque ou hors de la zone chargée)
+        for (int i = 0; i < 9; ++i) {
+            if (!columns[i])
+                columns[i] = m_columnCache->getOrBuild({coord.x + i % 3 - 1, coord.z + i / 3 - 1});
+        }
     }
 
     MeshData ChunkManager::buildChunkMesh(const ChunkCoord &coord) {
         MeshData meshData;
         meshData.coord = coord;
 
-        const Chunk *chunk = getChunk(coord);
+        const ash::Ref<Chunk> chunk = acquireChunk(coord);
         if (!chunk) return meshData;
 
+        // Connectivité des faces pour le cave culling, sur un instantané sans copie
+        meshData.visibility = ChunkVisibility::compute(*chunk->snapshot().voxels);
+
         for (int x = 0; x < VoxelArray::SIZE; ++x) {
             for (int y = 0; y < VoxelArray::SIZE; ++y) {
                 for (int z = 0; z < VoxelArray::SIZE; ++z) {
@@ -336,13 +722,14 @@ namespace voxelity {
                         const int nx = x + offset.x, ny = y + offset.y, nz = z + offset.z;
 
                         VoxelType neighborVoxelID;
-                        if (nx >= 0 && ny >= 0 && nz >= 0 &&
-                            nx < VoxelArray::SIZE && ny < VoxelArray::SIZE && nz < VoxelArray::SIZE) {
+                        const bool inside = nx >= 0 && ny >= 0 && nz >= 0 &&
+                                      nx < VoxelArray::SIZE && ny < VoxelArray::SIZE && nz < VoxelArray::SIZE;
+                        const int wx = coord.x * VoxelArray::SIZE + nx;
+                        const int wy = coord.y * VoxelArray::SIZE + ny;
+                        const int wz = coord.z * VoxelArray::SIZE + nz;
+                        if (inside) {
                             neighborVoxelID = chunk->get(nx, ny, nz);
                         } else {
-                            const int wx = coord.x * VoxelArray::SIZE + nx;
-                            const int wy = coord.y * VoxelArray::SIZE + ny;
-                            const int wz = coord.z * VoxelArray::SIZE + nz;
                             neighborVoxelID = getVoxelSafe(wx, wy, wz);
                         }
 
@@ -358,7 +745,9 @@ namespace voxelity {
                         }
 
                         if (visible) {
-                            FaceInstance face{glm::ivec3(x, y, z), faceID, voxelID};
+                            // Une face est éclairée par la cellule qu'elle regarde
+                            const uint8_t light = inside ? chunk->getLight(nx, ny, nz) : getLightSafe(wx, wy, wz);
+                            FaceInstance face{glm::ivec3(x, y, z), faceID, voxelID, light};
 
                             if (type == RenderMode::TRANSPARENT) {
                                 meshData.transparentFaces.push_back(face);
@@ -398,13 +787,22 @@ namespace voxelity {
         const ChunkCoord chunkCoord = World::toChunkCoord(worldX, worldY, worldZ);
         const glm::ivec3 localPos = World::toLocalCoord(worldX, worldY, worldZ);
 
-        const Chunk *chunk = const_cast<ChunkManager *>(this)->getChunk(chunkCoord);
-        if (chunk)
+        if (const ash::Ref<Chunk> chunk = acquireChunk(chunkCoord))
             return chunk->get(localPos.x, localPos.y, localPos.z);
 
         return VoxelID::AIR;
     }
 
+    uint8_t ChunkManager::getLightSafe(const int worldX, const int worldY, const int worldZ) const {
+        const ChunkCoord chunkCoord = World::toChunkCoord(worldX, worldY, worldZ);
+        const glm::ivec3 localPos = World::toLocalCoord(worldX, worldY, worldZ);
+
+        if (const ash::Ref<Chunk> chunk = acquireChunk(chunkCoord))
+            return chunk->getLight(localPos.x, localPos.y, localPos.z);
+
+        return LightArray::pack(LightArray::MAX_LEVEL, 0);
+    }
+
     ash::Vector<ChunkCoord> ChunkManager::getChunksInRadius(const glm::ivec3 &center, const int radius) {
         ash::Vector<ChunkCoord> result;
         for (int x = center.x - radius; x <= center.x + radius; ++x) {
@@ -0,0 +1,429 @@
+#include "Voxelity/voxelWorld/world/LightEngine.h"
+
+#include <array>
+#include <utility>
+
+#include "Voxelity/voxelWorld/utils/DirectionUtils.h"
+#include "Voxelity/voxelWorld/world/ChunkManager.h"
+
+namespace voxelity {
+    namespace {
+        constexpr int SKY = static_cast<int>(LightChannel::SKY);
+        constexpr int BLOCK = static_cast<int>(LightChannel::BLOCK);
+        constexpr LightChannel CHANNELS[2] = {LightChannel::SKY, LightChannel::BLOCK};
+
+        glm::ivec3 toLocal(const glm::ivec3 &worldPos) {
+            return {worldPos.x & VoxelArray::MASK, worldPos.y & VoxelArray::MASK, worldPos.z & VoxelArray::MASK};
+        }
+
+        ChunkCoord toChunk(const glm::ivec3 &worldPos) {
+            return {worldPos.x >> VoxelArray::SHIFT, worldPos.y >> VoxelArray::SHIFT, worldPos.z >> VoxelArray::SHIFT};
+        }
+
+        // La lumière du ciel descend sans s'atténuer tant qu'elle est au maximum
+        bool isSkyColumn(const LightChannel channel, const CubicDirection dir, const uint8_t level) {
+            return channel == LightChannel::SKY && dir == CubicDirection::YN && level == LightArray::MAX_LEVEL;
+        }
+    }
+
+    LightEngine::LightEngine(ChunkManager &chunkManager)
+        : m_chunkManager(chunkManager) {
+        m_thread = std::thread(&LightEngine::worker, this);
+    }
+
+    LightEngine::~LightEngine() {
+        shutdown();
+    }
+
+    void LightEngine::enqueueChunk(const ChunkCoord &coord) {
+        std::lock_guard lock(m_jobsMutex);
+        m_jobs.push_back({JobType::CHUNK, coord});
+        m_jobsCV.notify_one();
+    }
+
+    void LightEngine::enqueueRelight(const ChunkCoord &coord) {
+        std::lock_guard lock(m_jobsMutex);
+        if (!m_pendingRelights.insert(coord).second) return;
+
+        m_jobs.push_back({JobType::RELIGHT, coord});
+        m_jobsCV.notify_one();
+    }
+
+    void LightEngine::enqueueVoxelChange(const glm::ivec3 &worldPos) {
+        std::lock_guard lock(m_jobsMutex);
+        m_jobs.push_back({JobType::VOXEL, toChunk(worldPos), worldPos});
+        m_jobsCV.notify_one();
+    }
+
+    LightResults LightEngine::takeResults() {
+        std::lock_guard lock(m_resultsMutex);
+        return std::exchange(m_results, {});
+    }
+
+    size_t LightEngine::getPendingJobCount() {
+        std::lock_guard lock(m_jobsMutex);
+        return m_jobs.size() + (m_jobRunning ? 1 : 0);
+    }
+
+    void LightEngine::clear() { {
+            std::lock_guard lock(m_jobsMutex);
+            m_jobs.clear();
+            m_pendingRelights.clear();
+        }
+
+        std::lock_guard lock(m_resultsMutex);
+        m_results = {};
+    }
+
+    void LightEngine::shutdown() {
+        m_running = false;
+        m_jobsCV.notify_all();
+
+        if (m_thread.joinable()) m_thread.join();
+    }
+
+    void LightEngine::worker() {
+        while (m_running.load()) {
+            LightJob job; {
+                std::unique_lock lock(m_jobsMutex);
+                m_jobsCV.wait(lock, [this] {
+                    return !m_jobs.empty() || !m_running;
+                });
+
+                if (!m_running) break;
+                if (m_jobs.empty()) continue;
+
+                job = m_jobs.front();
+                m_jobs.pop_front();
+                if (job.type == JobType::RELIGHT) m_pendingRelights.erase(job.coord);
+                m_jobRunning = true;
+            }
+
+            processJob(job);
+
+            std::lock_guard lock(m_jobsMutex);
+            m_jobRunning = false;
+        }
+    }
+
+    void LightEngine::processJob(const LightJob &job) {
+        Propagation propagation;
+
+        switch (job.type) {
+            case JobType::CHUNK: lightChunk(propagation, job.coord, false);
+                break;
+            case JobType::RELIGHT: lightChunk(propagation, job.coord, true);
+                break;
+            case JobType::VOXEL: updateVoxel(propagation, job.worldPos);
+                break;
+        }
+
+        std::lock_guard lock(m_resultsMutex);
+        if (job.type == JobType::CHUNK)
+            m_results.litChunks.push_back(job.coord);
+
+        for (const auto &coord: propagation.touched) {
+            if (job.type == JobType::CHUNK && coord == job.coord) continue;
+            m_results.relitChunks.push_back(coord);
+        }
+    }
+
+    void LightEngine::lightChunk(Propagation &propagation, const ChunkCoord &coord, const bool relight) {
+        constexpr int SIZE = VoxelArray::SIZE;
+        const glm::ivec3 origin{coord.x * SIZE, coord.y * SIZE, coord.z * SIZE};
+
+        Chunk *chunk = chunkAt(propagation, origin);
+        if (!chunk) return;
+
+        // 1. Ré-éclairage : retirer toute la lumière actuelle du chunk,
+        // la suppression se propage aux voisins qu'elle éclairait
+        if (relight) {
+            for (int y = 0; y < SIZE; ++y) {
+                for (int z = 0; z < SIZE; ++z) {
+                    for (int x = 0; x < SIZE; ++x) {
+                        const glm::ivec3 pos = origin + glm::ivec3(x, y, z);
+                        const uint8_t light = chunk->getLightData().get(x, y, z);
+
+                        for (const LightChannel channel: CHANNELS) {
+                            const uint8_t level = channel == LightChannel::SKY
+                                                      ? LightArray::unpackSky(light)
+                                                      : LightArray::unpackBlock(light);
+                            if (level == 0) continue;
+
+                            setLevel(propagation, *chunk, channel, pos, 0);
+                            propagation.removeQueues[static_cast<int>(channel)].push_back({pos, level});
+                        }
+                    }
+                }
+            }
+        }
+
+        // 2. Colonnes ouvertes sur le ciel (chunk du dessus absent = ciel dégagé)
+        std::array<bool, SIZE * SIZE> openTop{};
+        std::array<bool, SIZE * SIZE> openBottom{};
+        const Chunk *above = chunkAt(propagation, origin + glm::ivec3(0, SIZE, 0));
+        for (int z = 0; z < SIZE; ++z) {
+            for (int x = 0; x < SIZE; ++x) {
+                const bool open = !above || above->getLightData().getSky(x, 0, z) == LightArray::MAX_LEVEL;
+                bool reachesBottom = open;
+                for (int y = SIZE - 1; y >= 0 && reachesBottom; --y)
+                    reachesBottom = !doesVoxelBlockLight(chunk->get(x, y, z));
+
+                openTop[x + z * SIZE] = open;
+                openBottom[x + z * SIZE] = reachesBottom;
+            }
+        }
+
+        // Le chunk du dessous a pu être éclairé comme s'il était à ciel ouvert
+        if (Chunk *below = chunkAt(propagation, origin + glm::ivec3(0, -1, 0))) {
+            for (int z = 0; z < SIZE; ++z) {
+                for (int x = 0; x < SIZE; ++x) {
+                    if (openBottom[x + z * SIZE] ||
+                        below->getLightData().getSky(x, SIZE - 1, z) != LightArray::MAX_LEVEL)
+                        continue;
+
+                    const glm::ivec3 pos = origin + glm::ivec3(x, -1, z);
+                    setLevel(propagation, *below, LightChannel::SKY, pos, 0);
+                    propagation.removeQueues[SKY].push_back({pos, LightArray::MAX_LEVEL});
+                }
+            }
+        }
+
+        // 3. Suppressions avant toute nouvelle source
+        propagateRemovals(propagation, LightChannel::SKY);
+        propagateRemovals(propagation, LightChannel::BLOCK);
+
+        // 4. Sources : colonnes de ciel, blocs émetteurs, bords des chunks voisins
+        chunk = chunkAt(propagation, origin);
+        for (int z = 0; z < SIZE; ++z) {
+            for (int x = 0; x < SIZE; ++x) {
+                if (!openTop[x + z * SIZE]) continue;
+
+                for (int y = SIZE - 1; y >= 0; --y) {
+                    if (doesVoxelBlockLight(chunk->get(x, y, z))) break;
+
+                    const glm::ivec3 pos = origin + glm::ivec3(x, y, z);
+                    setLevel(propagation, *chunk, LightChannel::SKY, pos, LightArray::MAX_LEVEL);
+                    propagation.addQueues[SKY].push_back({pos, LightArray::MAX_LEVEL});
+                }
+            }
+        }
+
+        for (int y = 0; y < SIZE; ++y) {
+            for (int z = 0; z < SIZE; ++z) {
+                for (int x = 0; x < SIZE; ++x) {
+                    const uint8_t emission = getVoxelLightEmission(chunk->get(x, y, z));
+                    if (emission == 0 || chunk->getLightData().getBlock(x, y, z) >= emission) continue;
+
+                    const glm::ivec3 pos = origin + glm::ivec3(x, y, z);
+                    setLevel(propagation, *chunk, LightChannel::BLOCK, pos, emission);
+                    propagation.addQueues[BLOCK].push_back({pos, emission});
+                }
+            }
+        }
+
+        for (int dir = 0; dir < 6; ++dir) {
+            const glm::ivec3 offset = DirectionUtils::getOffset(static_cast<CubicDirection>(dir));
+            const Chunk *neighbor = chunkAt(propagation, origin + offset * SIZE);
+            if (!neighbor) continue;
+
+            // Cellule du chunk voisin collée à la face dir
+            for (int a = 0; a < SIZE; ++a) {
+                for (int b = 0; b < SIZE; ++b) {
+                    glm::ivec3 local;
+                    if (offset.x != 0) local = {offset.x > 0 ? SIZE : -1, a, b};
+                    else if (offset.y != 0) local = {a, offset.y > 0 ? SIZE : -1, b};
+                    else local = {a, b, offset.z > 0 ? SIZE : -1};
+
+                    const glm::ivec3 pos = origin + local;
+                    for (const LightChannel channel: CHANNELS) {
+                        const uint8_t level = getLevel(*neighbor, channel, pos);
+                        if (level > 1)
+                            propagation.addQueues[static_cast<int>(channel)].push_back({pos, level});
+                    }
+                }
+            }
+        }
+
+        // 5. Propagation
+        propagateAdditions(propagation, LightChannel::SKY);
+        propagateAdditions(propagation, LightChannel::BLOCK);
+    }
+
+    void LightEngine::updateVoxel(Propagation &propagation, const glm::ivec3 &worldPos) {
+        Chunk *chunk = chunkAt(propagation, worldPos);
+        if (!chunk) return;
+
+        const VoxelType voxel = chunk->get(toLocal(worldPos));
+
+        // Retirer la lumière qui passait par ce voxel
+        for (const LightChannel channel: CHANNELS) {
+            const uint8_t level = getLevel(*chunk, channel, worldPos);
+            if (level == 0) continue;
+
+            setLevel(propagation, *chunk, channel, worldPos, 0);
+            propagation.removeQueues[static_cast<int>(channel)].push_back({worldPos, level});
+        }
+
+        propagateRemovals(propagation, LightChannel::SKY);
+        propagateRemovals(propagation, LightChannel::BLOCK);
+
+        // Nouvelle source éventuelle (la propagation a pu changer de chunk en cache)
+        if (const uint8_t emission = getVoxelLightEmission(voxel); emission > 0) {
+            chunk = chunkAt(propagation, worldPos);
+            setLevel(propagation, *chunk, LightChannel::BLOCK, worldPos, emission);
+            propagation.addQueues[BLOCK].push_back({worldPos, emission});
+        }
+
+        // Voxel traversable : la lumière environnante peut y entrer
+        if (!doesVoxelBlockLight(voxel))
+            pullFromNeighbors(propagation, worldPos);
+
+        propagateAdditions(propagation, LightChannel::SKY);
+        propagateAdditions(propagation, LightChannel::BLOCK);
+    }
+
+    void LightEngine::propagateRemovals(Propagation &propagation, const LightChannel channel) {
+        auto &removeQueue = propagation.removeQueues[static_cast<int>(channel)];
+        auto &addQueue = propagation.addQueues[static_cast<int>(channel)];
+
+        while (!removeQueue.empty()) {
+            const LightNode node = removeQueue.front();
+            removeQueue.pop_front();
+
+            for (int dir = 0; dir < 6; ++dir) {
+                const auto direction = static_cast<CubicDirection>(dir);
+                const glm::ivec3 pos = node.pos + DirectionUtils::getOffset(direction);
+
+                Chunk *chunk = chunkAt(propagation, pos);
+                if (!chunk) continue;
+
+                const uint8_t level = getLevel(*chunk, channel, pos);
+                if (level == 0) continue;
+
+                // Lumière issue du noeud supprimé : on l'éteint à son tour
+                if (level < node.level || isSkyColumn(channel, direction, node.level)) {
+                    setLevel(propagation, *chunk, channel, pos, 0);
+                    removeQueue.push_back({pos, level});
+
+                    if (channel == LightChannel::BLOCK) {
+                        if (const uint8_t emission = getVoxelLightEmission(chunk->get(toLocal(pos))); emission > 0) {
+                            setLevel(propagation, *chunk, channel, pos, emission);
+                            addQueue.push_back({pos, emission});
+                        }
+                    }
+                } else {
+                    // Lumière provenant d'une autre source : elle rééclairera la zone
+                    addQueue.push_back({pos, level});
+                }
+            }
+        }
+    }
+
+    void LightEngine::propagateAdditions(Propagation &propagation, const LightChannel channel) {
+        auto &addQueue = propagation.addQueues[static_cast<int>(channel)];
+
+        while (!addQueue.empty()) {
+            const LightNode node = addQueue.front();
+            addQueue.pop_front();
+
+            const Chunk *chunk = chunkAt(propagation, node.pos);
+            if (!chunk) continue;
+
+            // Le niveau a pu changer depuis la mise en file
+            const uint8_t level = getLevel(*chunk, channel, node.pos);
+            if (level <= 1) continue;
+
+            for (int dir = 0; dir < 6; ++dir) {
+                const auto direction = static_cast<CubicDirection>(dir);
+                const glm::ivec3 pos = node.pos + DirectionUtils::getOffset(direction);
+
+                Chunk *neighbor = chunkAt(propagation, pos);
+                if (!neighbor || doesVoxelBlockLight(neighbor->get(toLocal(pos)))) continue;
+
+                const uint8_t newLevel = isSkyColumn(channel, direction, level) ? level : level - 1;
+                if (getLevel(*neighbor, channel, pos) >= newLevel) continue;
+
+                setLevel(propagation, *neighbor, channel, pos, newLevel);
+                addQueue.push_back({pos, newLevel});
+            }
+        }
+    }
+
+    Chunk *LightEngine::chunkAt(Propagation &propagation, const glm::ivec3 &worldPos) const {
+        const ChunkCoord coord = toChunk(worldPos);
+        if (propagation.hasCache && propagation.cachedCoord == coord)
+            return propagation.cachedChunk;
+
+        // Un seul verrou de lumière tenu à la fois : pas d'interblocage avec les lecteurs
+        if (propagation.lightLock.owns_lock()) propagation.lightLock.unlock();
+
+        Chunk *chunk = nullptr;
+        if (const auto it = propagation.chunks.find(coord); it != propagation.chunks.end()) {
+            chunk = it->second.get();
+        } else if (ash::Ref<Chunk> acquired = m_chunkManager.acquireChunk(coord)) {
+            chunk = acquired.get();
+            propagation.chunks.emplace(coord, std::move(acquired));
+        }
+
+        if (chunk) propagation.lightLock = chunk->lockLight();
+
+        propagation.cachedCoord = coord;
+        propagation.cachedChunk = chunk;
+        propagation.hasCache = true;
+        return chunk;
+    }
+
+    uint8_t LightEngine::getLevel(const Chunk &chunk, const LightChannel channel, const glm::ivec3 &worldPos) {
+        const glm::ivec3 local = toLocal(worldPos);
+        return channel == LightChannel::SKY
+                   ? chunk.getLightData().getSky(local.x, local.y, local.z)
+                   : chunk.getLightData().getBlock(local.x, local.y, local.z);
+    }
+
+    void LightEngine::setLevel(Propagation &propagation, Chunk &chunk, const LightChannel channel,
+                               const glm::ivec3 &worldPos, const uint8_t level) const {
+        const glm::ivec3 local = toLocal(worldPos);
+        if (channel == LightChannel::SKY)
+            chunk.getLightData().setSky(local.x, local.y, local.z, level);
+        else
+            chunk.getLightData().setBlock(local.x, local.y, local.z, level);
+
+        // Le mesh du chunk et celui des voisins qui partagent la face lisent cette valeur
+        const ChunkCoord coord = toChunk(worldPos);
+        propagation.touched.insert(coord);
+
+        constexpr int LAST = VoxelArray::SIZE - 1;
+        if (local.x == 0) propagation.touched.insert({coord.x - 1, coord.y, coord.z});
+        if (local.x == LAST) propagation.touched.insert({coord.x + 1, coord.y, coord.z});
+        if (local.y == 0) propagation.touched.insert({coord.x, coord.y - 1, coord.z});
+        if (local.y == LAST) propagation.touched.insert({coord.x, coord.y + 1, coord.z});
+        if (local.z == 0) propagation.touched.insert({coord.x, coord.y, coord.z - 1});
+        if (local.z == LAST) propagation.touched.insert({coord.x, coord.y, coord.z + 1});
+    }
+
+    void LightEngine::pullFromNeighbors(Propagation &propagation, const glm::ivec3 &worldPos) const {
+        for (int dir = 0; dir < 6; ++dir) {
+            const auto direction = static_cast<CubicDirection>(dir);
+            const glm::ivec3 pos = worldPos + DirectionUtils::getOffset(direction);
+
+            const Chunk *chunk = chunkAt(propagation, pos);
+            if (!chunk) {
+                // Rien de chargé au-dessus : ciel dégagé, comme pour l'éclairage initial
+                if (direction == CubicDirection::YP) {
+                    if (Chunk *self = chunkAt(propagation, worldPos)) {
+                        setLevel(propagation, *self, LightChannel::SKY, worldPos, LightArray::MAX_LEVEL);
+                        propagation.addQueues[SKY].push_back({worldPos, LightArray::MAX_LEVEL});
+                    }
+                }
+                continue;
+            }
+
+            for (const LightChannel channel: CHANNELS) {
+                const uint8_t level = getLevel(*chunk, channel, pos);
+                if (level > 0)
+                    propagation.addQueues[static_cast<int>(channel)].push_back({pos, level});
+            }
+        }
+    }
+}
@@ -0,0 +1,88 @@
+#include "Voxelity/voxelWorld/world/VoxelAccessor.h"
+
+#include <algorithm>
+
+#include "Voxelity/voxelWorld/world/World.h"
+
+namespace voxelity {
+    VoxelAccessor::VoxelAccessor(const World &world)
+        : m_world(world) {
+    }
+
+    VoxelType VoxelAccessor::get(const int x, const int y, const int z) {
+        const Chunk *chunk = getChunk({x >> VoxelArray::SHIFT, y >> VoxelArray::SHIFT, z >> VoxelArray::SHIFT});
+        if (!chunk) return VoxelID::AIR;
+
+        return chunk->get(x & VoxelArray::MASK, y & VoxelArray::MASK, z & VoxelArray::MASK);
+    }
+
+    const Chunk *VoxelAccessor::getChunk(const ChunkCoord &coord) {
+        int dx = coord.x - m_center.x + 1;
+        int dy = coord.y - m_center.y + 1;
+        int dz = coord.z - m_center.z + 1;
+
+        // Hors du voisinage : on se recentre sur le chunk demandé
+        if (!m_hasCenter || static_cast<unsigned>(dx) >= NEIGHBORHOOD ||
+            static_cast<unsigned>(dy) >= NEIGHBORHOOD || static_cast<unsigned>(dz) >= NEIGHBORHOOD) {
+            recenter(coord);
+            dx = dy = dz = 1;
+        }
+
+        const int slot = dx + NEIGHBORHOOD * (dz + NEIGHBORHOOD * dy);
+        if (!(m_fetched & 1u << slot)) {
+            m_chunks[slot] = m_world.getChunk(coord);
+            m_fetched |= 1u << slot;
+        }
+
+        return m_chunks[slot];
+    }
+
+    void VoxelAccessor::copyRegion(const glm::ivec3 &min, const glm::ivec3 &max, VoxelType *dst) {
+        const size_t rowStride = static_cast<size_t>(max.x - min.x + 1);
+        const size_t layerStride = rowStride * static_cast<size_t>(max.z - min.z + 1);
+
+        for (int cy = min.y >> VoxelArray::SHIFT; cy <= max.y >> VoxelArray::SHIFT; ++cy) {
+            for (int cz = min.z >> VoxelArray::SHIFT; cz <= max.z >> VoxelArray::SHIFT; ++cz) {
+                for (int cx = min.x >> VoxelArray::SHIFT; cx <= max.x >> VoxelArray::SHIFT; ++cx) {
+                    // Partie de la région couverte par ce chunk, en coordonnées monde
+                    const int x0 = std::max(min.x, cx << VoxelArray::SHIFT);
+                    const int y0 = std::max(min.y, cy << VoxelArray::SHIFT);
+                    const int z0 = std::max(min.z, cz << VoxelArray::SHIFT);
+                    const int x1 = std::min(max.x, (cx << VoxelArray::SHIFT) + VoxelArray::MASK);
+                    const int y1 = std::min(max.y, (cy << VoxelArray::SHIFT) + VoxelArray::MASK);
+                    const int z1 = std::min(max.z, (cz << VoxelArray::SHIFT) + VoxelArray::MASK);
+
+                    VoxelType *out = dst + static_cast<size_t>(x0 - min.x) +
+                                     static_cast<size_t>(z0 - min.z) * rowStride +
+                                     static_cast<size_t>(y0 - min.y) * layerStride;
+
+                    if (const Chunk *chunk = getChunk({cx, cy, cz})) {
+                        chunk->copyRegion({x0 & VoxelArray::MASK, y0 & VoxelArray::MASK, z0 & VoxelArray::MASK},
+                                          {x1 & VoxelArray::MASK, y1 & VoxelArray::MASK, z1 & VoxelArray::MASK},
+                                          out, rowStride, layerStride);
+                        continue;
+                    }
+
+                    for (int y = y0; y <= y1; ++y) {
+                        for (int z = z0; z <= z1; ++z) {
+                            VoxelType *row = out + static_cast<size_t>(z - z0) * rowStride +
+                                             static_cast<size_t>(y - y0) * layerStride;
+                            std::fill_n(row, x1 - x0 + 1, VoxelID::AIR);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void VoxelAccessor::invalidate() {
+        m_hasCenter = false;
+        m_fetched = 0;
+    }
+
+    void VoxelAccessor::recenter(const ChunkCoord &coord) {
+        m_center = coord;
+        m_hasCenter = true;
+        m_fetched = 0;
+    }
+}
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 
+#include "Voxelity/voxelWorld/world/VoxelAccessor.h"
 #include "Voxelity/voxelWorld/world/World.h"
 
 namespace voxelity {
@@ -55,6 +56,9 @@ namespace voxelity {
             sideDist.z = (float(mapPos.z + 1) - origin.z) * deltaDist.z;
         }
 
+        // Le rayon traverse des cellules voisines : les chunks restent en cache
+        VoxelAccessor voxels(m_world);
+
         // Variables pour tracker quelle face a été touchée
         int side = 0; // 0=X, 1=Y, 2=Z
         glm::ivec3 previousPos = mapPos;
@@ -62,7 +66,7 @@ namespace voxelity {
         // Algorithme DDA principal
         while (true) {
             // Vérifier si on a touché un bloc solide
-            if (isBlockSolid(mapPos)) {
+            if (isBlockSolid(voxels, mapPos)) {
                 // Calculer la distance
                 float distance = 0.0f;
                 glm::vec3 hitPoint;
@@ -130,8 +134,8 @@ namespace voxelity {
         return std::nullopt;
     }
 
-    bool VoxelRaycaster::isBlockSolid(const glm::ivec3 &pos) const {
-        return m_world.getVoxel(pos.x, pos.y, pos.z) != 0;
+    bool VoxelRaycaster::isBlockSolid(VoxelAccessor &voxels, const glm::ivec3 &pos) {
+        return voxels.get(pos) != 0;
     }
 
     glm::ivec3 VoxelRaycaster::calculateFaceNormal(const glm::ivec3 &blockPos,
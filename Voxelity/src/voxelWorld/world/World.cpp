@@ -1,12 +1,24 @@
 #include "Voxelity/voxelWorld/world/World.h"
 
+#include <algorithm>
+#include <stdexcept>
+
 #include "Voxelity/voxelWorld/generation/ITerrainGenerator.h"
+#include "Voxelity/voxelWorld/storage/RegionStorage.h"
+#include "Voxelity/voxelWorld/tick/BlockTicker.h"
+#include "Voxelity/voxelWorld/tick/FluidSimulator.h"
+#include "Voxelity/voxelWorld/utils/DirectionUtils.h"
+#include "Voxelity/voxelWorld/world/LightEngine.h"
 
 namespace voxelity {
     World::World(ash::Own<ITerrainGenerator> generator)
-        : m_chunkManager(std::make_unique<ChunkManager>(std::move(generator))) {
+        : m_chunkManager(std::make_unique<ChunkManager>(std::move(generator))),
+          m_blockTicker(std::make_unique<BlockTicker>(*this)),
+          m_fluidSimulator(std::make_unique<FluidSimulator>(*this)) {
     }
 
+    World::~World() = default;
+
     VoxelType World::getVoxel(const int worldX, const int worldY, const int worldZ) const {
         const ChunkCoord chunkCoord = toChunkCoord(worldX, worldY, worldZ);
         const ash::IVec3 localPos = toLocalCoord(worldX, worldY, worldZ);
@@ -26,7 +38,7 @@ namespace voxelity {
         const ChunkCoord chunkCoord = toChunkCoord(worldX, worldY, worldZ);
         const ash::IVec3 localPos = toLocalCoord(worldX, worldY, worldZ);
 
-        Chunk *chunk = m_chunkManager->getOrCreateChunk(chunkCoord);
+        Chunk *chunk = m_chunkManager->getEditableChunk(chunkCoord);
         if (!chunk) return;
 
         const VoxelType oldType = chunk->get(localPos.x, localPos.y, localPos.z);
@@ -34,17 +46,254 @@ namespace voxelity {
 
         chunk->set(localPos.x, localPos.y, localPos.z, type);
 
+        // Mise à jour incrémentale de la lumière (asynchrone)
+        m_chunkManager->getLightEngine().enqueueVoxelChange({worldX, worldY, worldZ});
+
         // Marquer le chunk pour reconstruction de mesh
         m_chunkManager->markChunkForMeshRebuild(chunkCoord);
 
         // Marquer les chunks voisins si on est sur un bord
         markNeighborChunksDirty(chunkCoord, localPos);
+
+        m_blockTicker->notifyNeighbors({worldX, worldY, worldZ});
+        m_fluidSimulator->activate({worldX, worldY, worldZ});
+        notifyVoxelChange({{worldX, worldY, worldZ}, {worldX, worldY, worldZ}});
     }
 
     void World::setVoxel(const ash::IVec3 &worldPos, const VoxelType type) {
         setVoxel(worldPos.x, worldPos.y, worldPos.z, type);
     }
 
+    size_t World::setVoxels(const std::span<const VoxelEdit> edits) {
+        return applyEdits(edits, true);
+    }
+
+    size_t World::applySimulationEdits(const std::span<const VoxelEdit> edits) {
+        return applyEdits(edits, false);
+    }
+
+    size_t World::applyEdits(const std::span<const VoxelEdit> edits, const bool notifyCells) {
+        if (edits.empty()) return 0;
+
+        // Regroupement par chunk
+        ash::HashMap<ChunkCoord, ash::Vector<LocalVoxelEdit> > editsByChunk;
+        for (const auto &[position, type]: edits) {
+            const ash::IVec3 localPos = toLocalCoord(position);
+            editsByChunk[toChunkCoord(position)].push_back({
+                static_cast<uint8_t>(localPos.x), static_cast<uint8_t>(localPos.y),
+                static_cast<uint8_t>(localPos.z), type
+            });
+        }
+
+        // Seules les cellules réellement modifiées déclenchent lumière, ticks et réveils
+        ash::HashSet<ChunkCoord> rebuilds;
+        ash::Vector<std::pair<ChunkCoord, ChunkEditResult> > touched;
+        ash::Vector<ash::IVec3> changed;
+        ash::Vector<ash::IVec3> incrementalLight;
+        ash::Vector<ChunkCoord> relights;
+        ash::Vector<LocalVoxelEdit> applied;
+        size_t dropped = 0;
+        for (const auto &[coord, chunkEdits]: editsByChunk) {
+            Chunk *chunk = m_chunkManager->getEditableChunk(coord);
+            if (!chunk) {
+                dropped += chunkEdits.size();
+                continue;
+            }
+
+            applied.clear();
+            const ChunkEditResult result = chunk->setVoxels(chunkEdits, &applied);
+            if (!result.changed()) continue;
+
+            collectRebuilds(coord, result, rebuilds);
+            touched.emplace_back(coord, result);
+
+            // Peu de cellules dans ce chunk : mise à jour incrémentale voxel par voxel, sinon ré-éclairage du chunk
+            const bool incremental = applied.size() <= INCREMENTAL_LIGHT_EDIT_LIMIT;
+            if (!incremental) relights.push_back(coord);
+
+            const ash::IVec3 origin = toWorldPos({coord.x, coord.y, coord.z});
+            for (const auto &[x, y, z, type]: applied) {
+                changed.push_back(origin + ash::IVec3(x, y, z));
+                if (incremental) incrementalLight.push_back(changed.back());
+            }
+        }
+
+        // Lumière demandée une fois toutes les modifications posées
+        for (const auto &position: incrementalLight)
+            m_chunkManager->getLightEngine().enqueueVoxelChange(position);
+        for (const auto &coord: relights)
+            m_chunkManager->getLightEngine().enqueueRelight(coord);
+
+        flushRebuilds(rebuilds);
+
+        if (notifyCells) {
+            for (const auto &position: changed) {
+                m_blockTicker->notifyNeighbors(position);
+                m_fluidSimulator->activate(position);
+            }
+        }
+
+        // Une boîte par chunk, englobant ses cellules modifiées
+        for (const auto &[coord, result]: touched) {
+            const ash::IVec3 origin = toWorldPos({coord.x, coord.y, coord.z});
+            const ash::BBox3i box{origin + result.min, origin + result.max};
+            if (!notifyCells) m_blockTicker->notifyRegion(box);
+            notifyVoxelChange(box);
+        }
+        return dropped;
+    }
+
+    void World::fillBox(const ash::BBox3i &box, const VoxelType type) {
+        ash::HashSet<ChunkCoord> rebuilds;
+        forEachChunkInBox(box, [&](const ChunkCoord &coord, Chunk &chunk, const ash::IVec3 &localMin,
+                                   const ash::IVec3 &localMax, const ash::IVec3 &) {
+            const ChunkEditResult result = chunk.editRegion(localMin, localMax, [type](int, int, int, VoxelType) {
+                return type;
+            });
+            collectRebuilds(coord, result, rebuilds);
+            relightEditedChunk(coord, result);
+        });
+
+        flushRebuilds(rebuilds);
+
+        // Les liquides, les blocs qui tombent et les corps endormis au contact de la zone modifiée repartent
+        if (!rebuilds.empty()) {
+            m_fluidSimulator->activateBox(box);
+            m_blockTicker->notifyRegion(box);
+            notifyVoxelChange(box);
+        }
+    }
+
+    void World::fillSphere(const ash::IVec3 &center, const int radius, const VoxelType type) {
+        if (radius < 0) return;
+
+        const int radiusSq = radius * radius;
+        const ash::BBox3i box{center - ash::IVec3(radius), center + ash::IVec3(radius)};
+
+        ash::HashSet<ChunkCoord> rebuilds;
+        forEachChunkInBox(box, [&](const ChunkCoord &coord, Chunk &chunk, const ash::IVec3 &localMin,
+                                   const ash::IVec3 &localMax, const ash::IVec3 &origin) {
+            const ash::IVec3 offset = origin - center;
+            const ChunkEditResult result = chunk.editRegion(localMin, localMax,
+                                                            [&](const int x, const int y, const int z,
+                                                                const VoxelType current) {
+                                                                const int dx = offset.x + x;
+                                                                const int dy = offset.y + y;
+                                                                const int dz = offset.z + z;
+                                                                return dx * dx + dy * dy + dz * dz <= radiusSq
+                                                                           ? type
+                                                                           : current;
+                                                            });
+            collectRebuilds(coord, result, rebuilds);
+            relightEditedChunk(coord, result);
+        });
+
+        flushRebuilds(rebuilds);
+        if (!rebuilds.empty()) {
+            m_fluidSimulator->activateBox(box);
+            m_blockTicker->notifyRegion(box);
+            notifyVoxelChange(box);
+        }
+    }
+
+    void World::replace(const ash::BBox3i &box, const VoxelType from, const VoxelType to) {
+        if (from == to) return;
+
+        ash::HashSet<ChunkCoord> rebuilds;
+        forEachChunkInBox(box, [&](const ChunkCoord &coord, Chunk &chunk, const ash::IVec3 &localMin,
+                                   const ash::IVec3 &localMax, const ash::IVec3 &) {
+            const ChunkEditResult result = chunk.editRegion(localMin, localMax,
+                                                            [from, to](int, int, int, const VoxelType current) {
+                                                                return current == from ? to : current;
+                                                            });
+            collectRebuilds(coord, result, rebuilds);
+            relightEditedChunk(coord, result);
+        });
+
+        flushRebuilds(rebuilds);
+        if (!rebuilds.empty()) {
+            m_fluidSimulator->activateBox(box);
+            m_blockTicker->notifyRegion(box);
+            notifyVoxelChange(box);
+        }
+    }
+
+    void World::copyRegion(const ash::BBox3i &box, const std::span<VoxelType> out, const VoxelType fill) const {
+        const size_t volume = getRegionVolume(box);
+        if (volume == 0) return;
+        if (out.size() < volume)
+            throw std::invalid_argument("copyRegion: buffer too small for region");
+
+        const ash::IVec3 size = box.max - box.min + 1;
+        const size_t rowStride = size.x;
+        const size_t layerStride = rowStride * size.z;
+
+        const ash::IVec3 minChunk = toChunkCoord(box.min);
+        const ash::IVec3 maxChunk = toChunkCoord(box.max);
+
+        for (int cy = minChunk.y; cy <= maxChunk.y; ++cy) {
+            for (int cz = minChunk.z; cz <= maxChunk.z; ++cz) {
+                for (int cx = minChunk.x; cx <= maxChunk.x; ++cx) {
+                    const ash::IVec3 origin = toWorldPos({cx, cy, cz});
+                    const ash::IVec3 localMin = glm::max(box.min - origin, ash::IVec3(0));
+                    const ash::IVec3 localMax = glm::min(box.max - origin, ash::IVec3(VoxelArray::SIZE - 1));
+
+                    const ash::IVec3 offset = origin + localMin - box.min;
+                    VoxelType *dst = out.data() + offset.x + rowStride * offset.z + layerStride * offset.y;
+
+                    if (const Chunk *chunk = getChunk(cx, cy, cz)) {
+                        chunk->copyRegion(localMin, localMax, dst, rowStride, layerStride);
+                        continue;
+                    }
+
+                    // Chunk absent : lignes remplies avec la valeur par défaut
+                    const int rowLength = localMax.x - localMin.x + 1;
+                    for (int y = 0; y <= localMax.y - localMin.y; ++y) {
+                        for (int z = 0; z <= localMax.z - localMin.z; ++z) {
+                            VoxelType *row = dst + layerStride * y + rowStride * z;
+                            std::fill_n(row, rowLength, fill);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void World::pasteRegion(const ash::BBox3i &box, const std::span<const VoxelType> voxels) {
+        const size_t volume = getRegionVolume(box);
+        if (volume == 0) return;
+        if (voxels.size() < volume)
+            throw std::invalid_argument("pasteRegion: buffer too small for region");
+
+        const ash::IVec3 size = box.max - box.min + 1;
+        const size_t rowStride = size.x;
+        const size_t layerStride = rowStride * size.z;
+
+        ash::HashSet<ChunkCoord> rebuilds;
+        forEachChunkInBox(box, [&](const ChunkCoord &coord, Chunk &chunk, const ash::IVec3 &localMin,
+                                   const ash::IVec3 &localMax, const ash::IVec3 &origin) {
+            const ash::IVec3 offset = origin + localMin - box.min;
+            const VoxelType *src = voxels.data() + offset.x + rowStride * offset.z + layerStride * offset.y;
+            const ChunkEditResult result = chunk.pasteRegion(localMin, localMax, src, rowStride, layerStride);
+            collectRebuilds(coord, result, rebuilds);
+            relightEditedChunk(coord, result);
+        });
+
+        flushRebuilds(rebuilds);
+        if (!rebuilds.empty()) {
+            m_fluidSimulator->activateBox(box);
+            m_blockTicker->notifyRegion(box);
+            notifyVoxelChange(box);
+        }
+    }
+
+    size_t World::getRegionVolume(const ash::BBox3i &box) {
+        const ash::IVec3 size = box.max - box.min + 1;
+        if (size.x <= 0 || size.y <= 0 || size.z <= 0) return 0;
+
+        return static_cast<size_t>(size.x) * size.y * size.z;
+    }
+
     Chunk *World::getChunk(const ChunkCoord &coord) const {
         return m_chunkManager->getChunk(coord);
     }
@@ -60,6 +309,9 @@ namespace voxelity {
     void World::processChunkLoading() const {
         // Récupérer les chunks générés par les threads
         m_chunkManager->processCompletedGeneration();
+
+        // Meshes en attente de lumière
+        m_chunkManager->processLighting();
     }
 
     void World::processMeshBuilding() const {
@@ -67,6 +319,31 @@ namespace voxelity {
         m_chunkManager->processCompletedMeshes();
     }
 
+    void World::enablePersistence(const std::filesystem::path &directory) const {
+        m_chunkManager->setStorage(std::make_unique<RegionStorage>(directory));
+    }
+
+    void World::save() const {
+        m_chunkManager->saveAll();
+    }
+
+    bool World::requestSave() const {
+        return m_chunkManager->requestSave();
+    }
+
+    bool World::isSaving() const {
+        return m_chunkManager->isSaving();
+    }
+
+    WorldSaveStats World::getLastSaveStats() const {
+        return m_chunkManager->getLastSaveStats();
+    }
+
+    void World::tick() {
+        m_blockTicker->tick();
+        m_fluidSimulator->tick();
+    }
+
     void World::forEachChunk(const std::function < void(const ChunkCoord &, Chunk *) > &func)
     const
  {
@@ -79,10 +356,8 @@ namespace voxelity {
     }
 
     ash::IVec3 World::toChunkCoord(const int x, const int y, const int z) {
-        auto divFloor = [](const int v) {
-            return v >= 0 ? v / VoxelArray::SIZE : (v - VoxelArray::SIZE + 1) / VoxelArray::SIZE;
-        };
-        return {divFloor(x), divFloor(y), divFloor(z)};
+        // Décalage arithmétique = division entière arrondie vers -infini
+        return {x >> VoxelArray::SHIFT, y >> VoxelArray::SHIFT, z >> VoxelArray::SHIFT};
     }
 
     ash::IVec3 World::toChunkCoord(const ash::IVec3 &worldPos) {
@@ -90,10 +365,7 @@ namespace voxelity {
     }
 
     ash::IVec3 World::toLocalCoord(const int x, const int y, const int z) {
-        auto mod = [](const int v) {
-            return (v % VoxelArray::SIZE + VoxelArray::SIZE) % VoxelArray::SIZE;
-        };
-        return {mod(x), mod(y), mod(z)};
+        return {x & VoxelArray::MASK, y & VoxelArray::MASK, z & VoxelArray::MASK};
     }
 
     ash::IVec3 World::toLocalCoord(const ash::IVec3 &position) {
@@ -120,7 +392,13 @@ namespace voxelity {
         return m_chunkManager->getPendingMeshCount();
     }
 
+    size_t World::getPendingLightCount() const {
+        return m_chunkManager->getLightEngine().getPendingJobCount();
+    }
+
     void World::clear() const {
+        m_blockTicker->clear();
+        m_fluidSimulator->clear();
         m_chunkManager->clear();
     }
 
@@ -144,4 +422,35 @@ namespace voxelity {
         if (localPos.z == 0) checkNeighbor(localPos.x, localPos.y, localPos.z, 0, 0, -1);
         if (localPos.z == VoxelArray::SIZE - 1) checkNeighbor(localPos.x, localPos.y, localPos.z, 0, 0, 1);
     }
-}
\ No newline at end of file
+
+    void World::collectRebuilds(const ChunkCoord &coord, const ChunkEditResult &result,
+                                ash::HashSet<ChunkCoord> &rebuilds) const {
+        if (!result.changed()) return;
+
+        rebuilds.insert(coord);
+
+        // Voisins dont la face commune a été modifiée
+        for (int dir = 0; dir < 6; ++dir) {
+            if (!(result.borderMask & 1 << dir)) continue;
+
+            const ash::IVec3 offset = DirectionUtils::getOffset(static_cast<CubicDirection>(dir));
+            const ChunkCoord neighborCoord{coord.x + offset.x, coord.y + offset.y, coord.z + offset.z};
+            if (getChunk(neighborCoord))
+                rebuilds.insert(neighborCoord);
+        }
+    }
+
+    void World::relightEditedChunk(const ChunkCoord &coord, const ChunkEditResult &result) const {
+        if (result.changed())
+            m_chunkManager->getLightEngine().enqueueRelight(coord);
+    }
+
+    void World::flushRebuilds(const ash::HashSet<ChunkCoord> &rebuilds) const {
+        for (const auto &coord: rebuilds)
+            m_chunkManager->markChunkForMeshRebuild(coord);
+    }
+
+    void World::notifyVoxelChange(const ash::BBox3i &box) const {
+        if (m_voxelChangeListener) m_voxelChangeListener(box);
+    }
+}
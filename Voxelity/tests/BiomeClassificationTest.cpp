@@ -0,0 +1,61 @@
+#include "Check.h"
+#include "ReferenceColumn.h"
+
+#include "Voxelity/voxelWorld/generation/NaturalTerrainGenerator.h"
+
+using namespace voxelity;
+
+namespace {
+    constexpr int CLIMATE_GRID_STEP = NaturalTerrainGenerator::CLIMATE_GRID_STEP;
+
+    // buildColumn (climat interpolé sur une grille grossière, table de biomes, calcul en float) contre
+    // l'ancien calcul exact, sur 16 × 16 colonnes de chunks à partir de origin. Les colonnes dont la hauteur
+    // diffère (arrondi float / double) sont comptées à part : leur biome peut légitimement changer
+    void testBiomeBoundariesStayStable(NaturalTerrainGenerator &generator, test::ReferenceColumnBuilder &referenceBuilder,
+                                       const ColumnCoord origin) {
+        size_t compared = 0;
+        size_t heightDifferences = 0;
+        size_t mismatches = 0;
+        size_t gridMismatches = 0;
+        for (int cz = origin.z; cz < origin.z + 16; ++cz) {
+            for (int cx = origin.x; cx < origin.x + 16; ++cx) {
+                ColumnData column;
+                ColumnData reference;
+                column.coord = reference.coord = {cx, cz};
+                generator.buildColumn(column);
+                referenceBuilder.build(reference);
+
+                for (int z = 0; z < VoxelArray::SIZE; ++z) {
+                    for (int x = 0; x < VoxelArray::SIZE; ++x) {
+                        if (column.getHeight(x, z) != reference.getHeight(x, z)) {
+                            ++heightDifferences;
+                            continue;
+                        }
+
+                        ++compared;
+                        if (column.getBiome(x, z) == reference.getBiome(x, z)) continue;
+
+                        ++mismatches;
+                        // Sur les points de la grille, rien n'est interpolé : seule la table peut se tromper
+                        if (x % CLIMATE_GRID_STEP == 0 && z % CLIMATE_GRID_STEP == 0) ++gridMismatches;
+                    }
+                }
+            }
+        }
+
+        CHECK(compared > 0);
+        CHECK(heightDifferences * 1000 <= compared); // Au plus 0,1 %
+        CHECK(mismatches * 100 <= compared); // Frontières déplacées sur au plus 1 % des colonnes
+        CHECK_EQ(gridMismatches, 0u);
+        if (mismatches * 100 > compared)
+            std::cerr << "area (" << origin.x << ", " << origin.z << "): " << mismatches << " of " << compared << " columns changed biome\n";
+    }
+}
+
+int main() {
+    NaturalTerrainGenerator generator(12345);
+    test::ReferenceColumnBuilder referenceBuilder;
+    testBiomeBoundariesStayStable(generator, referenceBuilder, {-8, -8});
+    testBiomeBoundariesStayStable(generator, referenceBuilder, {700, -1300});
+    return test::result();
+}
@@ -0,0 +1,42 @@
+#ifndef VOXELITY_CHECK_H
+#define VOXELITY_CHECK_H
+
+#include <iostream>
+
+// Vérifications des tests : un échec est affiché puis compté, le test continue jusqu'au bout.
+// main se termine par return voxelity::test::result();
+namespace voxelity::test {
+    inline int &failureCount() {
+        static int count = 0;
+        return count;
+    }
+
+    inline bool check(const bool passed, const char *expression, const char *file, const int line) {
+        if (!passed) {
+            std::cerr << file << ":" << line << ": check failed: " << expression << "\n";
+            ++failureCount();
+        }
+        return passed;
+    }
+
+    template<typename A, typename B>
+    bool checkEqual(const A &actual, const B &expected, const char *expression, const char *file, const int line) {
+        if (actual == expected) return true;
+
+        std::cerr << file << ":" << line << ": check failed: " << expression << " (" << +actual << " != "
+                << +expected << ")\n";
+        ++failureCount();
+        return false;
+    }
+
+    inline int result() {
+        if (failureCount() > 0) std::cerr << failureCount() << " check(s) failed\n";
+        return failureCount() > 0 ? 1 : 0;
+    }
+}
+
+#define CHECK(expression) ::voxelity::test::check(static_cast<bool>(expression), #expression, __FILE__, __LINE__)
+#define CHECK_EQ(actual, expected) \
+    ::voxelity::test::checkEqual((actual), (expected), #actual " == " #expected, __FILE__, __LINE__)
+
+#endif //VOXELITY_CHECK_H
@@ -0,0 +1,113 @@
+#include "Check.h"
+
+#include "Voxelity/voxelWorld/render/ChunkOcclusionCuller.h"
+#include "Voxelity/voxelWorld/utils/DirectionUtils.h"
+
+using namespace voxelity;
+
+namespace {
+    constexpr int ZP = static_cast<int>(CubicDirection::ZP);
+    constexpr int ZN = static_cast<int>(CubicDirection::ZN);
+    constexpr int XP = static_cast<int>(CubicDirection::XP);
+    constexpr int XN = static_cast<int>(CubicDirection::XN);
+
+    constexpr int WORLD_RADIUS = 4;
+
+    // Cube de chunks opaques autour de l'origine ; le chunk de la caméra est vide
+    struct TestWorld {
+        ash::HashMap<ChunkCoord, ChunkVisibility> chunks;
+
+        TestWorld() {
+            for (int y = -WORLD_RADIUS; y <= WORLD_RADIUS; ++y) {
+                for (int z = -WORLD_RADIUS; z <= WORLD_RADIUS; ++z) {
+                    for (int x = -WORLD_RADIUS; x <= WORLD_RADIUS; ++x)
+                        chunks[ChunkCoord(x, y, z)] = ChunkVisibility::none();
+                }
+            }
+            chunks[ChunkCoord(0, 0, 0)] = ChunkVisibility();
+        }
+
+        void connect(const ChunkCoord &coord, const int from, const int to) {
+            chunks[coord].setConnected(from, to);
+        }
+
+        ChunkOcclusionCuller::VisibilityLookup lookup() const {
+            return [this](const ChunkCoord &coord) -> const ChunkVisibility * {
+                const auto it = chunks.find(coord);
+                return it != chunks.end() ? &it->second : nullptr;
+            };
+        }
+    };
+
+    void testMissingStartCullsNothing() {
+        const TestWorld world;
+        ChunkOcclusionCuller culler;
+        CHECK(!culler.update(ChunkCoord(100, 0, 0), world.lookup()));
+        CHECK_EQ(culler.getVisibleCount(), 0u);
+    }
+
+    void testSealedNeighborsStopTraversal() {
+        // Les six voisins opaques sont vus (leurs faces tournées vers la caméra), rien au-delà
+        const TestWorld world;
+        ChunkOcclusionCuller culler;
+        CHECK(culler.update(ChunkCoord(0, 0, 0), world.lookup()));
+        CHECK_EQ(culler.getVisibleCount(), 7u);
+        CHECK(culler.isVisible(ChunkCoord(1, 0, 0)));
+        CHECK(!culler.isVisible(ChunkCoord(2, 0, 0)));
+        CHECK(!culler.isVisible(ChunkCoord(1, 1, 0)));
+    }
+
+    void testStraightTunnelIsFollowed() {
+        TestWorld world;
+        for (int x = 1; x < WORLD_RADIUS; ++x)
+            world.connect(ChunkCoord(x, 0, 0), XN, XP);
+
+        ChunkOcclusionCuller culler;
+        culler.update(ChunkCoord(0, 0, 0), world.lookup());
+
+        // Tout le tunnel, plus le chunk opaque qui le ferme
+        for (int x = 1; x <= WORLD_RADIUS; ++x)
+            CHECK(culler.isVisible(ChunkCoord(x, 0, 0)));
+
+        // Les parois du tunnel ne sont pas reliées à son axe
+        CHECK(!culler.isVisible(ChunkCoord(2, 1, 0)));
+        CHECK(!culler.isVisible(ChunkCoord(2, 0, 1)));
+        CHECK_EQ(culler.getVisibleCount(), 7u + WORLD_RADIUS - 1);
+    }
+
+    void testNoTurningBack() {
+        // +X, puis +Z deux fois : revenir vers -X ensuite ferait demi-tour par rapport au premier pas
+        TestWorld world;
+        world.connect(ChunkCoord(1, 0, 0), XN, ZP);
+        world.connect(ChunkCoord(1, 0, 1), ZN, ZP);
+        world.connect(ChunkCoord(1, 0, 2), ZN, XN);
+        world.connect(ChunkCoord(1, 0, 2), ZN, XP);
+
+        ChunkOcclusionCuller culler;
+        culler.update(ChunkCoord(0, 0, 0), world.lookup());
+
+        CHECK(culler.isVisible(ChunkCoord(1, 0, 2)));
+        CHECK(culler.isVisible(ChunkCoord(2, 0, 2))); // Toujours vers l'avant : vu
+        CHECK(!culler.isVisible(ChunkCoord(0, 0, 2))); // Retour vers la caméra : écarté
+    }
+
+    void testOpenWorldReachesEverything() {
+        TestWorld world;
+        for (auto &[coord, visibility]: world.chunks)
+            visibility = ChunkVisibility();
+
+        ChunkOcclusionCuller culler;
+        culler.update(ChunkCoord(0, 0, 0), world.lookup());
+        CHECK_EQ(culler.getVisibleCount(), world.chunks.size());
+    }
+}
+
+int main() {
+    testMissingStartCullsNothing();
+    testSealedNeighborsStopTraversal();
+    testStraightTunnelIsFollowed();
+    testNoTurningBack();
+    testOpenWorldReachesEverything();
+
+    return voxelity::test::result();
+}
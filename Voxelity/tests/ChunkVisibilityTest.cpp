@@ -0,0 +1,128 @@
+#include "Check.h"
+
+#include "Voxelity/voxelWorld/chunk/ChunkVisibility.h"
+#include "Voxelity/voxelWorld/utils/DirectionUtils.h"
+
+using namespace voxelity;
+
+namespace {
+    constexpr int ZP = static_cast<int>(CubicDirection::ZP);
+    constexpr int ZN = static_cast<int>(CubicDirection::ZN);
+    constexpr int XP = static_cast<int>(CubicDirection::XP);
+    constexpr int XN = static_cast<int>(CubicDirection::XN);
+    constexpr int YP = static_cast<int>(CubicDirection::YP);
+    constexpr int YN = static_cast<int>(CubicDirection::YN);
+
+    int countConnections(const ChunkVisibility &visibility) {
+        int count = 0;
+        for (int from = 0; from < ChunkVisibility::FACE_COUNT; ++from) {
+            for (int to = 0; to < ChunkVisibility::FACE_COUNT; ++to)
+                count += visibility.isConnected(from, to);
+        }
+        return count;
+    }
+
+    void testSolidChunkIsSealed() {
+        VoxelArray voxels;
+        voxels.fill(VoxelID::STONE);
+
+        const ChunkVisibility visibility = ChunkVisibility::compute(voxels);
+        CHECK(visibility.isOpaque());
+        CHECK_EQ(countConnections(visibility), 0);
+    }
+
+    void testHollowChunkIsSealed() {
+        // Grotte fermée : de l'air à l'intérieur, aucune ouverture sur les bords
+        VoxelArray voxels;
+        voxels.fill(VoxelID::STONE);
+        for (int y = 4; y < 28; ++y) {
+            for (int z = 4; z < 28; ++z) {
+                for (int x = 4; x < 28; ++x)
+                    voxels.set(x, y, z, VoxelID::AIR);
+            }
+        }
+
+        CHECK_EQ(countConnections(ChunkVisibility::compute(voxels)), 0);
+    }
+
+    void testAirChunkConnectsEverything() {
+        VoxelArray voxels;
+        voxels.fill(VoxelID::AIR);
+        CHECK_EQ(countConnections(ChunkVisibility::compute(voxels)), 36);
+    }
+
+    void testStraightTunnel() {
+        VoxelArray voxels;
+        voxels.fill(VoxelID::STONE);
+        for (int x = 0; x < VoxelArray::SIZE; ++x)
+            voxels.set(x, 5, 9, VoxelID::AIR);
+
+        const ChunkVisibility visibility = ChunkVisibility::compute(voxels);
+        CHECK(visibility.isConnected(XP, XN));
+        CHECK(visibility.isConnected(XN, XP));
+        CHECK(!visibility.isConnected(XP, YP));
+        CHECK(!visibility.isConnected(ZP, ZN));
+        CHECK(!visibility.isConnected(YP, YN));
+    }
+
+    void testBentTunnel() {
+        // Entre par -X, remonte vers +Y au milieu du chunk
+        VoxelArray voxels;
+        voxels.fill(VoxelID::STONE);
+        for (int x = 0; x <= 16; ++x)
+            voxels.set(x, 10, 10, VoxelID::AIR);
+        for (int y = 10; y < VoxelArray::SIZE; ++y)
+            voxels.set(16, y, 10, VoxelID::AIR);
+
+        const ChunkVisibility visibility = ChunkVisibility::compute(voxels);
+        CHECK(visibility.isConnected(XN, YP));
+        CHECK(!visibility.isConnected(XN, XP));
+        CHECK(!visibility.isConnected(YP, YN));
+    }
+
+    void testSeparateTunnelsStayApart() {
+        // Un tunnel selon X et un selon Z, sans se croiser : X et Z ne sont pas reliés
+        VoxelArray voxels;
+        voxels.fill(VoxelID::STONE);
+        for (int i = 0; i < VoxelArray::SIZE; ++i) {
+            voxels.set(i, 4, 4, VoxelID::AIR);
+            voxels.set(20, 24, i, VoxelID::AIR);
+        }
+
+        const ChunkVisibility visibility = ChunkVisibility::compute(voxels);
+        CHECK(visibility.isConnected(XP, XN));
+        CHECK(visibility.isConnected(ZP, ZN));
+        CHECK(!visibility.isConnected(XP, ZP));
+        CHECK(!visibility.isConnected(XN, ZN));
+    }
+
+    void testTransparentVoxelsLetSightThrough() {
+        VoxelArray voxels;
+        voxels.fill(VoxelID::STONE);
+        for (int y = 0; y < VoxelArray::SIZE; ++y)
+            voxels.set(3, y, 3, y < 16 ? VoxelID::WATER : VoxelID::GLASS);
+
+        CHECK(ChunkVisibility::compute(voxels).isConnected(YP, YN));
+    }
+
+    void testSetConnectedIsSymmetric() {
+        ChunkVisibility visibility = ChunkVisibility::none();
+        visibility.setConnected(ZN, XP);
+        CHECK(visibility.isConnected(ZN, XP));
+        CHECK(visibility.isConnected(XP, ZN));
+        CHECK_EQ(countConnections(visibility), 2);
+    }
+}
+
+int main() {
+    testSolidChunkIsSealed();
+    testHollowChunkIsSealed();
+    testAirChunkConnectsEverything();
+    testStraightTunnel();
+    testBentTunnel();
+    testSeparateTunnelsStayApart();
+    testTransparentVoxelsLetSightThrough();
+    testSetConnectedIsSymmetric();
+
+    return voxelity::test::result();
+}
@@ -0,0 +1,69 @@
+#include <memory>
+
+#include "Check.h"
+
+#include "Voxelity/voxelWorld/generation/ColumnCache.h"
+#include "Voxelity/voxelWorld/generation/FlatTerrainGenerator.h"
+
+using namespace voxelity;
+
+namespace {
+    constexpr int RADIUS = 4;
+
+    // Au-delà de maxEntries, seules les colonnes les plus éloignées du centre sont libérées
+    void testPruneKeepsNearest() {
+        FlatTerrainGenerator generator(0);
+        ColumnCache cache(generator);
+
+        ash::Vector<std::pair<ColumnCoord, std::weak_ptr<const ColumnData> > > columns;
+        for (int x = -RADIUS; x <= RADIUS; ++x) {
+            for (int z = -RADIUS; z <= RADIUS; ++z)
+                columns.emplace_back(ColumnCoord{x, z}, cache.getOrBuild({x, z}));
+        }
+        CHECK_EQ(cache.size(), 81u);
+
+        cache.prune({0, 0}, 100); // Sous la limite : rien ne part
+        CHECK_EQ(cache.size(), 81u);
+
+        // Colonne lointaine encore utilisée : gardée, et comptée dans la limite
+        const ash::Ref<const ColumnData> held = cache.getOrBuild({20, 20});
+
+        // Les 25 plus proches forment le disque dx² + dz² <= 8
+        cache.prune({0, 0}, 26);
+        CHECK_EQ(cache.size(), 26u);
+        CHECK(cache.getOrBuild({20, 20}) == held);
+
+        bool nearestKept = true;
+        for (const auto &[coord, column]: columns)
+            nearestKept &= column.expired() == (coord.x * coord.x + coord.z * coord.z > 8);
+        CHECK(nearestKept);
+    }
+
+    // Le joueur s'est déplacé : les colonnes laissées derrière partent en premier
+    void testPruneFollowsCenter() {
+        FlatTerrainGenerator generator(0);
+        ColumnCache cache(generator);
+
+        const std::weak_ptr<const ColumnData> behind = cache.getOrBuild({-10, 0});
+        const std::weak_ptr<const ColumnData> ahead = cache.getOrBuild({10, 0});
+        const std::weak_ptr<const ColumnData> here = cache.getOrBuild({8, 0});
+
+        cache.prune({9, 0}, 2);
+        CHECK_EQ(cache.size(), 2u);
+        CHECK(behind.expired());
+        CHECK(!ahead.expired());
+        CHECK(!here.expired());
+
+        // Tout est encore référencé : la limite est dépassée plutôt que de casser un chunk en cours
+        const ash::Ref<const ColumnData> a = cache.getOrBuild({10, 0});
+        const ash::Ref<const ColumnData> b = cache.getOrBuild({8, 0});
+        cache.prune({9, 0}, 1);
+        CHECK_EQ(cache.size(), 2u);
+    }
+}
+
+int main() {
+    testPruneKeepsNearest();
+    testPruneFollowsCenter();
+    return test::result();
+}
@@ -0,0 +1,120 @@
+#include <algorithm>
+
+#include "Check.h"
+
+#include "Voxelity/entities/EntityManager.h"
+#include "Voxelity/voxelWorld/world/World.h"
+
+using namespace voxelity;
+
+namespace {
+    constexpr float DELTA_TIME = 0.05f;
+
+    bool isFound(const EntityManager &entities, const ash::EntityId entity, const glm::vec3 &center) {
+        ash::Vector<ash::EntityId> found;
+        entities.findEntitiesInRadius(center, 2.0f, found);
+        return std::ranges::find(found, entity) != found.end();
+    }
+
+    // Identifiant gardé après Destroy : l'emplacement réutilisé porte une autre génération
+    void testStaleIdAfterSlotReuse(World &world) {
+        EntityManager entities;
+        const ash::EntityId old = entities.spawnFallingBlock(glm::vec3(0.0f, 100.0f, 0.0f), VoxelID::SAND);
+        entities.destroyEntity(old);
+        entities.updateAll(DELTA_TIME, world);
+
+        const ash::EntityId reused = entities.spawnFallingBlock(glm::vec3(0.0f, 100.0f, 0.0f), VoxelID::GRAVEL);
+        CHECK_EQ(reused.index, old.index);
+        CHECK(reused.generation != old.generation);
+        CHECK(!entities.isAlive(old));
+        CHECK(entities.isAlive(reused));
+        CHECK(entities.getRegistry().TryGet<Transform>(old) == nullptr);
+        CHECK(entities.getRegistry().TryGet<FallingBlock>(old) == nullptr);
+        if (CHECK(entities.getRegistry().TryGet<FallingBlock>(reused) != nullptr))
+            CHECK_EQ(entities.getRegistry().Get<FallingBlock>(reused).type, VoxelID::GRAVEL);
+    }
+
+    // Une entité demandée deux fois n'est détruite qu'une fois, et un identifiant périmé
+    // ne détruit pas l'entité qui a repris son emplacement
+    void testDuplicateDestroy(World &world) {
+        EntityManager entities;
+        const ash::EntityId a = entities.spawnFallingBlock(glm::vec3(0.0f, 100.0f, 0.0f), VoxelID::SAND);
+        const ash::EntityId b = entities.spawnFallingBlock(glm::vec3(4.0f, 100.0f, 0.0f), VoxelID::SAND);
+
+        entities.destroyEntity(a);
+        entities.destroyEntity(a);
+        entities.updateAll(DELTA_TIME, world);
+        CHECK(!entities.isAlive(a));
+        CHECK(entities.isAlive(b));
+        CHECK_EQ(entities.getEntityCount(), 1u);
+
+        const ash::EntityId c = entities.spawnFallingBlock(glm::vec3(8.0f, 100.0f, 0.0f), VoxelID::SAND);
+        CHECK_EQ(c.index, a.index);
+        entities.destroyEntity(a);
+        entities.updateAll(DELTA_TIME, world);
+        CHECK(entities.isAlive(b));
+        CHECK(entities.isAlive(c));
+        CHECK_EQ(entities.getEntityCount(), 2u);
+    }
+
+    // Destruction différée : composants et grille intacts jusqu'à la fin de l'updateAll
+    void testValidUntilFlush(World &world) {
+        EntityManager entities;
+        const glm::vec3 position(0.5f, 100.5f, 0.5f);
+        const ash::EntityId entity = entities.spawnFallingBlock(position, VoxelID::SAND);
+        entities.updateAll(DELTA_TIME, world);
+
+        const glm::vec3 current = entities.getRegistry().Get<Transform>(entity).position;
+        entities.destroyEntity(entity);
+        CHECK(entities.isAlive(entity));
+        CHECK(entities.getRegistry().TryGet<Transform>(entity) != nullptr);
+        CHECK_EQ(entities.getEntityCount(), 1u);
+        CHECK(isFound(entities, entity, current));
+
+        entities.updateAll(DELTA_TIME, world);
+        CHECK(!entities.isAlive(entity));
+        CHECK_EQ(entities.getEntityCount(), 0u);
+        CHECK(!isFound(entities, entity, current));
+    }
+
+    // Apparitions et disparitions répétées : les blocs d'archétype sont repris dans le pool,
+    // plus aucune allocation après le premier cycle
+    void testChunkPoolStaysFlat(World &world) {
+        constexpr int BLOCKS = 2000;
+        EntityManager entities;
+        const ash::ChunkPool &pool = entities.getRegistry().GetChunkPool();
+
+        ash::Vector<ash::EntityId> spawned;
+        size_t allocatedAfterFirstCycle = 0;
+        bool flat = true;
+        for (int cycle = 0; cycle < 10; ++cycle) {
+            spawned.clear();
+            for (int i = 0; i < BLOCKS; ++i) {
+                const glm::vec3 position(static_cast<float>(i % 50) * 2.0f, 200.0f, static_cast<float>(i / 50) * 2.0f);
+                spawned.push_back(entities.spawnFallingBlock(position, VoxelID::SAND));
+            }
+            entities.updateAll(DELTA_TIME, world);
+
+            for (const ash::EntityId entity: spawned)
+                entities.destroyEntity(entity);
+            entities.updateAll(DELTA_TIME, world);
+
+            if (cycle == 0) allocatedAfterFirstCycle = pool.GetAllocatedCount();
+            else flat &= pool.GetAllocatedCount() == allocatedAfterFirstCycle;
+        }
+
+        CHECK(allocatedAfterFirstCycle > 0u);
+        CHECK(flat);
+        CHECK_EQ(entities.getEntityCount(), 0u);
+        CHECK_EQ(pool.GetFreeCount(), pool.GetAllocatedCount());
+    }
+}
+
+int main() {
+    World world(nullptr); // Sans sol : les blocs restent en chute
+    testStaleIdAfterSlotReuse(world);
+    testDuplicateDestroy(world);
+    testValidUntilFlush(world);
+    testChunkPoolStaysFlat(world);
+    return test::result();
+}
@@ -0,0 +1,188 @@
+#include <random>
+#include <unordered_map>
+
+#include "Check.h"
+
+#include "Voxelity/voxelWorld/chunk/Chunk.h"
+
+using namespace voxelity;
+
+namespace {
+    // Hash choisi pour placer les clés : la case idéale d'une clé est slot(...) modulo la capacité
+    struct SlotHash {
+        size_t operator()(const int key) const noexcept { return static_cast<size_t>(key) >> 8; }
+    };
+
+    constexpr int slotKey(const int slot, const int id) { return slot << 8 | id; }
+
+    using SlotMap = ash::FlatHashMap<int, int, SlotHash>;
+
+    size_t indexOf(SlotMap &map, const int key) { return map.find(key).index(); }
+
+    // Grappe qui fait le tour de la table (capacité 16) avec une entrée déjà à sa place au milieu.
+    // Après la suppression de la tête, chaque entrée recule tant qu'elle ne dépasse pas sa case idéale
+    void testBackwardShiftErase() {
+        SlotMap map;
+        map.emplace(slotKey(3, 0), 30);
+        map.emplace(slotKey(14, 0), 140);
+        map.emplace(slotKey(14, 1), 141);
+        map.emplace(slotKey(14, 2), 142);
+        map.emplace(slotKey(0, 0), 0);
+        map.emplace(slotKey(15, 0), 150);
+        map.emplace(slotKey(1, 0), 10);
+        CHECK_EQ(map.capacity(), 16u);
+        CHECK_EQ(indexOf(map, slotKey(14, 2)), 0u);
+        CHECK_EQ(indexOf(map, slotKey(0, 0)), 1u);
+        CHECK_EQ(indexOf(map, slotKey(15, 0)), 2u);
+        CHECK_EQ(indexOf(map, slotKey(3, 0)), 3u);
+        CHECK_EQ(indexOf(map, slotKey(1, 0)), 4u);
+
+        CHECK_EQ(map.erase(slotKey(14, 0)), 1u);
+        CHECK_EQ(map.erase(slotKey(14, 0)), 0u);
+        CHECK_EQ(map.size(), 6u);
+        CHECK(!map.contains(slotKey(14, 0)));
+
+        CHECK_EQ(indexOf(map, slotKey(14, 1)), 14u);
+        CHECK_EQ(indexOf(map, slotKey(14, 2)), 15u);
+        CHECK_EQ(indexOf(map, slotKey(0, 0)), 0u);
+        CHECK_EQ(indexOf(map, slotKey(15, 0)), 1u);
+        CHECK_EQ(indexOf(map, slotKey(1, 0)), 2u);
+        CHECK_EQ(indexOf(map, slotKey(3, 0)), 3u); // Déjà à sa place : ne bouge pas
+        CHECK_EQ(map[slotKey(1, 0)], 10);
+        CHECK_EQ(map[slotKey(15, 0)], 150);
+
+        size_t count = 0;
+        for (const auto &[key, value]: map) {
+            CHECK_EQ(map.find(key)->second, value);
+            ++count;
+        }
+        CHECK_EQ(count, 6u);
+
+        // La case libérée en fin de grappe (4) est vide : le sondage d'une clé qui y est attendue s'y arrête
+        CHECK(map.find(slotKey(4, 0)) == map.end());
+        map.emplace(slotKey(4, 0), 40);
+        CHECK_EQ(indexOf(map, slotKey(4, 0)), 4u);
+    }
+
+    // Capacité puissance de deux, facteur de charge 7/8, et entrées conservées par le rehash.
+    // Les valeurs sont déplacées, jamais copiées
+    void testRehash() {
+        ash::FlatHashMap<int, ash::Own<int> > map;
+        map.reserve(1000);
+        CHECK_EQ(map.capacity(), 2048u);
+        map.reserve(10);
+        CHECK_EQ(map.capacity(), 2048u);
+
+        for (int key = 0; key < 1792; ++key)
+            map.emplace(key * 7919, std::make_unique<int>(key));
+        CHECK_EQ(map.capacity(), 2048u); // 1792 = 2048 × 7/8 : pas encore de rehash
+
+        map.emplace(-1, std::make_unique<int>(-1));
+        CHECK_EQ(map.capacity(), 4096u);
+        CHECK_EQ(map.size(), 1793u);
+
+        bool allFound = true;
+        for (int key = 0; key < 1792; ++key) {
+            const auto it = map.find(key * 7919);
+            allFound &= it != map.end() && it->second && *it->second == key;
+        }
+        CHECK(allFound);
+        CHECK(map.contains(-1));
+
+        map.clear();
+        CHECK(map.empty());
+        CHECK(!map.contains(0));
+        map.emplace(5, std::make_unique<int>(5));
+        CHECK_EQ(map.capacity(), 16u);
+        CHECK_EQ(*map.find(5)->second, 5);
+    }
+
+    // Suite aléatoire d'insertions et de suppressions sur des grappes longues (8 clés par case idéale),
+    // comparée à std::unordered_map
+    void testMatchesUnorderedMap() {
+        struct ClusterHash {
+            size_t operator()(const int key) const noexcept { return static_cast<size_t>(key) >> 3; }
+        };
+
+        ash::FlatHashMap<int, int, ClusterHash> map;
+        std::unordered_map<int, int> reference;
+        std::mt19937 random(42);
+        std::uniform_int_distribution<int> keys(0, 4095);
+
+        bool consistent = true;
+        for (int op = 0; op < 50000; ++op) {
+            const int key = keys(random);
+            if (random() % 3 == 0) {
+                consistent &= map.erase(key) == reference.erase(key);
+            } else {
+                const bool inserted = map.emplace(key, op).second;
+                consistent &= inserted == reference.emplace(key, op).second;
+            }
+
+            if (op % 1000 != 999) continue;
+
+            consistent &= map.size() == reference.size();
+            for (const auto &[refKey, refValue]: reference) {
+                const auto it = map.find(refKey);
+                consistent &= it != map.end() && it->second == refValue;
+            }
+            size_t iterated = 0;
+            for (const auto &[mapKey, mapValue]: map) {
+                consistent &= reference.contains(mapKey);
+                ++iterated;
+            }
+            consistent &= iterated == reference.size();
+        }
+        CHECK(consistent);
+    }
+
+    // Coordonnées de chunks réelles (HashCoord3) : cube autour d'une origine négative, moitié supprimée
+    void testChunkCoords() {
+        ash::FlatHashMap<ChunkCoord, int> map;
+        ash::FlatHashSet<ChunkCoord> set;
+        int id = 0;
+        for (int y = -4; y < 4; ++y) {
+            for (int z = -20; z < 0; ++z) {
+                for (int x = -1000; x < -980; ++x) {
+                    map.emplace(ChunkCoord(x, y, z), id++);
+                    set.insert(ChunkCoord(x, y, z));
+                }
+            }
+        }
+        CHECK_EQ(map.size(), 3200u);
+        CHECK_EQ(set.size(), 3200u);
+
+        for (int y = -4; y < 4; ++y) {
+            for (int z = -20; z < 0; ++z) {
+                for (int x = -1000; x < -990; ++x) {
+                    map.erase(ChunkCoord(x, y, z));
+                    set.erase(ChunkCoord(x, y, z));
+                }
+            }
+        }
+        CHECK_EQ(map.size(), 1600u);
+        CHECK_EQ(set.size(), 1600u);
+
+        bool consistent = true;
+        id = 0;
+        for (int y = -4; y < 4; ++y) {
+            for (int z = -20; z < 0; ++z) {
+                for (int x = -1000; x < -980; ++x, ++id) {
+                    const bool kept = x >= -990;
+                    const auto it = map.find(ChunkCoord(x, y, z));
+                    consistent &= kept ? it != map.end() && it->second == id : it == map.end();
+                    consistent &= set.contains(ChunkCoord(x, y, z)) == kept;
+                }
+            }
+        }
+        CHECK(consistent);
+    }
+}
+
+int main() {
+    testBackwardShiftErase();
+    testRehash();
+    testMatchesUnorderedMap();
+    testChunkCoords();
+    return test::result();
+}
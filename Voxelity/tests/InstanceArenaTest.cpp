@@ -0,0 +1,246 @@
+#include <random>
+
+#include "Check.h"
+
+#include "Voxelity/voxelWorld/render/InstanceArena.h"
+
+using namespace voxelity;
+
+namespace {
+    using Handle = InstanceArena::Handle;
+
+    void testAllocateLimits() {
+        InstanceArena arena(64);
+        CHECK_EQ(arena.allocate(0), InstanceArena::INVALID_HANDLE);
+        CHECK_EQ(arena.allocate(65), InstanceArena::INVALID_HANDLE);
+
+        const Handle a = arena.allocate(40);
+        const Handle b = arena.allocate(24);
+        CHECK_EQ(arena.get(a).offset, 0u);
+        CHECK_EQ(arena.get(b).offset, 40u);
+        CHECK_EQ(arena.getFreeCount(), 0u);
+        CHECK_EQ(arena.allocate(1), InstanceArena::INVALID_HANDLE);
+    }
+
+    void testBestFit() {
+        // Trous de 10, 4 et 6 séparés par des allocations d'un élément, puis la fin libre
+        InstanceArena arena(100);
+        const Handle a = arena.allocate(10);
+        arena.allocate(1);
+        const Handle b = arena.allocate(4);
+        arena.allocate(1);
+        const Handle c = arena.allocate(6);
+        arena.allocate(1);
+        arena.free(a);
+        arena.free(b);
+        arena.free(c);
+        CHECK_EQ(arena.getFreeBlockCount(), 4u);
+
+        // Le plus petit trou suffisant, pas le premier
+        CHECK_EQ(arena.get(arena.allocate(5)).offset, 16u);
+        CHECK_EQ(arena.get(arena.allocate(4)).offset, 11u);
+        CHECK_EQ(arena.get(arena.allocate(11)).offset, 23u);
+        CHECK_EQ(arena.get(arena.allocate(10)).offset, 0u);
+        CHECK_EQ(arena.getFreeBlockCount(), 2u); // Reste du trou de 6 et fin du buffer
+    }
+
+    void testCoalescingOnFree() {
+        InstanceArena arena(40);
+        const Handle a = arena.allocate(10);
+        const Handle b = arena.allocate(10);
+        const Handle c = arena.allocate(10);
+        const Handle d = arena.allocate(10);
+
+        arena.free(a);
+        arena.free(c);
+        CHECK_EQ(arena.getFreeBlockCount(), 2u);
+
+        // b rejoint a et c : un seul bloc de 30
+        arena.free(b);
+        CHECK_EQ(arena.getFreeBlockCount(), 1u);
+        CHECK_EQ(arena.getLargestFreeBlock(), 30u);
+        CHECK_EQ(arena.get(arena.allocate(30)).offset, 0u);
+
+        // Fusion avec le bloc suivant seulement
+        InstanceArena tail(30);
+        const Handle e = tail.allocate(10);
+        const Handle f = tail.allocate(10);
+        tail.free(f);
+        CHECK_EQ(tail.getFreeBlockCount(), 1u);
+        CHECK_EQ(tail.getLargestFreeBlock(), 20u);
+        tail.free(e);
+        CHECK_EQ(tail.getLargestFreeBlock(), 30u);
+        CHECK_EQ(tail.getFragmentation(), 0.0f);
+
+        arena.free(d);
+        CHECK_EQ(arena.getUsedCount(), 30u);
+    }
+
+    void testFreeIsIdempotent() {
+        InstanceArena arena(16);
+        const Handle a = arena.allocate(8);
+        arena.free(a);
+        arena.free(a);
+        arena.free(InstanceArena::INVALID_HANDLE);
+        CHECK(!arena.isValid(a));
+        CHECK_EQ(arena.getUsedCount(), 0u);
+        CHECK_EQ(arena.getFreeBlockCount(), 1u);
+
+        // L'identifiant libéré est réutilisé
+        CHECK_EQ(arena.allocate(4), a);
+    }
+
+    void testGrowExtendsLastFreeBlock() {
+        InstanceArena arena(16);
+        const Handle a = arena.allocate(8);
+        arena.grow(32);
+        CHECK_EQ(arena.getCapacity(), 32u);
+        CHECK_EQ(arena.getFreeBlockCount(), 1u);
+        CHECK_EQ(arena.getLargestFreeBlock(), 24u);
+        CHECK_EQ(arena.get(a).offset, 0u);
+
+        // Buffer plein : l'espace ajouté forme un nouveau bloc à la fin
+        arena.allocate(24);
+        arena.grow(40);
+        CHECK_EQ(arena.get(arena.allocate(8)).offset, 32u);
+
+        // Jamais de réduction
+        arena.grow(8);
+        CHECK_EQ(arena.getCapacity(), 40u);
+    }
+
+    void testFragmentation() {
+        // Blocs libres de 10 et 30 : le plus grand ne représente que les trois quarts de l'espace libre
+        InstanceArena arena(60);
+        const Handle a = arena.allocate(10);
+        arena.allocate(20);
+        CHECK_EQ(arena.getFragmentation(), 0.0f);
+        arena.free(a);
+        CHECK(arena.getFragmentation() > 0.24f && arena.getFragmentation() < 0.26f);
+    }
+
+    // Contenu simulé : chaque élément porte l'identifiant de son allocation
+    void fill(ash::Vector<uint32_t> &buffer, const InstanceArena &arena, const ash::Vector<Handle> &handles) {
+        buffer.assign(arena.getCapacity(), UINT32_MAX);
+        for (const Handle handle: handles) {
+            const InstanceArena::Range range = arena.get(handle);
+            for (uint32_t i = 0; i < range.count; ++i)
+                buffer[range.offset + i] = handle;
+        }
+    }
+
+    void testCompactMovePlan() {
+        InstanceArena arena(256);
+        std::mt19937 random(7);
+        ash::Vector<Handle> live;
+        for (int i = 0; i < 400; ++i) {
+            if (live.empty() || random() % 3 != 0) {
+                const Handle handle = arena.allocate(1 + random() % 12);
+                if (handle != InstanceArena::INVALID_HANDLE) live.push_back(handle);
+            } else {
+                const size_t index = random() % live.size();
+                arena.free(live[index]);
+                live[index] = live.back();
+                live.pop_back();
+            }
+        }
+        CHECK(arena.getFreeBlockCount() > 1);
+
+        ash::Vector<uint32_t> before;
+        fill(before, arena, live);
+        ash::Vector<uint32_t> previousOffsets;
+        for (const Handle handle: live) previousOffsets.push_back(arena.get(handle).offset);
+
+        ash::Vector<InstanceArena::Move> moves;
+        arena.compact(moves);
+
+        // Un seul bloc libre, à la fin
+        CHECK_EQ(arena.getFreeBlockCount(), 1u);
+        CHECK_EQ(arena.getLargestFreeBlock(), arena.getFreeCount());
+        CHECK_EQ(arena.getFragmentation(), 0.0f);
+
+        // Le plan recopie chaque allocation vers un buffer neuf ; les plages contiguës sont fusionnées
+        uint32_t copied = 0;
+        ash::Vector<uint32_t> after(arena.getCapacity(), UINT32_MAX);
+        for (size_t i = 0; i < moves.size(); ++i) {
+            const InstanceArena::Move &move = moves[i];
+            for (uint32_t k = 0; k < move.count; ++k)
+                after[move.to + k] = before[move.from + k];
+            copied += move.count;
+
+            if (i > 0) {
+                const InstanceArena::Move &last = moves[i - 1];
+                CHECK(!(last.from + last.count == move.from && last.to + last.count == move.to));
+            }
+        }
+        CHECK_EQ(copied, arena.getUsedCount());
+
+        ash::Vector<uint32_t> expected;
+        fill(expected, arena, live);
+        CHECK(after == expected);
+
+        // Allocations en tête, ordre d'origine conservé
+        CHECK_EQ(arena.getLargestFreeBlock(), arena.getCapacity() - arena.getUsedCount());
+        for (size_t i = 0; i < live.size(); ++i) {
+            for (size_t j = 0; j < live.size(); ++j) {
+                if (previousOffsets[i] < previousOffsets[j])
+                    CHECK(arena.get(live[i]).offset < arena.get(live[j]).offset);
+            }
+        }
+    }
+
+    void testRandomNoOverlap() {
+        InstanceArena arena(1000);
+        std::mt19937 random(1);
+        ash::Vector<Handle> live;
+        int overlaps = 0;
+        int countErrors = 0;
+
+        for (int i = 0; i < 20000; ++i) {
+            if (live.empty() || random() % 2 != 0) {
+                const Handle handle = arena.allocate(1 + random() % 60);
+                if (handle != InstanceArena::INVALID_HANDLE) {
+                    live.push_back(handle);
+                } else if (arena.getFreeCount() >= 60) {
+                    ash::Vector<InstanceArena::Move> moves;
+                    arena.compact(moves);
+                } else {
+                    arena.grow(arena.getCapacity() * 2);
+                }
+            } else {
+                const size_t index = random() % live.size();
+                arena.free(live[index]);
+                live[index] = live.back();
+                live.pop_back();
+            }
+
+            if (i % 499 == 0) {
+                ash::Vector<uint8_t> owners(arena.getCapacity(), 0);
+                uint32_t used = 0;
+                for (const Handle handle: live) {
+                    const InstanceArena::Range range = arena.get(handle);
+                    used += range.count;
+                    for (uint32_t k = range.offset; k < range.offset + range.count; ++k)
+                        overlaps += owners[k]++ > 0;
+                }
+                countErrors += used != arena.getUsedCount();
+            }
+        }
+
+        CHECK_EQ(overlaps, 0);
+        CHECK_EQ(countErrors, 0);
+    }
+}
+
+int main() {
+    testAllocateLimits();
+    testBestFit();
+    testCoalescingOnFree();
+    testFreeIsIdempotent();
+    testGrowExtendsLastFreeBlock();
+    testFragmentation();
+    testCompactMovePlan();
+    testRandomNoOverlap();
+
+    return voxelity::test::result();
+}
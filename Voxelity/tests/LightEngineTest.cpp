@@ -0,0 +1,168 @@
+#include <chrono>
+#include <initializer_list>
+#include <thread>
+
+#include "Check.h"
+
+#include "Voxelity/voxelWorld/generation/ITerrainGenerator.h"
+#include "Voxelity/voxelWorld/world/World.h"
+
+using namespace voxelity;
+
+namespace {
+    // Niveau attendu d'un canal en une position monde
+    struct LightExpectation {
+        glm::ivec3 position;
+        bool sky;
+        uint8_t level;
+    };
+
+    uint8_t getLight(const World &world, const glm::ivec3 &position, const bool sky) {
+        const Chunk *chunk = world.getChunk(World::toChunkCoord(position));
+        if (!chunk) return 0;
+
+        const glm::ivec3 local = World::toLocalCoord(position);
+        return sky ? chunk->getSkyLight(local.x, local.y, local.z) : chunk->getBlockLight(local.x, local.y, local.z);
+    }
+
+    // Le LightEngine travaille sur son propre thread : on attend qu'il ait traité toutes ses tâches
+    // (au plus 5 s), puis on compare
+    void expectLight(const World &world, const std::initializer_list<LightExpectation> expectations) {
+        for (int attempt = 0; attempt < 500 && world.getPendingLightCount() > 0; ++attempt)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        CHECK_EQ(world.getPendingLightCount(), 0u);
+        for (const auto &[position, sky, level]: expectations)
+            CHECK_EQ(getLight(world, position, sky), level);
+    }
+
+    // Deux sources de 15 de part et d'autre d'un bord de chunk : ajout, puis retrait de l'une d'elles.
+    // La lumière de la source restante doit revenir dans la zone éteinte
+    void testPlaceAndRemoveSource() {
+        World world(nullptr);
+        world.fillBox({{-32, 0, 0}, {31, 0, 31}}, VoxelID::STONE);
+        expectLight(world, {{{2, 5, 16}, true, 15}, {{-3, 5, 16}, true, 15}});
+
+        world.setVoxel(2, 5, 16, VoxelID::LAVA);
+        world.setVoxel(20, 5, 16, VoxelID::LAVA);
+        expectLight(world, {
+                        {{2, 5, 16}, false, 15},
+                        {{-3, 5, 16}, false, 10}, // Chunk voisin
+                        {{11, 5, 16}, false, 6}, // À mi-chemin des deux sources
+                        {{2, 5, 30}, false, 1},
+                        {{2, 5, 31}, false, 0},
+                        {{2, 19, 16}, false, 1},
+                        {{2, 20, 16}, false, 0},
+                        {{2, 0, 16}, false, 0} // Sol opaque
+                    });
+
+        world.setVoxel(2, 5, 16, VoxelID::AIR);
+        expectLight(world, {
+                        {{2, 5, 16}, false, 0},
+                        {{-3, 5, 16}, false, 0},
+                        {{5, 5, 16}, false, 0},
+                        {{6, 5, 16}, false, 1},
+                        {{11, 5, 16}, false, 6},
+                        {{20, 5, 16}, false, 15},
+                        {{2, 5, 16}, true, 15} // Le ciel revient dans la cellule libérée
+                    });
+
+        world.setVoxel(20, 5, 16, VoxelID::AIR);
+        expectLight(world, {{{20, 5, 16}, false, 0}, {{11, 5, 16}, false, 0}, {{6, 5, 16}, false, 0}});
+    }
+
+    // Un toit posé dans le chunk du dessus, chargé après celui du dessous : le chunk du dessous,
+    // éclairé comme à ciel ouvert, doit être corrigé. Puis un trou percé dans le toit et rebouché
+    void testSealAndUnsealSkyColumn() {
+        World world(nullptr);
+        world.fillBox({{0, 0, 0}, {31, 0, 31}}, VoxelID::STONE);
+        expectLight(world, {{{5, 1, 5}, true, 15}, {{5, 31, 5}, true, 15}});
+
+        world.fillBox({{0, 50, 0}, {31, 50, 31}}, VoxelID::STONE);
+        expectLight(world, {
+                        {{5, 1, 5}, true, 0},
+                        {{5, 31, 5}, true, 0},
+                        {{20, 10, 20}, true, 0},
+                        {{5, 40, 5}, true, 0},
+                        {{5, 51, 5}, true, 15}
+                    });
+
+        world.setVoxel(5, 50, 5, VoxelID::AIR);
+        expectLight(world, {
+                        {{5, 50, 5}, true, 15},
+                        {{5, 40, 5}, true, 15},
+                        {{5, 1, 5}, true, 15}, // La colonne descend sans s'atténuer jusqu'au sol
+                        {{6, 10, 5}, true, 14},
+                        {{8, 10, 5}, true, 12},
+                        {{5, 10, 20}, true, 0}
+                    });
+
+        world.setVoxel(5, 50, 5, VoxelID::STONE);
+        expectLight(world, {
+                        {{5, 50, 5}, true, 0},
+                        {{5, 40, 5}, true, 0},
+                        {{5, 1, 5}, true, 0},
+                        {{6, 10, 5}, true, 0},
+                        {{5, 51, 5}, true, 15}
+                    });
+    }
+
+    // Un même lot : 70 sources dans un chunk (ré-éclairé en entier), une seule dans le voisin
+    // (mise à jour incrémentale). Puis deux lots massifs à la suite sur le même chunk : le second
+    // ré-éclairage peut rejoindre celui encore en file, qui doit lire les voxels des deux lots
+    void testBatchLightPerChunk() {
+        World world(nullptr);
+        world.fillBox({{-32, 0, 0}, {31, 0, 31}}, VoxelID::STONE);
+        expectLight(world, {{{2, 5, 16}, true, 15}});
+
+        ash::Vector<VoxelEdit> sources;
+        for (int x = 0; x < 32; ++x) {
+            sources.push_back({{x, 5, 16}, VoxelID::LAVA});
+            sources.push_back({{x, 5, 20}, VoxelID::LAVA});
+        }
+        for (int x = 0; x < 6; ++x)
+            sources.push_back({{x, 5, 24}, VoxelID::LAVA});
+        sources.push_back({{-20, 5, 16}, VoxelID::LAVA});
+
+        CHECK_EQ(world.setVoxels(sources), sources.size());
+        expectLight(world, {
+                        {{10, 5, 16}, false, 15},
+                        {{10, 5, 18}, false, 13}, // Entre deux rangées
+                        {{10, 15, 16}, false, 5},
+                        {{-3, 5, 16}, false, 12}, // Chunk voisin, éclairé depuis le chunk ré-éclairé
+                        {{-20, 5, 16}, false, 15},
+                        {{-12, 5, 16}, false, 7},
+                        {{-20, 5, 26}, false, 5}
+                    });
+
+        ash::Vector<VoxelEdit> cleared;
+        for (const auto &[position, type]: sources) {
+            if (position.x >= 0) cleared.push_back({position, VoxelID::AIR});
+        }
+        ash::Vector<VoxelEdit> moved;
+        for (int x = 0; x < 32; ++x) {
+            moved.push_back({{x, 5, 8}, VoxelID::LAVA});
+            moved.push_back({{x, 5, 10}, VoxelID::LAVA});
+        }
+        moved.push_back({{0, 5, 12}, VoxelID::LAVA});
+
+        world.setVoxels(cleared);
+        world.setVoxels(moved);
+        expectLight(world, {
+                        {{10, 5, 20}, false, 5},
+                        {{10, 5, 28}, false, 0},
+                        {{10, 5, 8}, false, 15},
+                        {{10, 5, 16}, false, 9},
+                        {{0, 5, 14}, false, 13},
+                        {{-3, 5, 8}, false, 12},
+                        {{-20, 5, 16}, false, 15}
+                    });
+    }
+}
+
+int main() {
+    testPlaceAndRemoveSource();
+    testSealAndUnsealSkyColumn();
+    testBatchLightPerChunk();
+    return test::result();
+}
@@ -0,0 +1,131 @@
+#include "Check.h"
+
+#include "Voxelity/voxelWorld/lod/LodDownsampler.h"
+
+using namespace voxelity;
+
+namespace {
+    // Remplit la cellule de côté scale à partir de min, couche par couche (y croissant)
+    void fillLayer(VoxelArray &voxels, const glm::ivec3 &min, const int scale, const int layer,
+                   const VoxelType type) {
+        for (int z = 0; z < scale; ++z) {
+            for (int x = 0; x < scale; ++x)
+                voxels.set(min.x + x, min.y + layer, min.z + z, type);
+        }
+    }
+
+    void testUniformCell() {
+        VoxelArray voxels;
+        voxels.fill(VoxelID::STONE);
+        CHECK_EQ(LodDownsampler::mergeCell(voxels, {0, 0, 0}, 4), VoxelID::STONE);
+
+        voxels.fill(VoxelID::AIR);
+        CHECK_EQ(LodDownsampler::mergeCell(voxels, {8, 8, 8}, 8), VoxelID::AIR);
+    }
+
+    void testScaleOneCopiesVoxel() {
+        VoxelArray voxels;
+        voxels.fill(VoxelID::AIR);
+        voxels.set(3, 4, 5, VoxelID::GLASS);
+        CHECK_EQ(LodDownsampler::mergeCell(voxels, {3, 4, 5}, 1), VoxelID::GLASS);
+    }
+
+    void testTopOpaqueLayerWins() {
+        // Deux couches de pierre, une de terre, une d'herbe : l'herbe visible d'en haut l'emporte
+        // même si la pierre est majoritaire dans le volume
+        VoxelArray voxels;
+        voxels.fill(VoxelID::AIR);
+        fillLayer(voxels, {0, 0, 0}, 4, 0, VoxelID::STONE);
+        fillLayer(voxels, {0, 0, 0}, 4, 1, VoxelID::STONE);
+        fillLayer(voxels, {0, 0, 0}, 4, 2, VoxelID::DIRT);
+        fillLayer(voxels, {0, 0, 0}, 4, 3, VoxelID::GRASS);
+        CHECK_EQ(LodDownsampler::mergeCell(voxels, {0, 0, 0}, 4), VoxelID::GRASS);
+    }
+
+    void testMajorityInTopLayer() {
+        VoxelArray voxels;
+        voxels.fill(VoxelID::AIR);
+        fillLayer(voxels, {0, 0, 0}, 4, 0, VoxelID::STONE);
+        fillLayer(voxels, {0, 0, 0}, 4, 1, VoxelID::DIRT);
+
+        // Couche haute : 10 herbe, 6 sable, puis de l'air au-dessus
+        for (int i = 0; i < 16; ++i)
+            voxels.set(i % 4, 1, i / 4, i < 10 ? VoxelID::GRASS : VoxelID::SAND);
+        CHECK_EQ(LodDownsampler::mergeCell(voxels, {0, 0, 0}, 4), VoxelID::GRASS);
+
+        for (int i = 0; i < 16; ++i)
+            voxels.set(i % 4, 1, i / 4, i < 5 ? VoxelID::GRASS : VoxelID::SAND);
+        CHECK_EQ(LodDownsampler::mergeCell(voxels, {0, 0, 0}, 4), VoxelID::SAND);
+    }
+
+    void testHalfOpaqueThreshold() {
+        VoxelArray voxels;
+        voxels.fill(VoxelID::AIR);
+
+        // Exactement la moitié opaque : cellule pleine
+        fillLayer(voxels, {0, 0, 0}, 2, 0, VoxelID::STONE);
+        CHECK_EQ(LodDownsampler::mergeCell(voxels, {0, 0, 0}, 2), VoxelID::STONE);
+
+        // Un quart : air
+        voxels.set(0, 0, 0, VoxelID::AIR);
+        voxels.set(1, 0, 0, VoxelID::AIR);
+        CHECK_EQ(LodDownsampler::mergeCell(voxels, {0, 0, 0}, 2), VoxelID::AIR);
+    }
+
+    void testLiquidCompletesHalf() {
+        // Un quart de pierre au fond, un quart d'eau : la moitié est atteinte avec le liquide
+        VoxelArray voxels;
+        voxels.fill(VoxelID::AIR);
+        fillLayer(voxels, {0, 0, 0}, 4, 0, VoxelID::STONE);
+        fillLayer(voxels, {0, 0, 0}, 4, 1, VoxelID::WATER);
+        CHECK_EQ(LodDownsampler::mergeCell(voxels, {0, 0, 0}, 4), VoxelID::WATER);
+
+        // Vote entre transparents : l'eau majoritaire devant la glace
+        for (int i = 0; i < 6; ++i)
+            voxels.set(i % 4, 1, i / 4, VoxelID::ICE);
+        CHECK_EQ(LodDownsampler::mergeCell(voxels, {0, 0, 0}, 4), VoxelID::WATER);
+
+        // Un quart de transparent sans rien d'opaque : air
+        fillLayer(voxels, {0, 0, 0}, 4, 0, VoxelID::AIR);
+        CHECK_EQ(LodDownsampler::mergeCell(voxels, {0, 0, 0}, 4), VoxelID::AIR);
+    }
+
+    void testDownsampleWritesAtOffset() {
+        // Terrain en couches : pierre jusqu'à y = 15, eau de 16 à 23, air au-dessus
+        VoxelArray src;
+        for (int y = 0; y < VoxelArray::SIZE; ++y) {
+            const VoxelType type = y < 16 ? VoxelID::STONE : y < 24 ? VoxelID::WATER : VoxelID::AIR;
+            for (int z = 0; z < VoxelArray::SIZE; ++z) {
+                for (int x = 0; x < VoxelArray::SIZE; ++x)
+                    src.set(x, y, z, type);
+            }
+        }
+
+        VoxelArray dst;
+        dst.fill(VoxelID::BEDROCK);
+        LodDownsampler::downsample(src, 2, dst, {16, 0, 16});
+
+        for (int y = 0; y < 16; ++y) {
+            const VoxelType expected = y < 8 ? VoxelID::STONE : y < 12 ? VoxelID::WATER : VoxelID::AIR;
+            CHECK_EQ(dst.get(16, y, 16), expected);
+            CHECK_EQ(dst.get(31, y, 31), expected);
+        }
+
+        // Hors de la zone écrite : inchangé
+        CHECK_EQ(dst.get(15, 0, 16), VoxelID::BEDROCK);
+        CHECK_EQ(dst.get(16, 16, 16), VoxelID::BEDROCK);
+        CHECK_EQ(dst.get(16, 0, 15), VoxelID::BEDROCK);
+    }
+}
+
+int main() {
+    testUniformCell();
+    testScaleOneCopiesVoxel();
+    testTopOpaqueLayerWins();
+    testMajorityInTopLayer();
+    testHalfOpaqueThreshold();
+    testLiquidCompletesHalf();
+    testDownsampleWritesAtOffset();
+
+    return voxelity::test::result();
+}
@@ -0,0 +1,99 @@
+#include <algorithm>
+
+#include "Check.h"
+
+#include "Voxelity/voxelWorld/lod/LodSelector.h"
+
+using namespace voxelity;
+
+namespace {
+    // Chaque chunk du cube de rayon getMaxDistance() est couvert par exactement un noeud
+    void checkCoverage(const glm::ivec3 &center, const int detailRadius, const int levelCount) {
+        ash::Vector<LodNode> nodes;
+        LodSelector::select(center, detailRadius, levelCount, nodes);
+        const int maxDistance = LodSelector::getMaxDistance(detailRadius, levelCount);
+
+        ash::HashMap<ChunkCoord, int> coverage;
+        for (const LodNode &node: nodes) {
+            const int size = node.getSize();
+            CHECK(node.level <= levelCount);
+            CHECK_EQ(node.origin.x & (size - 1), 0);
+            CHECK_EQ(node.origin.y & (size - 1), 0);
+            CHECK_EQ(node.origin.z & (size - 1), 0);
+
+            // Issu d'une racine du niveau le plus grossier qui recoupe le cube
+            const LodNode root = LodNode::containing(node.origin, static_cast<uint8_t>(levelCount));
+            CHECK(LodSelector::distanceToNode(center, root) < maxDistance);
+
+            // Un noeud grossier n'est gardé qu'au-delà de son anneau : la pleine résolution
+            // couvre au moins detailRadius chunks autour du joueur
+            if (node.level > 0) CHECK(LodSelector::distanceToNode(center, node) >= node.level * detailRadius);
+
+            for (int y = 0; y < size; ++y) {
+                for (int z = 0; z < size; ++z) {
+                    for (int x = 0; x < size; ++x)
+                        ++coverage[ChunkCoord(node.origin.x + x, node.origin.y + y, node.origin.z + z)];
+                }
+            }
+        }
+
+        int overlaps = 0;
+        for (const auto &[coord, count]: coverage) {
+            if (count > 1) ++overlaps;
+        }
+        CHECK_EQ(overlaps, 0);
+
+        int gaps = 0;
+        for (int y = -maxDistance + 1; y < maxDistance; ++y) {
+            for (int z = -maxDistance + 1; z < maxDistance; ++z) {
+                for (int x = -maxDistance + 1; x < maxDistance; ++x) {
+                    if (!coverage.contains(ChunkCoord(center.x + x, center.y + y, center.z + z))) ++gaps;
+                }
+            }
+        }
+        CHECK_EQ(gaps, 0);
+    }
+
+    void testContainingRoundsDown() {
+        const LodNode node = LodNode::containing(ChunkCoord(-1, 5, -9), 2);
+        CHECK_EQ(node.origin.x, -4);
+        CHECK_EQ(node.origin.y, 4);
+        CHECK_EQ(node.origin.z, -12);
+        CHECK(node.contains(ChunkCoord(-1, 5, -9)));
+        CHECK(!node.contains(ChunkCoord(0, 5, -9)));
+    }
+
+    void testDistanceToNode() {
+        const LodNode node{{4, 0, 0}, 2}; // x de 4 à 7, y et z de 0 à 3
+        CHECK_EQ(LodSelector::distanceToNode({5, 1, 2}, node), 0);
+        CHECK_EQ(LodSelector::distanceToNode({0, 0, 0}, node), 4);
+        CHECK_EQ(LodSelector::distanceToNode({10, 0, 0}, node), 3);
+        CHECK_EQ(LodSelector::distanceToNode({5, -6, 0}, node), 6);
+    }
+
+    void testLevelZeroOnly() {
+        ash::Vector<LodNode> nodes;
+        LodSelector::select({0, 0, 0}, 2, 0, nodes);
+
+        // Cube de côté 2 * 2 - 1 en chunks ordinaires
+        CHECK_EQ(nodes.size(), 27u);
+        CHECK(std::ranges::all_of(nodes, [](const LodNode &node) { return node.level == 0; }));
+    }
+}
+
+int main() {
+    testContainingRoundsDown();
+    testDistanceToNode();
+    testLevelZeroOnly();
+
+    // Positions alignées, décalées et négatives, pour chaque nombre de niveaux
+    const glm::ivec3 centers[] = {{0, 0, 0}, {5, -3, 17}, {-1, -1, -1}, {-13, 2, 7}, {31, -32, 8}};
+    for (const glm::ivec3 &center: centers) {
+        for (int levelCount = 0; levelCount <= LOD_MAX_LEVEL; ++levelCount) {
+            for (const int detailRadius: {1, 3, 4})
+                checkCoverage(center, detailRadius, levelCount);
+        }
+    }
+
+    return voxelity::test::result();
+}
@@ -0,0 +1,63 @@
+#ifndef VOXELITY_REFERENCECOLUMN_H
+#define VOXELITY_REFERENCECOLUMN_H
+
+#include <algorithm>
+
+#include "OpenSimplex2S.hpp"
+
+#include "Voxelity/voxelWorld/generation/NaturalTerrainGenerator.h"
+
+// Ancien calcul des colonnes de NaturalTerrainGenerator, référence des tests et des benchmarks
+// de buildColumn (inclus depuis benchmarks/)
+namespace voxelity::test {
+    // Colonne par colonne et en double : climat échantillonné en chaque colonne, sans grille
+    // grossière, et classé par la chaîne de seuils, sans table
+    class ReferenceColumnBuilder {
+        using Generator = NaturalTerrainGenerator;
+
+        OpenSimplex2S noise; // Même bruit que le générateur
+
+    public:
+        void build(ColumnData &column) {
+            const int originX = column.coord.x * VoxelArray::SIZE;
+            const int originZ = column.coord.z * VoxelArray::SIZE;
+
+            for (int x = 0; x < VoxelArray::SIZE; ++x) {
+                const int worldX = originX + x;
+                for (int z = 0; z < VoxelArray::SIZE; ++z) {
+                    const int worldZ = originZ + z;
+
+                    const double combinedElevation =
+                            noise.noise2(worldX * Generator::CONTINENT_SCALE, worldZ * Generator::CONTINENT_SCALE) * 30.0 +
+                            noise.noise2(worldX * Generator::ELEVATION_SCALE, worldZ * Generator::ELEVATION_SCALE) * 20.0 +
+                            noise.noise2(worldX * Generator::DETAIL_SCALE, worldZ * Generator::DETAIL_SCALE) * 8.0;
+                    const int groundHeight = static_cast<int>(Generator::SEA_LEVEL + combinedElevation);
+
+                    const double temperature = (noise.noise2(worldX * Generator::TEMPERATURE_SCALE,
+                                                             worldZ * Generator::TEMPERATURE_SCALE) + 1.0) * 0.5;
+                    const double humidity = (noise.noise2(worldX * Generator::HUMIDITY_SCALE + 1000,
+                                                          worldZ * Generator::HUMIDITY_SCALE + 1000) + 1.0) * 0.5;
+                    const double altitudeTemp = std::max(
+                        0.0, temperature - (groundHeight - Generator::SEA_LEVEL) *
+                             static_cast<double>(Generator::BIOME_ALTITUDE_COOLING));
+
+                    BiomeType biome = BiomeType::PLAINS;
+                    if (groundHeight < Generator::SEA_LEVEL - 5) biome = BiomeType::OCEAN;
+                    else if (groundHeight < Generator::BEACH_HEIGHT && groundHeight > Generator::SEA_LEVEL - 5)
+                        biome = BiomeType::BEACH;
+                    else if (groundHeight > Generator::MOUNTAIN_HEIGHT - 20) biome = BiomeType::MOUNTAINS;
+                    else if (altitudeTemp < 0.3) biome = BiomeType::TUNDRA;
+                    else if (altitudeTemp > 0.7 && humidity < 0.3) biome = BiomeType::DESERT;
+                    else if (humidity > 0.6 && altitudeTemp > 0.4) biome = BiomeType::SWAMP;
+                    else if (humidity > 0.5 && altitudeTemp > 0.3) biome = BiomeType::FOREST;
+
+                    const int index = ColumnData::index(x, z);
+                    column.heightMap[index] = groundHeight;
+                    column.biomeMap[index] = static_cast<uint8_t>(biome);
+                }
+            }
+        }
+    };
+}
+
+#endif //VOXELITY_REFERENCECOLUMN_H
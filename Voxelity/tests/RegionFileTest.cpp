@@ -0,0 +1,225 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include "Check.h"
+
+#include "Voxelity/voxelWorld/storage/ChunkCodec.h"
+#include "Voxelity/voxelWorld/storage/RegionFile.h"
+#include "Voxelity/voxelWorld/storage/RegionStorage.h"
+
+using namespace voxelity;
+
+namespace {
+    bool sameVoxels(const VoxelArray &a, const VoxelArray &b) {
+        return std::equal(a.data(), a.data() + VoxelArray::VOLUME, b.data());
+    }
+
+    // Couches homogènes, une colonne de verre et quelques voxels isolés
+    VoxelArray makeTerrain() {
+        VoxelArray voxels;
+        voxels.fill(VoxelID::AIR);
+        for (int y = 0; y < 12; ++y) {
+            for (int z = 0; z < VoxelArray::SIZE; ++z) {
+                for (int x = 0; x < VoxelArray::SIZE; ++x)
+                    voxels.set(x, y, z, y < 10 ? VoxelID::STONE : VoxelID::DIRT);
+            }
+        }
+        for (int y = 12; y < VoxelArray::SIZE; ++y)
+            voxels.set(3, y, 7, VoxelID::GLASS);
+        voxels.set(0, 31, 0, VoxelID::GOLD_ORE);
+        voxels.set(31, 31, 31, VoxelID::BEDROCK);
+        return voxels;
+    }
+
+    ash::Vector<uint8_t> makePayload(const size_t size, const uint8_t seed) {
+        ash::Vector<uint8_t> bytes(size);
+        for (size_t i = 0; i < size; ++i)
+            bytes[i] = static_cast<uint8_t>(seed + i * 31);
+        return bytes;
+    }
+
+    void testCodecRoundTrip() {
+        const VoxelArray voxels = makeTerrain();
+
+        const ash::Vector<uint8_t> bytes = ChunkCodec::encode({-3, 7, 120000}, voxels, nullptr);
+        CHECK(bytes.size() < 1024u);
+
+        ChunkCoord coord;
+        ChunkData decoded;
+        decoded.fluid = std::make_unique<FluidArray>();
+        CHECK(ChunkCodec::decode(bytes, coord, decoded));
+        CHECK(coord == ChunkCoord(-3, 7, 120000));
+        CHECK(sameVoxels(decoded.voxels, voxels));
+        CHECK(decoded.fluid == nullptr);
+
+        // Longueurs de plage sur plusieurs octets (plage de 32 768 voxels)
+        VoxelArray uniform;
+        uniform.fill(VoxelID::WATER);
+        CHECK(ChunkCodec::decode(ChunkCodec::encode({}, uniform, nullptr), coord, decoded));
+        CHECK(sameVoxels(decoded.voxels, uniform));
+    }
+
+    void testCodecFluidRoundTrip() {
+        VoxelArray voxels;
+        voxels.fill(VoxelID::WATER);
+        FluidArray fluid;
+        fluid.clear();
+        fluid.set(1, 2, 3, 5);
+        fluid.set(2, 2, 3, FluidArray::FALLING | 1);
+        fluid.set(31, 0, 31, 7);
+
+        ChunkCoord coord;
+        ChunkData decoded;
+        CHECK(ChunkCodec::decode(ChunkCodec::encode({}, voxels, &fluid), coord, decoded));
+        CHECK(sameVoxels(decoded.voxels, voxels));
+        if (CHECK(decoded.fluid != nullptr)) {
+            CHECK(std::equal(fluid.data(), fluid.data() + FluidArray::BYTE_SIZE, decoded.fluid->data()));
+            CHECK_EQ(decoded.fluid->get(2, 2, 3), FluidArray::FALLING | 1);
+        }
+    }
+
+    void testCodecRejectsDamagedData() {
+        const ash::Vector<uint8_t> bytes = ChunkCodec::encode({1, 2, 3}, makeTerrain(), nullptr);
+        ChunkCoord coord;
+        ChunkData decoded;
+
+        const ash::Vector<uint8_t> truncated(bytes.begin(), bytes.end() - 1);
+        CHECK(!ChunkCodec::decode(truncated, coord, decoded));
+
+        ash::Vector<uint8_t> trailing = bytes;
+        trailing.push_back(0);
+        CHECK(!ChunkCodec::decode(trailing, coord, decoded));
+
+        ash::Vector<uint8_t> wrongVersion = bytes;
+        wrongVersion[0] = ChunkCodec::VERSION + 1;
+        CHECK(!ChunkCodec::decode(wrongVersion, coord, decoded));
+
+        // Plages encore décodables, mais somme de contrôle fausse
+        ash::Vector<uint8_t> flipped = bytes;
+        flipped.back() ^= 1;
+        CHECK(!ChunkCodec::decode(flipped, coord, decoded));
+
+        ash::Vector<uint8_t> moved = bytes;
+        moved[2] ^= 1;
+        CHECK(!ChunkCodec::decode(moved, coord, decoded));
+
+        CHECK(!ChunkCodec::decode({}, coord, decoded));
+    }
+
+    // Table qui désigne l'encodage complet d'un autre chunk (secteurs réutilisés, coupure avant le fsync) :
+    // décodable, mais refusé par loadChunk
+    void testStorageRejectsForeignChunk(const std::filesystem::path &directory) {
+        const VoxelArray voxels = makeTerrain();
+        RegionStorage storage(directory);
+        const EncodedChunk chunks[] = {
+            {{0, 0, 0}, ChunkCodec::encode({0, 0, 0}, voxels, nullptr)},
+            {{1, 0, 0}, ChunkCodec::encode({5, 0, 0}, voxels, nullptr)}
+        };
+        CHECK(storage.writeChunks(chunks, false));
+
+        ChunkData loaded;
+        CHECK(storage.loadChunk({0, 0, 0}, loaded) && sameVoxels(loaded.voxels, voxels));
+        CHECK(!storage.loadChunk({1, 0, 0}, loaded));
+        CHECK(!storage.loadChunk({5, 0, 0}, loaded));
+    }
+
+    void testRegionRoundTrip(const std::filesystem::path &path) {
+        const ash::Vector<uint8_t> small = makePayload(100, 1);
+        const ash::Vector<uint8_t> large = makePayload(3 * RegionFile::SECTOR_SIZE + 17, 2);
+        const ash::Vector<uint8_t> replaced = makePayload(2 * RegionFile::SECTOR_SIZE, 3);
+        {
+            RegionFile region(path, true);
+            region.write({0, 0, 0}, small);
+            const RegionFile::ChunkWrite batch[] = {{{15, 15, 15}, large}, {{4, 9, 2}, small}};
+            region.write(batch);
+
+            // Remplacement d'une version existante par une plus grande
+            region.write({0, 0, 0}, replaced);
+        }
+
+        const RegionFile region(path, false);
+        ash::Vector<uint8_t> bytes;
+        CHECK(region.read({0, 0, 0}, bytes) && bytes == replaced);
+        CHECK(region.read({15, 15, 15}, bytes) && bytes == large);
+        CHECK(region.read({4, 9, 2}, bytes) && bytes == small);
+        CHECK(!region.contains({1, 0, 0}));
+        CHECK(!region.read({1, 0, 0}, bytes));
+
+        bool threw = false;
+        try {
+            region.contains({RegionFile::SIZE, 0, 0});
+        } catch (const std::out_of_range &) {
+            threw = true;
+        }
+        CHECK(threw);
+    }
+
+    // Table pointant au-delà de la fin du fichier (écriture interrompue) : chunk considéré comme absent
+    void testHeaderRecoversTruncatedData(const std::filesystem::path &path) {
+        const ash::Vector<uint8_t> first = makePayload(100, 4);
+        const ash::Vector<uint8_t> last = makePayload(100, 5);
+        {
+            RegionFile region(path, true);
+            region.write({1, 2, 3}, first);
+            region.write({3, 2, 1}, last); // Dernier secteur du fichier
+        }
+        std::filesystem::resize_file(path, std::filesystem::file_size(path) - RegionFile::SECTOR_SIZE);
+
+        RegionFile region(path, false);
+        ash::Vector<uint8_t> bytes;
+        CHECK(region.read({1, 2, 3}, bytes) && bytes == first);
+        CHECK(!region.contains({3, 2, 1}));
+
+        // Les secteurs perdus sont de nouveau utilisables
+        region.write({3, 2, 1}, last);
+        CHECK(region.read({3, 2, 1}, bytes) && bytes == last);
+    }
+
+    void testHeaderValidation(const std::filesystem::path &path) {
+        // Fichier plus court qu'un en-tête : traité comme une région vide
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file << "garbage";
+        }
+        {
+            const RegionFile region(path, false);
+            CHECK(!region.contains({0, 0, 0}));
+        }
+
+        // En-tête complet mais magic invalide : refusé
+        {
+            RegionFile region(path, false);
+            region.write({0, 0, 0}, makePayload(10, 6));
+        }
+        {
+            std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+            file.write("XXXX", 4);
+        }
+        bool threw = false;
+        try {
+            RegionFile region(path, false);
+        } catch (const std::runtime_error &) {
+            threw = true;
+        }
+        CHECK(threw);
+    }
+}
+
+int main() {
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "voxelity_region_file_test";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+
+    testCodecRoundTrip();
+    testCodecFluidRoundTrip();
+    testCodecRejectsDamagedData();
+    testRegionRoundTrip(directory / "roundtrip.vxr");
+    testHeaderRecoversTruncatedData(directory / "truncated.vxr");
+    testHeaderValidation(directory / "header.vxr");
+    testStorageRejectsForeignChunk(directory / "storage");
+
+    std::filesystem::remove_all(directory);
+    return test::result();
+}
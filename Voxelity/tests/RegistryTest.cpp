@@ -0,0 +1,233 @@
+#include <string>
+
+#include "Check.h"
+
+#include "Ashen/ECS/Query.h"
+#include "Ashen/ECS/Registry.h"
+
+using namespace voxelity;
+
+namespace {
+    struct Position {
+        int x = 0;
+        int y = 0;
+    };
+
+    struct Velocity {
+        int dx = 0;
+    };
+
+    struct Frozen {
+    };
+
+    // Compte les instances vivantes : chaque construction (copie, déplacement compris) doit avoir
+    // exactement une destruction, même à travers les relocalisations des archétypes
+    struct Named {
+        static int &live() {
+            static int count = 0;
+            return count;
+        }
+
+        std::string name;
+
+        explicit Named(std::string value) : name(std::move(value)) { ++live(); }
+        Named(const Named &other) : name(other.name) { ++live(); }
+        Named(Named &&other) noexcept : name(std::move(other.name)) { ++live(); }
+        Named &operator=(const Named &) = default;
+        Named &operator=(Named &&) noexcept = default;
+        ~Named() { --live(); }
+    };
+
+    bool hasPosition(const ash::Registry &registry, const ash::EntityId entity, const int x) {
+        const Position *position = registry.TryGet<Position>(entity);
+        return position && position->x == x && position->y == -x;
+    }
+
+    // Add / Remove : l'entité change d'archétype avec ses composants, et la dernière ligne de
+    // l'archétype quitté vient combler le trou (son emplacement est corrigé dans Move et Destroy)
+    void testTransitions() {
+        ash::Registry registry;
+        const ash::EntityId a = registry.Create(Position{1, -1});
+        const ash::EntityId b = registry.Create(Position{2, -2});
+        const ash::EntityId c = registry.Create(Position{3, -3});
+
+        registry.Add<Velocity>(a, Velocity{10});
+        CHECK_EQ(registry.GetMask(a), (ash::MaskOf<Position, Velocity>()));
+        CHECK(hasPosition(registry, a, 1));
+        CHECK_EQ(registry.Get<Velocity>(a).dx, 10);
+        CHECK(hasPosition(registry, b, 2));
+        CHECK(hasPosition(registry, c, 3)); // Déplacée à la place de a dans Move
+
+        // Composant déjà présent : remplacé, pas de changement d'archétype
+        const ash::Size archetypes = registry.GetArchetypeCount();
+        registry.Add<Velocity>(a, Velocity{20});
+        CHECK_EQ(registry.Get<Velocity>(a).dx, 20);
+        CHECK_EQ(registry.GetArchetypeCount(), archetypes);
+
+        registry.Remove<Velocity>(a);
+        registry.Remove<Velocity>(a); // Absent : sans effet
+        CHECK_EQ(registry.GetMask(a), ash::MaskOf<Position>());
+        CHECK(!registry.Has<Velocity>(a));
+        CHECK(registry.TryGet<Velocity>(a) == nullptr);
+        CHECK(hasPosition(registry, a, 1));
+
+        // Transition déjà résolue : même archétype à l'aller
+        registry.Add<Velocity>(b, Velocity{30});
+        CHECK_EQ(registry.GetArchetypeCount(), archetypes);
+
+        registry.Destroy(c); // c, puis a (dernière ligne) vient à sa place
+        CHECK(!registry.IsAlive(c));
+        CHECK(hasPosition(registry, a, 1));
+        CHECK(hasPosition(registry, b, 2));
+        CHECK_EQ(registry.Get<Velocity>(b).dx, 30);
+        CHECK_EQ(registry.GetEntityCount(), 2u);
+
+        ash::Query<const Position> positions(registry);
+        CHECK_EQ(positions.Count(), 2u);
+    }
+
+    // Plusieurs blocs par archétype : les trous comblés depuis un autre bloc
+    void testTransitionsAcrossChunks() {
+        ash::Registry registry;
+        ash::Vector<ash::EntityId> entities;
+        for (int i = 0; i < 3000; ++i)
+            entities.push_back(registry.Create(Position{i, -i}));
+
+        for (int i = 0; i < 3000; i += 3)
+            registry.Add<Velocity>(entities[i], Velocity{i});
+        for (int i = 1; i < 3000; i += 3)
+            registry.Destroy(entities[i]);
+
+        bool consistent = true;
+        for (int i = 0; i < 3000; ++i) {
+            const ash::EntityId entity = entities[i];
+            if (i % 3 == 1) {
+                consistent &= !registry.IsAlive(entity);
+                continue;
+            }
+            consistent &= hasPosition(registry, entity, i);
+            const Velocity *velocity = registry.TryGet<Velocity>(entity);
+            consistent &= i % 3 == 0 ? velocity && velocity->dx == i : velocity == nullptr;
+        }
+        CHECK(consistent);
+        CHECK_EQ(registry.GetEntityCount(), 2000u);
+    }
+
+    // Create avec plusieurs composants : l'archétype final directement, sans étape intermédiaire
+    void testCreateWithComponents() {
+        ash::Registry registry;
+        const ash::EntityId entity = registry.Create(Position{4, -4}, Velocity{5}, Named("block"));
+        CHECK_EQ(registry.GetArchetypeCount(), 1u);
+        CHECK_EQ(registry.GetMask(entity), (ash::MaskOf<Position, Velocity, Named>()));
+        CHECK(hasPosition(registry, entity, 4));
+        CHECK_EQ(registry.Get<Velocity>(entity).dx, 5);
+        CHECK(registry.Get<Named>(entity).name == "block");
+
+        const ash::EntityId empty = registry.Create();
+        CHECK(registry.IsAlive(empty));
+        CHECK_EQ(registry.GetMask(empty), 0u);
+    }
+
+    // Liste de Match mise en cache avant la création des archétypes concernés
+    void testMatchFollowsNewArchetypes() {
+        ash::Registry registry;
+        ash::Query<const Position> positions(registry);
+        ash::Query<const Position> thawed(registry, ash::MaskOf<Frozen>());
+        CHECK_EQ(positions.Count(), 0u);
+
+        registry.Create(Position{1, -1});
+        registry.Create(Position{2, -2}, Velocity{1});
+        const ash::EntityId frozen = registry.Create(Position{3, -3}, Frozen{});
+        registry.Create(Velocity{2});
+
+        CHECK_EQ(positions.Count(), 3u);
+        CHECK_EQ(thawed.Count(), 2u);
+
+        int sum = 0;
+        positions.Each([&](ash::EntityId, const Position &position) { sum += position.x; });
+        CHECK_EQ(sum, 6);
+
+        // Même demande : même liste, complétée sur place
+        CHECK(&registry.Match(ash::MaskOf<Position>()) == &registry.Match(ash::MaskOf<Position>()));
+
+        registry.Remove<Frozen>(frozen);
+        CHECK_EQ(thawed.Count(), 3u);
+    }
+
+    // Clear : tous les identifiants invalides, emplacements réutilisés sous une nouvelle génération
+    void testClearBumpsGenerations() {
+        ash::Registry registry;
+        const ash::EntityId a = registry.Create(Position{1, -1});
+        const ash::EntityId b = registry.Create(Velocity{2});
+        ash::Query<const Position> positions(registry);
+
+        registry.Clear();
+        CHECK_EQ(registry.GetEntityCount(), 0u);
+        CHECK(!registry.IsAlive(a));
+        CHECK(!registry.IsAlive(b));
+        CHECK(registry.TryGet<Position>(a) == nullptr);
+        CHECK_EQ(positions.Count(), 0u);
+
+        const ash::EntityId c = registry.Create(Position{3, -3});
+        const ash::EntityId d = registry.Create(Position{4, -4});
+        CHECK(c.index == a.index || c.index == b.index);
+        CHECK(d.index == a.index || d.index == b.index);
+        CHECK(c != a && c != b && d != a && d != b);
+        CHECK(!registry.IsAlive(a));
+        CHECK(hasPosition(registry, c, 3));
+        CHECK_EQ(positions.Count(), 2u); // Requête d'avant Clear
+    }
+
+    // std::string relogé par Move, Erase et Create : ni double destruction, ni fuite
+    void testNonTrivialComponents() {
+        Named::live() = 0;
+        {
+            ash::Registry registry;
+            ash::Vector<ash::EntityId> entities;
+            for (int i = 0; i < 1000; ++i)
+                entities.push_back(registry.Create(Named("entity with a heap-allocated name " + std::to_string(i))));
+            CHECK_EQ(Named::live(), 1000);
+
+            for (int i = 0; i < 1000; i += 2)
+                registry.Add<Velocity>(entities[i], Velocity{i});
+            CHECK_EQ(Named::live(), 1000);
+
+            for (int i = 0; i < 1000; i += 4)
+                registry.Destroy(entities[i]);
+            registry.Destroy(entities[0]); // Déjà détruite : sans effet
+            CHECK_EQ(Named::live(), 750);
+
+            registry.Add<Named>(entities[1], Named("renamed"));
+            CHECK_EQ(Named::live(), 750);
+
+            for (int i = 1; i < 1000; i += 4)
+                registry.Remove<Named>(entities[i]);
+            CHECK_EQ(Named::live(), 500);
+
+            bool intact = true;
+            for (int i = 2; i < 1000; ++i) {
+                if (i % 4 == 0 || i % 4 == 1) continue;
+                const Named *named = registry.TryGet<Named>(entities[i]);
+                intact &= named && named->name == "entity with a heap-allocated name " + std::to_string(i);
+            }
+            CHECK(intact);
+
+            registry.Clear();
+            CHECK_EQ(Named::live(), 0);
+
+            registry.Create(Named("after clear"), Position{});
+            CHECK_EQ(Named::live(), 1);
+        }
+        CHECK_EQ(Named::live(), 0); // Détruite avec le Registry
+    }
+}
+
+int main() {
+    testTransitions();
+    testTransitionsAcrossChunks();
+    testCreateWithComponents();
+    testMatchFollowsNewArchetypes();
+    testClearBumpsGenerations();
+    testNonTrivialComponents();
+    return test::result();
+}
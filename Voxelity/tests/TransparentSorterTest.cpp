@@ -0,0 +1,165 @@
+#include <algorithm>
+#include <random>
+
+#include "Check.h"
+
+#include "Voxelity/voxelWorld/render/TransparentSorter.h"
+#include "Voxelity/voxelWorld/utils/DirectionUtils.h"
+
+using namespace voxelity;
+
+namespace {
+    float squaredDistance(const FaceInstance &face, const glm::vec3 &camera) {
+        const glm::vec3 delta = TransparentSorter::getFaceCenter(face) - camera;
+        return glm::dot(delta, delta);
+    }
+
+    ash::Vector<FaceInstance> makeFaces(const size_t count, const uint32_t seed) {
+        std::mt19937 random(seed);
+        ash::Vector<FaceInstance> faces;
+        faces.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            faces.emplace_back(random() % 32, random() % 32, random() % 32, random() % 6, VoxelID::WATER,
+                               random() % 256);
+        }
+        return faces;
+    }
+
+    void testFaceCenter() {
+        const FaceInstance face(3, 4, 5, static_cast<uint8_t>(CubicDirection::XP), VoxelID::GLASS);
+        const glm::vec3 center = TransparentSorter::getFaceCenter(face);
+        CHECK_EQ(center.x, 4.0f);
+        CHECK_EQ(center.y, 4.5f);
+        CHECK_EQ(center.z, 5.5f);
+
+        const FaceInstance below(3, 4, 5, static_cast<uint8_t>(CubicDirection::YN), VoxelID::GLASS);
+        CHECK_EQ(TransparentSorter::getFaceCenter(below).y, 4.0f);
+    }
+
+    void testFacesSortedBackToFront() {
+        ash::Vector<FaceInstance> faces = makeFaces(2048, 3);
+        ash::Vector<uint32_t> original;
+        for (const FaceInstance &face: faces) original.push_back(face.data);
+
+        const glm::vec3 camera(10.3f, 40.0f, -5.0f);
+        TransparentSorter sorter;
+        sorter.sortFaces(faces, camera);
+
+        int inversions = 0;
+        for (size_t i = 1; i < faces.size(); ++i)
+            inversions += squaredDistance(faces[i - 1], camera) < squaredDistance(faces[i], camera);
+        CHECK_EQ(inversions, 0);
+
+        // Mêmes faces, lumière et type compris : seul l'ordre change
+        ash::Vector<uint32_t> sorted;
+        for (const FaceInstance &face: faces) sorted.push_back(face.data);
+        std::ranges::sort(original);
+        std::ranges::sort(sorted);
+        CHECK(original == sorted);
+    }
+
+    void testEqualDistancesKeepTheirOrder() {
+        // Deux faces symétriques par rapport à la caméra : l'ordre ne bascule pas d'un tri à l'autre
+        const auto up = static_cast<uint8_t>(CubicDirection::YP);
+        ash::Vector<FaceInstance> faces = {
+            FaceInstance(10, 0, 8, up, VoxelID::WATER),
+            FaceInstance(2, 0, 8, up, VoxelID::GLASS),
+            FaceInstance(6, 0, 8, up, VoxelID::ICE)
+        };
+        const glm::vec3 camera(6.5f, 4.0f, 8.5f);
+
+        TransparentSorter sorter;
+        sorter.sortFaces(faces, camera);
+        CHECK_EQ(faces[0].voxelID, VoxelID::WATER);
+        CHECK_EQ(faces[1].voxelID, VoxelID::GLASS);
+        CHECK_EQ(faces[2].voxelID, VoxelID::ICE);
+
+        sorter.sortFaces(faces, camera);
+        CHECK_EQ(faces[0].voxelID, VoxelID::WATER);
+        CHECK_EQ(faces[1].voxelID, VoxelID::GLASS);
+    }
+
+    void testNeedsResortThreshold() {
+        const glm::vec3 origin(0.0f);
+
+        // Chunk de la caméra : un bloc de marge
+        CHECK(!TransparentSorter::needsResort(origin, {0.5f, 0.0f, 0.0f}, 0.0f));
+        CHECK(!TransparentSorter::needsResort(origin, {1.0f, 0.0f, 0.0f}, 0.0f));
+        CHECK(TransparentSorter::needsResort(origin, {1.5f, 0.0f, 0.0f}, 0.0f));
+
+        // À 64 voxels : 1 + 64 / 8 = 9 voxels de marge, dans toutes les directions
+        CHECK(!TransparentSorter::needsResort(origin, {5.0f, 0.0f, 0.0f}, 64.0f));
+        CHECK(!TransparentSorter::needsResort(origin, {0.0f, -6.0f, 6.0f}, 64.0f));
+        CHECK(TransparentSorter::needsResort(origin, {10.0f, 0.0f, 0.0f}, 64.0f));
+        CHECK(TransparentSorter::needsResort(origin, {0.0f, 7.0f, -7.0f}, 64.0f));
+    }
+
+    // Réutilisation telle que ChunkInstanceBuffer::sortTransparent la pratique : tri gardé tant que
+    // needsResort est faux. Renvoie le nombre de tris pour une marche de la caméra le long de X
+    int countResorts(const glm::vec3 &chunkCenter, const float walk, const float step) {
+        int resorts = 0;
+        bool sorted = false;
+        glm::vec3 sortedFrom(0.0f);
+        for (float x = 0.0f; x <= walk; x += step) {
+            const glm::vec3 camera(x, 0.0f, 0.0f);
+            const float distance = glm::length(chunkCenter - camera);
+            if (sorted && !TransparentSorter::needsResort(sortedFrom, camera, distance)) continue;
+
+            sortedFrom = camera;
+            sorted = true;
+            ++resorts;
+        }
+        return resorts;
+    }
+
+    void testFarChunksResortLess() {
+        const int near = countResorts({16.0f, 0.0f, 16.0f}, 64.0f, 0.1f);
+        const int far = countResorts({16.0f, 0.0f, 400.0f}, 64.0f, 0.1f);
+        CHECK(near >= 10);
+        CHECK(far <= 4);
+        CHECK(far < near);
+    }
+
+    void testChunksSortedFarthestFirst() {
+        ash::Vector<ash::Own<Chunk> > storage;
+        ash::Vector<const Chunk *> chunks;
+        for (int x = -3; x <= 3; ++x) {
+            for (int z = -3; z <= 3; ++z) {
+                storage.push_back(std::make_unique<Chunk>(ChunkCoord(x, 0, z)));
+                chunks.push_back(storage.back().get());
+            }
+        }
+        std::ranges::shuffle(chunks, std::mt19937(5));
+
+        // Caméra au centre du chunk (0, 0, 0)
+        const glm::vec3 camera(16.0f);
+        TransparentSorter sorter;
+        sorter.sortChunks(chunks, camera, 1.0f);
+
+        const auto distance = [&](const Chunk *chunk) {
+            const glm::vec3 delta = TransparentSorter::getChunkOrigin(chunk->getPosition(), 1.0f) + 16.0f - camera;
+            return glm::dot(delta, delta);
+        };
+        int inversions = 0;
+        for (size_t i = 1; i < chunks.size(); ++i)
+            inversions += distance(chunks[i - 1]) < distance(chunks[i]);
+        CHECK_EQ(inversions, 0);
+        CHECK(chunks.back()->getPosition() == glm::ivec3(0));
+
+        // Égalités départagées par les coordonnées : même résultat quel que soit l'ordre d'entrée
+        ash::Vector<const Chunk *> reversed(chunks.rbegin(), chunks.rend());
+        sorter.sortChunks(reversed, camera, 1.0f);
+        CHECK(reversed == chunks);
+    }
+}
+
+int main() {
+    testFaceCenter();
+    testFacesSortedBackToFront();
+    testEqualDistancesKeepTheirOrder();
+    testNeedsResortThreshold();
+    testFarChunksResortLess();
+    testChunksSortedFarthestFirst();
+
+    return voxelity::test::result();
+}
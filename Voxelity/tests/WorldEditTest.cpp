@@ -0,0 +1,147 @@
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <stdexcept>
+#include <thread>
+
+#include "Check.h"
+
+#include "Voxelity/voxelWorld/generation/ITerrainGenerator.h"
+#include "Voxelity/voxelWorld/tick/BlockTicker.h"
+#include "Voxelity/voxelWorld/world/World.h"
+
+using namespace voxelity;
+
+namespace {
+    // Charge les chunks autour de l'origine et attend le chunk (0, 0, 0)
+    bool loadOrigin(const World &world) {
+        world.updateLoadedChunks(glm::vec3(8.0f), 1);
+        for (int attempt = 0; attempt < 500 && !world.getChunk(0, 0, 0); ++attempt) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            world.processChunkLoading();
+        }
+        return world.getChunk(0, 0, 0) != nullptr;
+    }
+
+    void testSourcelessWorldCreatesChunks() {
+        World world(nullptr);
+        world.setVoxel(1, 2, 3, VoxelID::STONE);
+        CHECK_EQ(world.getVoxel(1, 2, 3), VoxelID::STONE);
+        CHECK_EQ(world.getLoadedChunkCount(), 1u);
+    }
+
+    // Du sable posé en masse au-dessus du vide doit recevoir sa mise à jour de voisinage, puis son tick de chute
+    void testFillBoxSchedulesFallingBlocks() {
+        World world(nullptr);
+        const BlockTicker &ticker = world.getBlockTicker();
+        world.fillBox({{2, 10, 2}, {5, 10, 5}}, VoxelID::SAND);
+        CHECK_EQ(ticker.getPendingTickCount(), 16u);
+
+        world.tick();
+        CHECK_EQ(ticker.getPendingTickCount(), 16u);
+    }
+
+    // Motif asymétrique en x, y et z : une permutation des axes du tampon donne d'autres voxels
+    VoxelType patternAt(const int x, const int y, const int z) {
+        constexpr std::array<VoxelType, 8> TYPES = {
+            VoxelID::DIRT, VoxelID::STONE, VoxelID::GLASS, VoxelID::WOOD,
+            VoxelID::COBBLESTONE, VoxelID::PLANKS, VoxelID::BRICK, VoxelID::OBSIDIAN
+        };
+        return TYPES[((x + 3 * z + 5 * y) % 8 + 8) % 8];
+    }
+
+    // Région à cheval sur 3 × 2 × 3 chunks dont la couche du dessus n'existe pas : copie, vérification
+    // de la disposition X, puis Z, puis Y et du remplissage, puis collage ailleurs et relecture
+    void testCopyPasteRoundTrip() {
+        World world(nullptr);
+        for (int y = 28; y < 32; ++y) {
+            for (int z = -2; z <= 34; ++z) {
+                for (int x = -3; x <= 35; ++x)
+                    world.setVoxel(x, y, z, patternAt(x, y, z));
+            }
+        }
+        CHECK(world.getChunk(0, 1, 0) == nullptr);
+
+        const ash::BBox3i box{{-3, 28, -2}, {35, 35, 34}};
+        const ash::IVec3 size = box.max - box.min + 1;
+        ash::Vector<VoxelType> buffer(World::getRegionVolume(box));
+        world.copyRegion(box, buffer, VoxelID::BEDROCK);
+
+        bool layoutMatches = true;
+        for (int y = 0; y < size.y; ++y) {
+            for (int z = 0; z < size.z; ++z) {
+                for (int x = 0; x < size.x; ++x) {
+                    const ash::IVec3 position = box.min + ash::IVec3(x, y, z);
+                    const VoxelType expected = position.y < 32
+                                                   ? patternAt(position.x, position.y, position.z)
+                                                   : VoxelID::BEDROCK; // Chunk absent
+                    layoutMatches &= buffer[x + size.x * (z + size.z * y)] == expected;
+                }
+            }
+        }
+        CHECK(layoutMatches);
+
+        bool threw = false;
+        try {
+            world.copyRegion(box, std::span(buffer.data(), buffer.size() - 1));
+        } catch (const std::invalid_argument &) {
+            threw = true;
+        }
+        CHECK(threw);
+
+        // Collage décalé, y compris sous y = 0 : le tampon relu est identique
+        const ash::IVec3 shift{100, -40, 7};
+        const ash::BBox3i target{box.min + shift, box.max + shift};
+        World copy(nullptr);
+        copy.pasteRegion(target, buffer);
+        CHECK_EQ(copy.getVoxel(ash::IVec3(-3, 28, -2) + shift), patternAt(-3, 28, -2));
+        CHECK_EQ(copy.getVoxel(ash::IVec3(35, 35, 34) + shift), VoxelID::BEDROCK);
+
+        ash::Vector<VoxelType> roundTrip(buffer.size(), VoxelID::AIR);
+        copy.copyRegion(target, roundTrip);
+        CHECK(roundTrip == buffer);
+    }
+
+    void testEditBeforeLoadKeepsStoredChunk(const std::filesystem::path &directory) {
+        {
+            World world(nullptr);
+            world.enablePersistence(directory);
+            CHECK(loadOrigin(world));
+            world.setVoxel(1, 2, 3, VoxelID::STONE);
+            world.save();
+        }
+
+        World world(nullptr);
+        world.enablePersistence(directory);
+
+        // Chunk pas encore chargé : les modifications sont abandonnées, aucun chunk vide n'est créé
+        world.setVoxel(4, 5, 6, VoxelID::DIRT);
+        const VoxelEdit edit{{7, 8, 9}, VoxelID::DIRT};
+        CHECK_EQ(world.setVoxels({&edit, 1}), 1u);
+        world.fillBox({{0, 0, 0}, {15, 0, 15}}, VoxelID::SAND);
+        CHECK(world.getChunk(0, 0, 0) == nullptr);
+        CHECK_EQ(world.getLoadedChunkCount(), 0u);
+
+        // Le chargement rend la version sauvegardée, sans les modifications abandonnées
+        CHECK(loadOrigin(world));
+        CHECK_EQ(world.getVoxel(1, 2, 3), VoxelID::STONE);
+        CHECK_EQ(world.getVoxel(4, 5, 6), VoxelID::AIR);
+        CHECK_EQ(world.getVoxel(0, 0, 0), VoxelID::AIR);
+
+        world.setVoxel(4, 5, 6, VoxelID::DIRT);
+        CHECK_EQ(world.getVoxel(4, 5, 6), VoxelID::DIRT);
+    }
+}
+
+int main() {
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "voxelity_world_edit_test";
+    std::filesystem::remove_all(directory);
+
+    testSourcelessWorldCreatesChunks();
+    testFillBoxSchedulesFallingBlocks();
+    testCopyPasteRoundTrip();
+    testEditBeforeLoadKeepsStoredChunk(directory);
+
+    std::filesystem::remove_all(directory);
+    return test::result();
+}